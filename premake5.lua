@@ -175,6 +175,12 @@ newoption
     description = "Enables compilation of supplied unit tests"
 }
 
+newoption
+{
+    trigger = "tools",
+    description = "Enables compilation of supplied tools"
+}
+
 newoption
 {
     trigger = "no-examples",
@@ -251,6 +257,11 @@ project "ktt"
     if not libraries then
         error("Compute API libraries were not found")
     end
+
+    filter "system:linux"
+        links { "pthread" }
+    
+    filter {}
     
 -- Examples configuration 
 if not _OPTIONS["no-examples"] then
@@ -358,3 +369,30 @@ project "tests"
     end
     
 end -- _OPTIONS["tests"]
+
+-- Tools configuration
+if _OPTIONS["tools"] then
+
+project "searcher_benchmark"
+    kind "ConsoleApp"
+    files { "tools/searcher_benchmark/*.cpp", "source/**.h", "source/**.hpp", "source/**.cpp" }
+    includedirs { "source" }
+    defines { "KTT_LIBRARY" }
+    
+    if _OPTIONS["platform"] then
+        if _OPTIONS["platform"] == "amd" then
+            findLibrariesAmd()
+        elseif _OPTIONS["platform"] == "intel" then
+            findLibrariesIntel()
+        else
+            findLibrariesNvidia()
+        end
+    else
+        findLibraries()
+    end
+    
+    if _OPTIONS["vulkan"] then
+        findVulkan()
+    end
+    
+end -- _OPTIONS["tools"]
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "ktt_platform.h"
+#include "dto/tuning_result.h"
+#include "kernel/kernel_configuration.h"
+#include "kernel/kernel_parameter.h"
+
+namespace ktt
+{
+
+class KTT_API Searcher
+{
+public:
+    Searcher() :
+        batchResultPending(false)
+    {}
+
+    virtual ~Searcher() = default;
+    virtual void initialize(const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters)
+    {}
+    virtual KernelConfiguration getNextConfiguration() = 0;
+    virtual void calculateNextConfiguration(const TuningResult& previousResult) = 0;
+    virtual size_t getConfigurationsCount() const = 0;
+
+    // Batch protocol, default implementation proposes single configuration and waits for its result
+    virtual std::vector<KernelConfiguration> getNextConfigurationBatch(const size_t maximumCount)
+    {
+        if (maximumCount == 0 || batchResultPending)
+        {
+            return std::vector<KernelConfiguration>{};
+        }
+
+        batchResultPending = true;
+        return std::vector<KernelConfiguration>{getNextConfiguration()};
+    }
+
+    virtual void processBatchResult(const TuningResult& result)
+    {
+        batchResultPending = false;
+        calculateNextConfiguration(result);
+    }
+
+    // Called when result which was already passed to searcher as valid fails asynchronous validation later
+    virtual void invalidateResult(const TuningResult& result)
+    {}
+
+private:
+    bool batchResultPending;
+};
+
+} // namespace ktt
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -45,6 +46,7 @@ public:
     virtual std::vector<PlatformInfo> getPlatformInfo() const = 0;
     virtual std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const = 0;
     virtual DeviceInfo getCurrentDeviceInfo() const = 0;
+    virtual bool isProgramCached(const std::string& source) const = 0;
 };
 
 } // namespace ktt
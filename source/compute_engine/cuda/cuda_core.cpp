@@ -30,14 +30,15 @@ CudaCore::CudaCore(const size_t deviceIndex, const RunMode& runMode) :
 KernelRunResult CudaCore::runKernel(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers,
     const std::vector<ArgumentOutputDescriptor>& outputDescriptors)
 {
-    std::unique_ptr<CudaProgram> program = createAndBuildProgram(kernelData.getSource());
-    std::unique_ptr<CudaKernel> kernel = createKernel(*program, kernelData.getName());
+    uint64_t compilationDuration = 0;
+    const CudaProgram& program = loadProgram(kernelData.getSource(), compilationDuration);
+    std::unique_ptr<CudaKernel> kernel = createKernel(program, kernelData.getName());
     std::vector<CUdeviceptr*> kernelArguments = getKernelArguments(argumentPointers);
+    const size_t sharedMemorySize = getSharedMemorySizeInBytes(argumentPointers);
 
     Timer timer;
     timer.start();
-    float duration = enqueueKernel(*kernel, kernelData.getGlobalSize(), kernelData.getLocalSize(), kernelArguments,
-        getSharedMemorySizeInBytes(argumentPointers));
+    float duration = enqueueKernel(*kernel, kernelData.getGlobalSize(), kernelData.getLocalSize(), kernelArguments, sharedMemorySize);
 
     timer.stop();
     uint64_t overhead = timer.getElapsedTime();
@@ -54,12 +55,17 @@ KernelRunResult CudaCore::runKernel(const KernelRuntimeData& kernelData, const s
         }
     }
 
-    return KernelRunResult(static_cast<uint64_t>(duration), overhead);
+    KernelRunResult result(static_cast<uint64_t>(duration), overhead);
+    result.increaseCompilationDuration(compilationDuration);
+    result.increaseWorkGroupMemory(kernel->getWorkGroupMemorySize(kernelData.getLocalSizeDimensionVector().getTotalSize(), sharedMemorySize));
+    return result;
 }
 
 void CudaCore::setCompilerOptions(const std::string& options)
 {
     compilerOptions = options;
+    programCache.clear();
+    programCacheOrder.clear();
 }
 
 void CudaCore::setGlobalSizeType(const GlobalSizeType& type)
@@ -229,6 +235,11 @@ DeviceInfo CudaCore::getCurrentDeviceInfo() const
     return getCudaDeviceInfo(deviceIndex);
 }
 
+bool CudaCore::isProgramCached(const std::string& source) const
+{
+    return programCache.find(source) != programCache.end();
+}
+
 std::unique_ptr<CudaProgram> CudaCore::createAndBuildProgram(const std::string& source) const
 {
     auto program = std::make_unique<CudaProgram>(source);
@@ -410,6 +421,32 @@ CUdeviceptr* CudaCore::loadBufferFromCache(const ArgumentId id) const
     return nullptr;
 }
 
+const CudaProgram& CudaCore::loadProgram(const std::string& source, uint64_t& compilationDuration)
+{
+    auto programPointer = programCache.find(source);
+    if (programPointer != programCache.end())
+    {
+        compilationDuration = 0;
+        return *programPointer->second;
+    }
+
+    Timer timer;
+    timer.start();
+    std::unique_ptr<CudaProgram> program = createAndBuildProgram(source);
+    timer.stop();
+    compilationDuration = timer.getElapsedTime();
+
+    // Programs are evicted in order of insertion
+    if (programCache.size() >= programCacheCapacity)
+    {
+        programCache.erase(programCacheOrder.front());
+        programCacheOrder.pop_front();
+    }
+
+    programCacheOrder.push_back(source);
+    return *programCache.insert(std::make_pair(source, std::move(program))).first->second;
+}
+
 #else
 
 CudaCore::CudaCore(const size_t, const RunMode&)
@@ -497,6 +534,11 @@ DeviceInfo CudaCore::getCurrentDeviceInfo() const
     throw std::runtime_error("Support for CUDA API is not included in this version of KTT library");
 }
 
+bool CudaCore::isProgramCached(const std::string&) const
+{
+    throw std::runtime_error("Support for CUDA API is not included in this version of KTT library");
+}
+
 #endif // PLATFORM_CUDA
 
 } // namespace ktt
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -32,6 +34,8 @@ namespace ktt
 class CudaCore : public ComputeEngine
 {
 public:
+    static const size_t programCacheCapacity = 32;
+
     // Constructor
     explicit CudaCore(const size_t deviceIndex, const RunMode& runMode);
 
@@ -59,6 +63,7 @@ public:
     std::vector<PlatformInfo> getPlatformInfo() const override;
     std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const override;
     DeviceInfo getCurrentDeviceInfo() const override;
+    bool isProgramCached(const std::string& source) const override;
 
     // Low-level kernel execution methods
     std::unique_ptr<CudaProgram> createAndBuildProgram(const std::string& source) const;
@@ -76,6 +81,8 @@ private:
     std::unique_ptr<CudaContext> context;
     std::unique_ptr<CudaStream> stream;
     std::set<std::unique_ptr<CudaBuffer>> buffers;
+    std::map<std::string, std::unique_ptr<CudaProgram>> programCache;
+    std::deque<std::string> programCacheOrder;
 
     DeviceInfo getCudaDeviceInfo(const size_t deviceIndex) const;
     std::vector<CudaDevice> getCudaDevices() const;
@@ -83,6 +90,7 @@ private:
     size_t getSharedMemorySizeInBytes(const std::vector<KernelArgument*>& argumentPointers) const;
     CudaBuffer* findBuffer(const ArgumentId id) const;
     CUdeviceptr* loadBufferFromCache(const ArgumentId id) const;
+    const CudaProgram& loadProgram(const std::string& source, uint64_t& compilationDuration);
 };
 
 #else
@@ -117,6 +125,7 @@ public:
     std::vector<PlatformInfo> getPlatformInfo() const override;
     std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const override;
     DeviceInfo getCurrentDeviceInfo() const override;
+    bool isProgramCached(const std::string& source) const override;
 };
 
 #endif // PLATFORM_CUDA
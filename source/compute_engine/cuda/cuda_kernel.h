@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include "cuda.h"
 #include "cuda_utility.h"
@@ -32,6 +33,16 @@ public:
         return kernel;
     }
 
+    // Static and dynamic shared memory and local memory of all threads in block
+    uint64_t getWorkGroupMemorySize(const size_t workGroupSize, const size_t dynamicSharedMemorySize) const
+    {
+        int sharedMemorySize;
+        checkCudaError(cuFuncGetAttribute(&sharedMemorySize, CU_FUNC_ATTRIBUTE_SHARED_SIZE_BYTES, kernel), "cuFuncGetAttribute");
+        int localMemorySize;
+        checkCudaError(cuFuncGetAttribute(&localMemorySize, CU_FUNC_ATTRIBUTE_LOCAL_SIZE_BYTES, kernel), "cuFuncGetAttribute");
+        return static_cast<uint64_t>(sharedMemorySize) + dynamicSharedMemorySize + static_cast<uint64_t>(localMemorySize) * workGroupSize;
+    }
+
 private:
     CUmodule module;
     std::string kernelName;
@@ -11,7 +11,8 @@ OpenclCore::OpenclCore(const size_t platformIndex, const size_t deviceIndex, con
     compilerOptions(std::string("")),
     runMode(runMode),
     globalSizeType(GlobalSizeType::Opencl),
-    globalSizeCorrection(false)
+    globalSizeCorrection(false),
+    hardwareCountersEnabled(false)
 {
     auto platforms = getOpenclPlatforms();
     if (platformIndex >= platforms.size())
@@ -28,25 +29,39 @@ OpenclCore::OpenclCore(const size_t platformIndex, const size_t deviceIndex, con
     cl_device_id device = devices.at(deviceIndex).getId();
     context = std::make_unique<OpenclContext>(platforms.at(platformIndex).getId(), std::vector<cl_device_id>{ device });
     commandQueue = std::make_unique<OpenclCommandQueue>(context->getContext(), device);
+
+    // Hardware counters of host threads describe kernel execution only on CPU devices
+    hardwareCountersEnabled = hardwareCounters.isSupported() && getCurrentDeviceInfo().getDeviceType() == DeviceType::CPU;
 }
 
 KernelRunResult OpenclCore::runKernel(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers,
     const std::vector<ArgumentOutputDescriptor>& outputDescriptors)
 {
-    std::unique_ptr<OpenclProgram> program = createAndBuildProgram(kernelData.getSource());
-    std::unique_ptr<OpenclKernel> kernel = createKernel(*program, kernelData.getName());
+    uint64_t compilationDuration = 0;
+    const OpenclProgram& program = loadProgram(kernelData.getSource(), compilationDuration);
+    std::unique_ptr<OpenclKernel> kernel = createKernel(program, kernelData.getName());
 
     for (const auto argument : argumentPointers)
     {
         setKernelArgument(*kernel, *argument);
     }
 
+    if (hardwareCountersEnabled)
+    {
+        hardwareCounters.start();
+    }
+
     Timer timer;
     timer.start();
     cl_ulong duration = enqueueKernel(*kernel, kernelData.getGlobalSize(), kernelData.getLocalSize());
     timer.stop();
     uint64_t overhead = timer.getElapsedTime();
 
+    if (hardwareCountersEnabled)
+    {
+        hardwareCounters.stop();
+    }
+
     for (const auto& descriptor : outputDescriptors)
     {
         if (descriptor.getOutputSizeInBytes() == 0)
@@ -59,12 +74,22 @@ KernelRunResult OpenclCore::runKernel(const KernelRuntimeData& kernelData, const
         }
     }
 
-    return KernelRunResult(static_cast<uint64_t>(duration), overhead);
+    KernelRunResult result(static_cast<uint64_t>(duration), overhead);
+    result.increaseCompilationDuration(compilationDuration);
+    result.increaseWorkGroupMemory(kernel->getWorkGroupMemorySize(commandQueue->getDevice(),
+        kernelData.getLocalSizeDimensionVector().getTotalSize()));
+    if (hardwareCountersEnabled)
+    {
+        result.increaseHardwareCounters(hardwareCounters.getValues());
+    }
+    return result;
 }
 
 void OpenclCore::setCompilerOptions(const std::string& options)
 {
     compilerOptions = options;
+    programCache.clear();
+    programCacheOrder.clear();
 }
 
 void OpenclCore::setGlobalSizeType(const GlobalSizeType& type)
@@ -241,6 +266,11 @@ DeviceInfo OpenclCore::getCurrentDeviceInfo() const
     return getOpenclDeviceInfo(platformIndex, deviceIndex);
 }
 
+bool OpenclCore::isProgramCached(const std::string& source) const
+{
+    return programCache.find(source) != programCache.end();
+}
+
 std::unique_ptr<OpenclProgram> OpenclCore::createAndBuildProgram(const std::string& source) const
 {
     auto program = std::make_unique<OpenclProgram>(source, context->getContext(), context->getDevices());
@@ -439,4 +469,30 @@ bool OpenclCore::loadBufferFromCache(const ArgumentId id, OpenclKernel& kernel)
     return false;
 }
 
+const OpenclProgram& OpenclCore::loadProgram(const std::string& source, uint64_t& compilationDuration)
+{
+    auto programPointer = programCache.find(source);
+    if (programPointer != programCache.end())
+    {
+        compilationDuration = 0;
+        return *programPointer->second;
+    }
+
+    Timer timer;
+    timer.start();
+    std::unique_ptr<OpenclProgram> program = createAndBuildProgram(source);
+    timer.stop();
+    compilationDuration = timer.getElapsedTime();
+
+    // Programs are evicted in order of insertion
+    if (programCache.size() >= programCacheCapacity)
+    {
+        programCache.erase(programCacheOrder.front());
+        programCacheOrder.pop_front();
+    }
+
+    programCacheOrder.push_back(source);
+    return *programCache.insert(std::make_pair(source, std::move(program))).first->second;
+}
+
 } // namespace ktt
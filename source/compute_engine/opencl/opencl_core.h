@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+#include <map>
 #include <memory>
 #include <ostream>
 #include <set>
@@ -16,6 +18,7 @@
 #include "dto/kernel_run_result.h"
 #include "enum/run_mode.h"
 #include "kernel_argument/kernel_argument.h"
+#include "utility/hardware_counters.h"
 
 namespace ktt
 {
@@ -23,6 +26,8 @@ namespace ktt
 class OpenclCore : public ComputeEngine
 {
 public:
+    static const size_t programCacheCapacity = 32;
+
     // Constructor
     explicit OpenclCore(const size_t platformIndex, const size_t deviceIndex, const RunMode& runMode);
 
@@ -50,6 +55,7 @@ public:
     std::vector<PlatformInfo> getPlatformInfo() const override;
     std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const override;
     DeviceInfo getCurrentDeviceInfo() const override;
+    bool isProgramCached(const std::string& source) const override;
 
     // Low-level kernel execution methods
     std::unique_ptr<OpenclProgram> createAndBuildProgram(const std::string& source) const;
@@ -68,6 +74,10 @@ private:
     std::unique_ptr<OpenclContext> context;
     std::unique_ptr<OpenclCommandQueue> commandQueue;
     std::set<std::unique_ptr<OpenclBuffer>> buffers;
+    std::map<std::string, std::unique_ptr<OpenclProgram>> programCache;
+    std::deque<std::string> programCacheOrder;
+    HardwareCounters hardwareCounters;
+    bool hardwareCountersEnabled;
 
     // Helper methods
     static PlatformInfo getOpenclPlatformInfo(const size_t platformIndex);
@@ -78,6 +88,7 @@ private:
     OpenclBuffer* findBuffer(const ArgumentId id) const;
     void setKernelArgumentVector(OpenclKernel& kernel, const OpenclBuffer& buffer) const;
     bool loadBufferFromCache(const ArgumentId id, OpenclKernel& openclKernel) const;
+    const OpenclProgram& loadProgram(const std::string& source, uint64_t& compilationDuration);
 };
 
 } // namespace ktt
@@ -63,6 +63,18 @@ public:
         return argumentsCount;
     }
 
+    // Local memory including local memory arguments and private memory of all work-items in work-group
+    cl_ulong getWorkGroupMemorySize(const cl_device_id device, const size_t workGroupSize) const
+    {
+        cl_ulong localMemorySize;
+        checkOpenclError(clGetKernelWorkGroupInfo(kernel, device, CL_KERNEL_LOCAL_MEM_SIZE, sizeof(cl_ulong), &localMemorySize, nullptr),
+            "clGetKernelWorkGroupInfo");
+        cl_ulong privateMemorySize;
+        checkOpenclError(clGetKernelWorkGroupInfo(kernel, device, CL_KERNEL_PRIVATE_MEM_SIZE, sizeof(cl_ulong), &privateMemorySize, nullptr),
+            "clGetKernelWorkGroupInfo");
+        return localMemorySize + privateMemorySize * workGroupSize;
+    }
+
 private:
     cl_program program;
     std::string kernelName;
@@ -0,0 +1,267 @@
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "replay_engine.h"
+
+namespace ktt
+{
+
+ReplayEngine::ReplayEngine(const std::vector<TuningResult>& recordedResults)
+{
+    for (const auto& result : recordedResults)
+    {
+        if (!result.isValid())
+        {
+            continue;
+        }
+
+        std::vector<ParameterPair> parameterPairs = result.getConfiguration().getParameterPairs();
+        if (parameterNames.empty())
+        {
+            for (const auto& parameterPair : parameterPairs)
+            {
+                parameterNames.push_back(std::get<0>(parameterPair));
+            }
+        }
+        else if (parameterPairs.size() != parameterNames.size())
+        {
+            throw std::runtime_error("Recorded results for replay contain configurations with different parameters");
+        }
+
+        std::vector<size_t> parameterValues;
+        for (size_t i = 0; i < parameterPairs.size(); i++)
+        {
+            if (std::get<0>(parameterPairs.at(i)) != parameterNames.at(i))
+            {
+                throw std::runtime_error("Recorded results for replay contain configurations with different parameters");
+            }
+            parameterValues.push_back(std::get<1>(parameterPairs.at(i)));
+        }
+        recordedDurations[parameterValues] = result.getKernelDuration();
+        recordedCompilationDurations[parameterValues] = result.getCompilationDuration();
+        recordedWorkGroupMemory[parameterValues] = result.getWorkGroupMemory();
+    }
+
+    if (recordedDurations.empty())
+    {
+        throw std::runtime_error("No valid recorded results were provided for replay");
+    }
+}
+
+KernelRunResult ReplayEngine::runKernel(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>&,
+    const std::vector<ArgumentOutputDescriptor>&)
+{
+    std::vector<size_t> parameterValues = getParameterValues(kernelData.getSource());
+    KernelRunResult result(getRecordedDuration(parameterValues), 0);
+    result.increaseWorkGroupMemory(recordedWorkGroupMemory.at(parameterValues));
+
+    if (compiledSources.find(kernelData.getSource()) == compiledSources.end())
+    {
+        result.increaseCompilationDuration(getRecordedCompilationDuration(parameterValues));
+        compiledSources.insert(kernelData.getSource());
+    }
+    return result;
+}
+
+void ReplayEngine::setCompilerOptions(const std::string&)
+{
+    compiledSources.clear();
+}
+
+void ReplayEngine::setGlobalSizeType(const GlobalSizeType&)
+{}
+
+void ReplayEngine::setAutomaticGlobalSizeCorrection(const TunerFlag)
+{}
+
+void ReplayEngine::uploadArgument(KernelArgument& kernelArgument)
+{
+    clearBuffer(kernelArgument.getId());
+    buffers.insert(std::make_pair(kernelArgument.getId(), KernelArgument(kernelArgument.getId(), kernelArgument.getData(),
+        kernelArgument.getNumberOfElements(), kernelArgument.getDataType(), kernelArgument.getMemoryLocation(), kernelArgument.getAccessType(),
+        kernelArgument.getUploadType())));
+}
+
+void ReplayEngine::updateArgument(const ArgumentId id, const void* data, const size_t dataSizeInBytes)
+{
+    auto bufferPointer = buffers.find(id);
+    if (bufferPointer == buffers.end())
+    {
+        throw std::runtime_error(std::string("Buffer with following id was not found: ") + std::to_string(id));
+    }
+    bufferPointer->second.updateData(data, dataSizeInBytes / bufferPointer->second.getElementSizeInBytes());
+}
+
+KernelArgument ReplayEngine::downloadArgument(const ArgumentId id) const
+{
+    return findBuffer(id);
+}
+
+void ReplayEngine::downloadArgument(const ArgumentId id, void* destination) const
+{
+    const KernelArgument& buffer = findBuffer(id);
+    std::memcpy(destination, buffer.getData(), buffer.getDataSizeInBytes());
+}
+
+void ReplayEngine::downloadArgument(const ArgumentId id, void* destination, const size_t dataSizeInBytes) const
+{
+    const KernelArgument& buffer = findBuffer(id);
+    if (dataSizeInBytes > buffer.getDataSizeInBytes())
+    {
+        throw std::runtime_error(std::string("Size of data to download is higher than size of buffer with id: ") + std::to_string(id));
+    }
+    std::memcpy(destination, buffer.getData(), dataSizeInBytes);
+}
+
+void ReplayEngine::clearBuffer(const ArgumentId id)
+{
+    buffers.erase(id);
+}
+
+void ReplayEngine::clearBuffers()
+{
+    buffers.clear();
+}
+
+void ReplayEngine::clearBuffers(const ArgumentAccessType& accessType)
+{
+    auto iterator = buffers.begin();
+
+    while (iterator != buffers.end())
+    {
+        if (iterator->second.getAccessType() == accessType)
+        {
+            iterator = buffers.erase(iterator);
+        }
+        else
+        {
+            ++iterator;
+        }
+    }
+}
+
+void ReplayEngine::printComputeApiInfo(std::ostream& outputTarget) const
+{
+    outputTarget << "Platform 0: " << getPlatformInfo().at(0).getName() << std::endl;
+    outputTarget << "Devices for platform 0:" << std::endl;
+    outputTarget << "Device 0: " << getCurrentDeviceInfo().getName() << std::endl;
+    outputTarget << std::endl;
+}
+
+std::vector<PlatformInfo> ReplayEngine::getPlatformInfo() const
+{
+    return std::vector<PlatformInfo>{PlatformInfo(0, "Replay platform")};
+}
+
+std::vector<DeviceInfo> ReplayEngine::getDeviceInfo(const size_t platformIndex) const
+{
+    if (platformIndex != 0)
+    {
+        throw std::runtime_error(std::string("Invalid platform index: ") + std::to_string(platformIndex));
+    }
+    return std::vector<DeviceInfo>{getCurrentDeviceInfo()};
+}
+
+DeviceInfo ReplayEngine::getCurrentDeviceInfo() const
+{
+    DeviceInfo result(0, "Replay device");
+    result.setMaxWorkGroupSize(std::numeric_limits<size_t>::max());
+    return result;
+}
+
+bool ReplayEngine::isProgramCached(const std::string& source) const
+{
+    return compiledSources.find(source) != compiledSources.end();
+}
+
+std::vector<std::string> ReplayEngine::getParameterNames() const
+{
+    return parameterNames;
+}
+
+std::vector<std::vector<size_t>> ReplayEngine::getRecordedConfigurations() const
+{
+    std::vector<std::vector<size_t>> result;
+    for (const auto& recordedDuration : recordedDurations)
+    {
+        result.push_back(recordedDuration.first);
+    }
+    return result;
+}
+
+uint64_t ReplayEngine::getRecordedDuration(const std::vector<size_t>& parameterValues) const
+{
+    auto durationPointer = recordedDurations.find(parameterValues);
+    if (durationPointer == recordedDurations.end())
+    {
+        throw std::runtime_error("Configuration was not found in recorded results");
+    }
+    return durationPointer->second;
+}
+
+uint64_t ReplayEngine::getRecordedCompilationDuration(const std::vector<size_t>& parameterValues) const
+{
+    auto durationPointer = recordedCompilationDurations.find(parameterValues);
+    if (durationPointer == recordedCompilationDurations.end())
+    {
+        throw std::runtime_error("Configuration was not found in recorded results");
+    }
+    return durationPointer->second;
+}
+
+uint64_t ReplayEngine::getBestRecordedDuration() const
+{
+    uint64_t bestDuration = std::numeric_limits<uint64_t>::max();
+    for (const auto& recordedDuration : recordedDurations)
+    {
+        bestDuration = std::min(bestDuration, recordedDuration.second);
+    }
+    return bestDuration;
+}
+
+std::vector<size_t> ReplayEngine::getParameterValues(const std::string& source) const
+{
+    // Parameter values are retrieved from preprocessor definitions which tuner prepends to kernel source
+    std::map<std::string, size_t> definitions;
+    std::istringstream stream(source);
+    std::string line;
+
+    while (std::getline(stream, line))
+    {
+        std::istringstream lineStream(line);
+        std::string directive;
+        std::string name;
+        size_t value;
+
+        if (lineStream >> directive >> name >> value && directive == "#define")
+        {
+            definitions.insert(std::make_pair(name, value));
+        }
+    }
+
+    std::vector<size_t> result;
+    for (const auto& name : parameterNames)
+    {
+        auto definitionPointer = definitions.find(name);
+        if (definitionPointer == definitions.end())
+        {
+            throw std::runtime_error(std::string("Kernel source does not define replayed parameter: ") + name);
+        }
+        result.push_back(definitionPointer->second);
+    }
+    return result;
+}
+
+const KernelArgument& ReplayEngine::findBuffer(const ArgumentId id) const
+{
+    auto bufferPointer = buffers.find(id);
+    if (bufferPointer == buffers.end())
+    {
+        throw std::runtime_error(std::string("Buffer with following id was not found: ") + std::to_string(id));
+    }
+    return bufferPointer->second;
+}
+
+} // namespace ktt
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+#include "compute_engine/compute_engine.h"
+#include "dto/kernel_run_result.h"
+#include "dto/tuning_result.h"
+#include "kernel_argument/kernel_argument.h"
+
+namespace ktt
+{
+
+// Compute engine which does not execute kernels, kernel and compilation durations and work-group memory are instead taken from previously
+// recorded tuning results. Compilation duration is reported only for the first run of each kernel source, as if compiled programs were cached.
+class ReplayEngine : public ComputeEngine
+{
+public:
+    // Constructor
+    explicit ReplayEngine(const std::vector<TuningResult>& recordedResults);
+
+    // Kernel execution method
+    KernelRunResult runKernel(const KernelRuntimeData& kernelData, const std::vector<KernelArgument*>& argumentPointers,
+        const std::vector<ArgumentOutputDescriptor>& outputDescriptors) override;
+
+    // Utility methods
+    void setCompilerOptions(const std::string& options) override;
+    void setGlobalSizeType(const GlobalSizeType& type) override;
+    void setAutomaticGlobalSizeCorrection(const TunerFlag flag) override;
+
+    // Argument handling methods
+    void uploadArgument(KernelArgument& kernelArgument) override;
+    void updateArgument(const ArgumentId id, const void* data, const size_t dataSizeInBytes) override;
+    KernelArgument downloadArgument(const ArgumentId id) const override;
+    void downloadArgument(const ArgumentId id, void* destination) const override;
+    void downloadArgument(const ArgumentId id, void* destination, const size_t dataSizeInBytes) const override;
+    void clearBuffer(const ArgumentId id) override;
+    void clearBuffers() override;
+    void clearBuffers(const ArgumentAccessType& accessType) override;
+
+    // Information retrieval methods
+    void printComputeApiInfo(std::ostream& outputTarget) const override;
+    std::vector<PlatformInfo> getPlatformInfo() const override;
+    std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const override;
+    DeviceInfo getCurrentDeviceInfo() const override;
+    bool isProgramCached(const std::string& source) const override;
+
+    // Replay specific methods
+    std::vector<std::string> getParameterNames() const;
+    std::vector<std::vector<size_t>> getRecordedConfigurations() const;
+    uint64_t getRecordedDuration(const std::vector<size_t>& parameterValues) const;
+    uint64_t getRecordedCompilationDuration(const std::vector<size_t>& parameterValues) const;
+    uint64_t getBestRecordedDuration() const;
+
+private:
+    // Attributes
+    std::vector<std::string> parameterNames;
+    std::map<std::vector<size_t>, uint64_t> recordedDurations;
+    std::map<std::vector<size_t>, uint64_t> recordedCompilationDurations;
+    std::map<std::vector<size_t>, uint64_t> recordedWorkGroupMemory;
+    std::set<std::string> compiledSources;
+    std::map<ArgumentId, KernelArgument> buffers;
+
+    // Helper methods
+    std::vector<size_t> getParameterValues(const std::string& source) const;
+    const KernelArgument& findBuffer(const ArgumentId id) const;
+};
+
+} // namespace ktt
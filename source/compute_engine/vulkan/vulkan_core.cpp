@@ -125,6 +125,11 @@ DeviceInfo VulkanCore::getCurrentDeviceInfo() const
     return getVulkanDeviceInfo(deviceIndex);
 }
 
+bool VulkanCore::isProgramCached(const std::string&) const
+{
+    return false;
+}
+
 DeviceInfo VulkanCore::getVulkanDeviceInfo(const size_t deviceIndex) const
 {
     auto devices = getVulkanDevices();
@@ -274,6 +279,11 @@ DeviceInfo VulkanCore::getCurrentDeviceInfo() const
     throw std::runtime_error("Support for Vulkan API is not included in this version of KTT library");
 }
 
+bool VulkanCore::isProgramCached(const std::string&) const
+{
+    throw std::runtime_error("Support for Vulkan API is not included in this version of KTT library");
+}
+
 #endif // PLATFORM_VULKAN
 
 } // namespace ktt
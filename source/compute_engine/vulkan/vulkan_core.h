@@ -57,6 +57,7 @@ public:
     std::vector<PlatformInfo> getPlatformInfo() const override;
     std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const override;
     DeviceInfo getCurrentDeviceInfo() const override;
+    bool isProgramCached(const std::string& source) const override;
 
 private:
     // Attributes
@@ -107,6 +108,7 @@ public:
     std::vector<PlatformInfo> getPlatformInfo() const override;
     std::vector<DeviceInfo> getDeviceInfo(const size_t platformIndex) const override;
     DeviceInfo getCurrentDeviceInfo() const override;
+    bool isProgramCached(const std::string& source) const override;
 };
 
 #endif // PLATFORM_VULKAN
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "kernel_run_result.h"
 
 namespace ktt
@@ -6,13 +7,17 @@ namespace ktt
 KernelRunResult::KernelRunResult() :
     valid(false),
     duration(UINT64_MAX),
-    overhead(0)
+    overhead(0),
+    compilationDuration(0),
+    workGroupMemory(0)
 {}
 
 KernelRunResult::KernelRunResult(const uint64_t duration, const uint64_t overhead) :
     valid(true),
     duration(duration),
-    overhead(overhead)
+    overhead(overhead),
+    compilationDuration(0),
+    workGroupMemory(0)
 {}
 
 void KernelRunResult::increaseOverhead(const uint64_t overhead)
@@ -20,6 +25,24 @@ void KernelRunResult::increaseOverhead(const uint64_t overhead)
     this->overhead += overhead;
 }
 
+void KernelRunResult::increaseCompilationDuration(const uint64_t compilationDuration)
+{
+    this->compilationDuration += compilationDuration;
+}
+
+void KernelRunResult::increaseHardwareCounters(const std::map<std::string, uint64_t>& hardwareCounters)
+{
+    for (const auto& counter : hardwareCounters)
+    {
+        this->hardwareCounters[counter.first] += counter.second;
+    }
+}
+
+void KernelRunResult::increaseWorkGroupMemory(const uint64_t workGroupMemory)
+{
+    this->workGroupMemory = std::max(this->workGroupMemory, workGroupMemory);
+}
+
 bool KernelRunResult::isValid() const
 {
     return valid;
@@ -35,4 +58,19 @@ uint64_t KernelRunResult::getOverhead() const
     return overhead;
 }
 
+uint64_t KernelRunResult::getCompilationDuration() const
+{
+    return compilationDuration;
+}
+
+uint64_t KernelRunResult::getWorkGroupMemory() const
+{
+    return workGroupMemory;
+}
+
+const std::map<std::string, uint64_t>& KernelRunResult::getHardwareCounters() const
+{
+    return hardwareCounters;
+}
+
 } // namespace ktt
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
+#include <string>
 #include <vector>
 
 namespace ktt
@@ -13,15 +15,25 @@ public:
     explicit KernelRunResult(const uint64_t duration, const uint64_t overhead);
 
     void increaseOverhead(const uint64_t overhead);
+    void increaseCompilationDuration(const uint64_t compilationDuration);
+    void increaseHardwareCounters(const std::map<std::string, uint64_t>& hardwareCounters);
+    // Kernels of single run are launched one after another, so the largest work-group memory is kept
+    void increaseWorkGroupMemory(const uint64_t workGroupMemory);
 
     bool isValid() const;
     uint64_t getDuration() const;
     uint64_t getOverhead() const;
+    uint64_t getCompilationDuration() const;
+    uint64_t getWorkGroupMemory() const;
+    const std::map<std::string, uint64_t>& getHardwareCounters() const;
 
 private:
     bool valid;
     uint64_t duration;
     uint64_t overhead;
+    uint64_t compilationDuration;
+    uint64_t workGroupMemory;
+    std::map<std::string, uint64_t> hardwareCounters;
 };
 
 } // namespace ktt
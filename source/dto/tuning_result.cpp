@@ -1,4 +1,5 @@
 #include "tuning_result.h"
+#include "utility/ktt_utility.h"
 
 namespace ktt
 {
@@ -9,6 +10,12 @@ TuningResult::TuningResult(const std::string& kernelName, const KernelConfigurat
     kernelDuration(UINT64_MAX),
     kernelOverhead(0),
     manipulatorDuration(0),
+    compilationDuration(0),
+    maximumError(0.0),
+    workGroupMemory(0),
+    deviceId(0),
+    objectiveValue(0.0),
+    customObjective(false),
     valid(false),
     statusMessage("Ok")
 {}
@@ -19,6 +26,13 @@ TuningResult::TuningResult(const std::string& kernelName, const KernelConfigurat
     kernelDuration(kernelRunResult.getDuration()),
     kernelOverhead(kernelRunResult.getOverhead()),
     manipulatorDuration(0),
+    compilationDuration(kernelRunResult.getCompilationDuration()),
+    hardwareCounters(kernelRunResult.getHardwareCounters()),
+    maximumError(0.0),
+    workGroupMemory(kernelRunResult.getWorkGroupMemory()),
+    deviceId(0),
+    objectiveValue(0.0),
+    customObjective(false),
     valid(kernelRunResult.isValid()),
     statusMessage("Ok")
 {}
@@ -29,15 +43,32 @@ TuningResult::TuningResult(const std::string& kernelName, const KernelConfigurat
     kernelDuration(UINT64_MAX),
     kernelOverhead(0),
     manipulatorDuration(0),
+    compilationDuration(0),
+    maximumError(0.0),
+    workGroupMemory(0),
+    deviceId(0),
+    objectiveValue(0.0),
+    customObjective(false),
     valid(false),
     statusMessage(statusMessage)
 {}
 
+void TuningResult::setConfiguration(const KernelConfiguration& configuration)
+{
+    this->configuration = configuration;
+}
+
 void TuningResult::setKernelDuration(const uint64_t kernelDuration)
 {
     this->kernelDuration = kernelDuration;
 }
 
+void TuningResult::setKernelDurationSamples(const std::vector<uint64_t>& samples, const DurationStatistic& statistic)
+{
+    kernelDurationSamples = samples;
+    kernelDuration = getStatistic(samples, statistic);
+}
+
 void TuningResult::setKernelOverhead(const uint64_t kernelOverhead)
 {
     this->kernelOverhead = kernelOverhead;
@@ -48,6 +79,38 @@ void TuningResult::setManipulatorDuration(const uint64_t manipulatorDuration)
     this->manipulatorDuration = manipulatorDuration;
 }
 
+void TuningResult::setCompilationDuration(const uint64_t compilationDuration)
+{
+    this->compilationDuration = compilationDuration;
+}
+
+void TuningResult::setHardwareCounters(const std::map<std::string, uint64_t>& hardwareCounters)
+{
+    this->hardwareCounters = hardwareCounters;
+}
+
+void TuningResult::setMaximumError(const double maximumError)
+{
+    this->maximumError = maximumError;
+}
+
+void TuningResult::setWorkGroupMemory(const uint64_t workGroupMemory)
+{
+    this->workGroupMemory = workGroupMemory;
+}
+
+void TuningResult::setDevice(const size_t deviceId, const std::string& deviceName)
+{
+    this->deviceId = deviceId;
+    this->deviceName = deviceName;
+}
+
+void TuningResult::setObjectiveValue(const double objectiveValue)
+{
+    this->objectiveValue = objectiveValue;
+    customObjective = true;
+}
+
 void TuningResult::setValid(const bool flag)
 {
     this->valid = flag;
@@ -73,6 +136,43 @@ uint64_t TuningResult::getKernelDuration() const
     return kernelDuration;
 }
 
+const std::vector<uint64_t>& TuningResult::getKernelDurationSamples() const
+{
+    return kernelDurationSamples;
+}
+
+uint64_t TuningResult::getMinimumKernelDuration() const
+{
+    if (kernelDurationSamples.empty())
+    {
+        return kernelDuration;
+    }
+    return getMinimum(kernelDurationSamples);
+}
+
+uint64_t TuningResult::getMedianKernelDuration() const
+{
+    if (kernelDurationSamples.empty())
+    {
+        return kernelDuration;
+    }
+    return getMedian(kernelDurationSamples);
+}
+
+double TuningResult::getMeanKernelDuration() const
+{
+    if (kernelDurationSamples.empty())
+    {
+        return static_cast<double>(kernelDuration);
+    }
+    return getMean(kernelDurationSamples);
+}
+
+double TuningResult::getKernelDurationDeviation() const
+{
+    return getStandardDeviation(kernelDurationSamples);
+}
+
 uint64_t TuningResult::getKernelOverhead() const
 {
     return kernelOverhead;
@@ -88,6 +188,50 @@ uint64_t TuningResult::getTotalDuration() const
     return kernelDuration + manipulatorDuration;
 }
 
+uint64_t TuningResult::getCompilationDuration() const
+{
+    return compilationDuration;
+}
+
+const std::map<std::string, uint64_t>& TuningResult::getHardwareCounters() const
+{
+    return hardwareCounters;
+}
+
+double TuningResult::getMaximumError() const
+{
+    return maximumError;
+}
+
+uint64_t TuningResult::getWorkGroupMemory() const
+{
+    return workGroupMemory;
+}
+
+size_t TuningResult::getDeviceId() const
+{
+    return deviceId;
+}
+
+std::string TuningResult::getDeviceName() const
+{
+    return deviceName;
+}
+
+double TuningResult::getObjectiveValue() const
+{
+    if (customObjective)
+    {
+        return objectiveValue;
+    }
+    return static_cast<double>(getTotalDuration());
+}
+
+bool TuningResult::hasCustomObjective() const
+{
+    return customObjective;
+}
+
 bool TuningResult::isValid() const
 {
     return valid;
@@ -98,4 +242,22 @@ std::string TuningResult::getStatusMessage() const
     return statusMessage;
 }
 
+bool TuningResult::dominates(const TuningResult& other) const
+{
+    if (!valid)
+    {
+        return false;
+    }
+    if (!other.valid)
+    {
+        return true;
+    }
+
+    bool notWorse = kernelDuration <= other.kernelDuration && getObjectiveValue() <= other.getObjectiveValue()
+        && maximumError <= other.maximumError && workGroupMemory <= other.workGroupMemory;
+    bool better = kernelDuration < other.kernelDuration || getObjectiveValue() < other.getObjectiveValue()
+        || maximumError < other.maximumError || workGroupMemory < other.workGroupMemory;
+    return notWorse && better;
+}
+
 } // namespace ktt
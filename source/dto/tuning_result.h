@@ -2,42 +2,76 @@
 
 #include <cstdint>
 #include <iostream>
+#include <map>
 #include <string>
 #include <vector>
 #include "kernel_run_result.h"
+#include "ktt_platform.h"
+#include "enum/duration_statistic.h"
 #include "kernel/kernel_configuration.h"
 
 namespace ktt
 {
 
-class TuningResult
+class KTT_API TuningResult
 {
 public:
     explicit TuningResult(const std::string& kernelName, const KernelConfiguration& configuration);
     explicit TuningResult(const std::string& kernelName, const KernelConfiguration& configuration, const KernelRunResult& kernelRunResult);
     explicit TuningResult(const std::string& kernelName, const KernelConfiguration& configuration, const std::string& statusMessage);
 
+    void setConfiguration(const KernelConfiguration& configuration);
     void setKernelDuration(const uint64_t kernelDuration);
+    void setKernelDurationSamples(const std::vector<uint64_t>& samples, const DurationStatistic& statistic);
     void setKernelOverhead(const uint64_t kernelOverhead);
     void setManipulatorDuration(const uint64_t manipulatorDuration);
+    void setCompilationDuration(const uint64_t compilationDuration);
+    void setHardwareCounters(const std::map<std::string, uint64_t>& hardwareCounters);
+    void setMaximumError(const double maximumError);
+    void setWorkGroupMemory(const uint64_t workGroupMemory);
+    void setDevice(const size_t deviceId, const std::string& deviceName);
+    void setObjectiveValue(const double objectiveValue);
     void setValid(const bool flag);
     void setStatusMessage(const std::string& statusMessage);
 
     std::string getKernelName() const;
     KernelConfiguration getConfiguration() const;
     uint64_t getKernelDuration() const;
+    const std::vector<uint64_t>& getKernelDurationSamples() const;
+    uint64_t getMinimumKernelDuration() const;
+    uint64_t getMedianKernelDuration() const;
+    double getMeanKernelDuration() const;
+    double getKernelDurationDeviation() const;
     uint64_t getKernelOverhead() const;
     uint64_t getManipulatorDuration() const;
     uint64_t getTotalDuration() const;
+    uint64_t getCompilationDuration() const;
+    const std::map<std::string, uint64_t>& getHardwareCounters() const;
+    double getMaximumError() const;
+    uint64_t getWorkGroupMemory() const;
+    size_t getDeviceId() const;
+    std::string getDeviceName() const;
+    double getObjectiveValue() const;
+    bool hasCustomObjective() const;
     bool isValid() const;
     std::string getStatusMessage() const;
+    bool dominates(const TuningResult& other) const;
 
 private:
     std::string kernelName;
     KernelConfiguration configuration;
     uint64_t kernelDuration;
+    std::vector<uint64_t> kernelDurationSamples;
     uint64_t kernelOverhead;
     uint64_t manipulatorDuration;
+    uint64_t compilationDuration;
+    std::map<std::string, uint64_t> hardwareCounters;
+    double maximumError;
+    uint64_t workGroupMemory;
+    size_t deviceId;
+    std::string deviceName;
+    double objectiveValue;
+    bool customObjective;
     bool valid;
     std::string statusMessage;
 };
@@ -0,0 +1,13 @@
+#pragma once
+
+namespace ktt
+{
+
+enum class DurationStatistic
+{
+    Minimum,
+    Median,
+    Mean
+};
+
+} // namespace ktt
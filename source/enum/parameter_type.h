@@ -0,0 +1,12 @@
+#pragma once
+
+namespace ktt
+{
+
+enum class ParameterType
+{
+    Ordinal,
+    Categorical
+};
+
+} // namespace ktt
@@ -8,7 +8,13 @@ enum class SearchMethod
     FullSearch,
     RandomSearch,
     PSO,
-    Annealing
+    Annealing,
+    TransferLearning,
+    PatternSearch,
+    Portfolio,
+    Pareto,
+    CostAware,
+    ProfileGuided
 };
 
 } // namespace ktt
@@ -0,0 +1,14 @@
+#pragma once
+
+namespace ktt
+{
+
+enum class StopCriterion
+{
+    TuningDuration,
+    FailedConfigurations,
+    ConfigurationsWithoutImprovement,
+    TargetDuration
+};
+
+} // namespace ktt
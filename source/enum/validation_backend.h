@@ -0,0 +1,12 @@
+#pragma once
+
+namespace ktt
+{
+
+enum class ValidationBackend
+{
+    Host,
+    Device
+};
+
+} // namespace ktt
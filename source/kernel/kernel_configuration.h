@@ -3,6 +3,7 @@
 #include <ostream>
 #include <utility>
 #include <vector>
+#include "ktt_platform.h"
 #include "ktt_types.h"
 #include "api/dimension_vector.h"
 
@@ -11,7 +12,7 @@ namespace ktt
 
 class PSOSearcher;
 
-class KernelConfiguration
+class KTT_API KernelConfiguration
 {
 public:
     explicit KernelConfiguration(const DimensionVector& globalSize, const DimensionVector& localSize,
@@ -29,7 +30,7 @@ public:
     bool isComposite() const;
 
     friend class PSOSearcher;
-    friend std::ostream& operator<<(std::ostream&, const KernelConfiguration&);
+    KTT_API friend std::ostream& operator<<(std::ostream&, const KernelConfiguration&);
 
 private:
     DimensionVector globalSize;
@@ -40,6 +41,6 @@ private:
     bool compositeConfiguration;
 };
 
-std::ostream& operator<<(std::ostream& outputTarget, const KernelConfiguration& configuration);
+KTT_API std::ostream& operator<<(std::ostream& outputTarget, const KernelConfiguration& configuration);
 
 } // namespace ktt
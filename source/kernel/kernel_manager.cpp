@@ -218,15 +218,16 @@ std::vector<KernelConfiguration> KernelManager::getKernelCompositionConfiguratio
 }
 
 void KernelManager::addParameter(const KernelId id, const std::string& name, const std::vector<size_t>& values,
-    const ThreadModifierType& modifierType, const ThreadModifierAction& modifierAction, const Dimension& modifierDimension)
+    const ThreadModifierType& modifierType, const ThreadModifierAction& modifierAction, const Dimension& modifierDimension,
+    const ParameterType& parameterType)
 {
     if (isKernel(id))
     {
-        getKernel(id).addParameter(KernelParameter(name, values, modifierType, modifierAction, modifierDimension));
+        getKernel(id).addParameter(KernelParameter(name, values, modifierType, modifierAction, modifierDimension, parameterType));
     }
     else if (isComposition(id))
     {
-        getKernelComposition(id).addParameter(KernelParameter(name, values, modifierType, modifierAction, modifierDimension));
+        getKernelComposition(id).addParameter(KernelParameter(name, values, modifierType, modifierAction, modifierDimension, parameterType));
     }
     else
     {
@@ -286,7 +287,7 @@ void KernelManager::addCompositionKernelParameter(const KernelId compositionId,
     }
 
     getKernelComposition(kernelId).addKernelParameter(kernelId, KernelParameter(parameterName, parameterValues, modifierType, modifierAction,
-        modifierDimension));
+        modifierDimension, ParameterType::Ordinal));
 }
 
 void KernelManager::setCompositionKernelArguments(const KernelId compositionId, const KernelId kernelId, const std::vector<ArgumentId>& argumentIds)
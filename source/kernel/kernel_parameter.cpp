@@ -4,12 +4,13 @@ namespace ktt
 {
 
 KernelParameter::KernelParameter(const std::string& name, const std::vector<size_t>& values, const ThreadModifierType& modifierType,
-    const ThreadModifierAction& modifierAction, const Dimension& modifierDimension) :
+    const ThreadModifierAction& modifierAction, const Dimension& modifierDimension, const ParameterType& parameterType) :
     name(name),
     values(values),
     threadModifierType(modifierType),
     threadModifierAction(modifierAction),
-    modifierDimension(modifierDimension)
+    modifierDimension(modifierDimension),
+    parameterType(parameterType)
 {}
 
 void KernelParameter::addCompositionKernel(const KernelId id)
@@ -42,6 +43,11 @@ Dimension KernelParameter::getModifierDimension() const
     return modifierDimension;
 }
 
+ParameterType KernelParameter::getParameterType() const
+{
+    return parameterType;
+}
+
 std::vector<KernelId> KernelParameter::getCompositionKernels() const
 {
     return compositionKernels;
@@ -2,19 +2,21 @@
 
 #include <string>
 #include <vector>
+#include "ktt_platform.h"
 #include "ktt_types.h"
 #include "enum/dimension.h"
+#include "enum/parameter_type.h"
 #include "enum/thread_modifier_action.h"
 #include "enum/thread_modifier_type.h"
 
 namespace ktt
 {
 
-class KernelParameter
+class KTT_API KernelParameter
 {
 public:
     explicit KernelParameter(const std::string& name, const std::vector<size_t>& values, const ThreadModifierType& modifierType,
-        const ThreadModifierAction& modifierAction, const Dimension& modifierDimension);
+        const ThreadModifierAction& modifierAction, const Dimension& modifierDimension, const ParameterType& parameterType);
 
     void addCompositionKernel(const KernelId id);
 
@@ -23,6 +25,7 @@ public:
     ThreadModifierType getModifierType() const;
     ThreadModifierAction getModifierAction() const;
     Dimension getModifierDimension() const;
+    ParameterType getParameterType() const;
     std::vector<KernelId> getCompositionKernels() const;
 
     bool operator==(const KernelParameter& other) const;
@@ -34,6 +37,7 @@ private:
     ThreadModifierType threadModifierType;
     ThreadModifierAction threadModifierAction;
     Dimension modifierDimension;
+    ParameterType parameterType;
     std::vector<KernelId> compositionKernels;
 };
 
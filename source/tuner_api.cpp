@@ -56,7 +56,23 @@ void Tuner::addParameter(const KernelId id, const std::string& parameterName, co
 {
     try
     {
-        tunerCore->addParameter(id, parameterName, parameterValues, ThreadModifierType::None, ThreadModifierAction::Multiply, Dimension::X);
+        tunerCore->addParameter(id, parameterName, parameterValues, ThreadModifierType::None, ThreadModifierAction::Multiply, Dimension::X,
+            ParameterType::Ordinal);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::addParameter(const KernelId id, const std::string& parameterName, const std::vector<size_t>& parameterValues,
+    const ParameterType& parameterType)
+{
+    try
+    {
+        tunerCore->addParameter(id, parameterName, parameterValues, ThreadModifierType::None, ThreadModifierAction::Multiply, Dimension::X,
+            parameterType);
     }
     catch (const std::runtime_error& error)
     {
@@ -70,7 +86,7 @@ void Tuner::addParameter(const KernelId id, const std::string& parameterName, co
 {
     try
     {
-        tunerCore->addParameter(id, parameterName, parameterValues, modifierType, modifierAction, modifierDimension);
+        tunerCore->addParameter(id, parameterName, parameterValues, modifierType, modifierAction, modifierDimension, ParameterType::Ordinal);
     }
     catch (const std::runtime_error& error)
     {
@@ -162,6 +178,46 @@ void Tuner::tuneKernel(const KernelId id)
     }
 }
 
+void Tuner::resumeTuning(const KernelId id, const std::string& checkpointPath)
+{
+    try
+    {
+        tunerCore->resumeTuning(id, checkpointPath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::tuneKernels(const std::vector<KernelId>& ids)
+{
+    try
+    {
+        tunerCore->tuneKernels(ids);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::tuneKernelForInputs(const KernelId id, const std::vector<std::vector<size_t>>& inputFeatures,
+    const std::function<void(const std::vector<size_t>&)>& inputSetter)
+{
+    try
+    {
+        tunerCore->tuneKernelForInputs(id, inputFeatures, inputSetter);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
 void Tuner::runKernel(const KernelId id, const std::vector<ParameterPair>& configuration, const std::vector<ArgumentOutputDescriptor>& output)
 {
     try
@@ -188,6 +244,284 @@ void Tuner::setSearchMethod(const SearchMethod& method, const std::vector<double
     }
 }
 
+void Tuner::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+{
+    try
+    {
+        tunerCore->setSearcher(id, std::move(searcher));
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setTuningObjective(const KernelId id, const std::function<double(const TuningResult&)>& objective)
+{
+    try
+    {
+        tunerCore->setTuningObjective(id, objective);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setStopCondition(const StopCriterion& criterion, const double value)
+{
+    try
+    {
+        tunerCore->setStopCondition(criterion, value);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::clearStopConditions()
+{
+    tunerCore->clearStopConditions();
+}
+
+std::string Tuner::getTuningStopReason(const KernelId id) const
+{
+    try
+    {
+        return tunerCore->getTuningStopReason(id);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setPriorResults(const KernelId id, const std::string& filePath)
+{
+    try
+    {
+        tunerCore->setPriorResults(id, filePath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setMeasurementRepetitions(const size_t warmUpRuns, const size_t repetitions)
+{
+    try
+    {
+        tunerCore->setMeasurementRepetitions(warmUpRuns, repetitions);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setDurationStatistic(const DurationStatistic& statistic)
+{
+    try
+    {
+        tunerCore->setDurationStatistic(statistic);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setProcessIsolation(const TunerFlag flag, const double timeout)
+{
+    try
+    {
+        tunerCore->setProcessIsolation(flag, timeout);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setProcessIsolationArguments(const std::vector<std::string>& arguments)
+{
+    try
+    {
+        tunerCore->setProcessIsolationArguments(arguments);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setAsynchronousValidation(const TunerFlag flag)
+{
+    try
+    {
+        tunerCore->setAsynchronousValidation(flag);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setTuningDevices(const std::vector<size_t>& deviceIndices)
+{
+    try
+    {
+        tunerCore->setTuningDevices(deviceIndices);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setTuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize)
+{
+    try
+    {
+        tunerCore->setTuningCoordinator(bindAddress, port, batchSize);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::runTuningWorker(const KernelId id, const std::string& coordinatorHost, const uint16_t port)
+{
+    try
+    {
+        tunerCore->runTuningWorker(id, coordinatorHost, port);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setResultDatabase(const std::string& filePath)
+{
+    try
+    {
+        tunerCore->setResultDatabase(filePath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setInputSignature(const KernelId id, const std::string& signature)
+{
+    try
+    {
+        tunerCore->setInputSignature(id, signature);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setOnlineTuning(const KernelId id, const TunerFlag flag, const double explorationProbability, const double maximumSlowdown)
+{
+    try
+    {
+        tunerCore->setOnlineTuning(id, flag, explorationProbability, maximumSlowdown);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setTuningPriority(const KernelId id, const double priority)
+{
+    try
+    {
+        tunerCore->setTuningPriority(id, priority);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setTuningBudget(const KernelId id, const double tuningTime, const size_t configurationCount)
+{
+    try
+    {
+        tunerCore->setTuningBudget(id, tuningTime, configurationCount);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setFinalReranking(const size_t candidateCount, const size_t rounds)
+{
+    try
+    {
+        tunerCore->setFinalReranking(candidateCount, rounds);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::setCheckpointFile(const KernelId id, const std::string& filePath)
+{
+    try
+    {
+        tunerCore->setCheckpointFile(id, filePath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+bool Tuner::isBestResultDistinguishable(const KernelId id) const
+{
+    try
+    {
+        return tunerCore->isBestResultDistinguishable(id);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
 void Tuner::setPrintingTimeUnit(const TimeUnit& unit)
 {
     tunerCore->setPrintingTimeUnit(unit);
@@ -235,6 +569,45 @@ std::vector<ParameterPair> Tuner::getBestConfiguration(const KernelId id) const
     }
 }
 
+std::vector<ParameterPair> Tuner::getConfigurationForInput(const KernelId id, const std::vector<size_t>& inputFeatures) const
+{
+    try
+    {
+        return tunerCore->getConfigurationForInput(id, inputFeatures);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::saveDecisionTree(const KernelId id, const std::string& filePath) const
+{
+    try
+    {
+        tunerCore->saveDecisionTree(id, filePath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
+void Tuner::loadDecisionTree(const KernelId id, const std::string& filePath)
+{
+    try
+    {
+        tunerCore->loadDecisionTree(id, filePath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+        throw;
+    }
+}
+
 void Tuner::setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
     const std::vector<ArgumentId>& validatedArgumentIds)
 {
@@ -260,6 +633,23 @@ void Tuner::setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass>
     }
 }
 
+void Tuner::setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath)
+{
+    try
+    {
+        tunerCore->setReferenceFile(id, argumentId, filePath);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+    }
+}
+
+void Tuner::setReferenceCache(const std::string& directoryPath)
+{
+    tunerCore->setReferenceCache(directoryPath);
+}
+
 void Tuner::setValidationMethod(const ValidationMethod& method, const double toleranceThreshold)
 {
     try
@@ -284,6 +674,18 @@ void Tuner::setValidationRange(const ArgumentId id, const size_t range)
     }
 }
 
+void Tuner::setValidationBackend(const ArgumentId id, const ValidationBackend& backend)
+{
+    try
+    {
+        tunerCore->setValidationBackend(id, backend);
+    }
+    catch (const std::runtime_error& error)
+    {
+        tunerCore->log(error.what());
+    }
+}
+
 void Tuner::setCompilerOptions(const std::string& options)
 {
     tunerCore->setCompilerOptions(options);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <iostream>
 #include <memory>
@@ -19,13 +20,17 @@
 #include "enum/argument_memory_location.h"
 #include "enum/compute_api.h"
 #include "enum/dimension.h"
+#include "enum/duration_statistic.h"
 #include "enum/global_size_type.h"
+#include "enum/parameter_type.h"
 #include "enum/print_format.h"
 #include "enum/run_mode.h"
 #include "enum/time_unit.h"
 #include "enum/search_method.h"
+#include "enum/stop_criterion.h"
 #include "enum/thread_modifier_action.h"
 #include "enum/thread_modifier_type.h"
+#include "enum/validation_backend.h"
 #include "enum/validation_method.h"
 
 // Data holders
@@ -37,6 +42,9 @@
 // Reference class interface
 #include "api/reference_class.h"
 
+// Searcher interface
+#include "api/searcher.h"
+
 // Tuning manipulator interface
 #include "api/tuning_manipulator.h"
 
@@ -65,6 +73,8 @@ public:
         const DimensionVector& localSize);
     void setKernelArguments(const KernelId id, const std::vector<ArgumentId>& argumentIds);
     void addParameter(const KernelId id, const std::string& parameterName, const std::vector<size_t>& parameterValues);
+    void addParameter(const KernelId id, const std::string& parameterName, const std::vector<size_t>& parameterValues,
+        const ParameterType& parameterType);
 
     // Advanced kernel handling methods
     void addParameter(const KernelId id, const std::string& parameterName, const std::vector<size_t>& parameterValues,
@@ -106,8 +116,34 @@ public:
 
     // Kernel launch and tuning methods
     void tuneKernel(const KernelId id);
+    void resumeTuning(const KernelId id, const std::string& checkpointPath);
+    void tuneKernels(const std::vector<KernelId>& ids);
+    void tuneKernelForInputs(const KernelId id, const std::vector<std::vector<size_t>>& inputFeatures,
+        const std::function<void(const std::vector<size_t>&)>& inputSetter);
     void runKernel(const KernelId id, const std::vector<ParameterPair>& configuration, const std::vector<ArgumentOutputDescriptor>& output);
     void setSearchMethod(const SearchMethod& method, const std::vector<double>& arguments);
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void setTuningObjective(const KernelId id, const std::function<double(const TuningResult&)>& objective);
+    void setStopCondition(const StopCriterion& criterion, const double value);
+    void clearStopConditions();
+    std::string getTuningStopReason(const KernelId id) const;
+    void setPriorResults(const KernelId id, const std::string& filePath);
+    void setMeasurementRepetitions(const size_t warmUpRuns, const size_t repetitions);
+    void setDurationStatistic(const DurationStatistic& statistic);
+    void setProcessIsolation(const TunerFlag flag, const double timeout);
+    void setProcessIsolationArguments(const std::vector<std::string>& arguments);
+    void setAsynchronousValidation(const TunerFlag flag);
+    void setTuningDevices(const std::vector<size_t>& deviceIndices);
+    void setTuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize);
+    void runTuningWorker(const KernelId id, const std::string& coordinatorHost, const uint16_t port);
+    void setResultDatabase(const std::string& filePath);
+    void setInputSignature(const KernelId id, const std::string& signature);
+    void setOnlineTuning(const KernelId id, const TunerFlag flag, const double explorationProbability, const double maximumSlowdown);
+    void setTuningPriority(const KernelId id, const double priority);
+    void setTuningBudget(const KernelId id, const double tuningTime, const size_t configurationCount);
+    void setFinalReranking(const size_t candidateCount, const size_t rounds);
+    void setCheckpointFile(const KernelId id, const std::string& filePath);
+    bool isBestResultDistinguishable(const KernelId id) const;
 
     // Result retrieval methods
     void setPrintingTimeUnit(const TimeUnit& unit);
@@ -115,13 +151,19 @@ public:
     void printResult(const KernelId id, std::ostream& outputTarget, const PrintFormat& format) const;
     void printResult(const KernelId id, const std::string& filePath, const PrintFormat& format) const;
     std::vector<ParameterPair> getBestConfiguration(const KernelId id) const;
+    std::vector<ParameterPair> getConfigurationForInput(const KernelId id, const std::vector<size_t>& inputFeatures) const;
+    void saveDecisionTree(const KernelId id, const std::string& filePath) const;
+    void loadDecisionTree(const KernelId id, const std::string& filePath);
 
     // Result validation methods
     void setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
         const std::vector<ArgumentId>& validatedArgumentIds);
     void setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass, const std::vector<ArgumentId>& validatedArgumentIds);
+    void setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath);
+    void setReferenceCache(const std::string& directoryPath);
     void setValidationMethod(const ValidationMethod& method, const double toleranceThreshold);
     void setValidationRange(const ArgumentId id, const size_t range);
+    void setValidationBackend(const ArgumentId id, const ValidationBackend& backend);
 
     // Compute API methods
     void setCompilerOptions(const std::string& options);
@@ -2,14 +2,23 @@
 #include "compute_engine/cuda/cuda_core.h"
 #include "compute_engine/opencl/opencl_core.h"
 #include "compute_engine/vulkan/vulkan_core.h"
+#include "tuning_runner/worker_process.h"
 #include "utility/ktt_utility.h"
+#include "utility/result_loader.h"
 
 namespace ktt
 {
 
 TunerCore::TunerCore(const size_t platformIndex, const size_t deviceIndex, const ComputeApi& computeApi, const RunMode& runMode) :
     argumentManager(std::make_unique<ArgumentManager>(runMode)),
-    kernelManager(std::make_unique<KernelManager>())
+    kernelManager(std::make_unique<KernelManager>()),
+    platformIndex(platformIndex),
+    deviceIndex(deviceIndex),
+    computeApi(computeApi),
+    runMode(runMode),
+    compilerOptions(""),
+    globalSizeType(GlobalSizeType::Opencl),
+    globalSizeCorrection(false)
 {
     if (computeApi == ComputeApi::Opencl)
     {
@@ -54,9 +63,10 @@ KernelId TunerCore::addComposition(const std::string& compositionName, const std
 }
 
 void TunerCore::addParameter(const KernelId id, const std::string& parameterName, const std::vector<size_t>& parameterValues,
-    const ThreadModifierType& modifierType, const ThreadModifierAction& modifierAction, const Dimension& modifierDimension)
+    const ThreadModifierType& modifierType, const ThreadModifierAction& modifierAction, const Dimension& modifierDimension,
+    const ParameterType& parameterType)
 {
-    kernelManager->addParameter(id, parameterName, parameterValues, modifierType, modifierAction, modifierDimension);
+    kernelManager->addParameter(id, parameterName, parameterValues, modifierType, modifierAction, modifierDimension, parameterType);
 }
 
 void TunerCore::addConstraint(const KernelId id, const std::function<bool(std::vector<size_t>)>& constraintFunction,
@@ -129,6 +139,165 @@ void TunerCore::tuneKernel(const KernelId id)
     resultPrinter.setResult(id, results);
 }
 
+void TunerCore::resumeTuning(const KernelId id, const std::string& checkpointPath)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    tuningRunner->setCheckpointFile(id, checkpointPath);
+    std::vector<TuningResult> results;
+    if (kernelManager->isComposition(id))
+    {
+        results = tuningRunner->tuneKernelComposition(id, true);
+    }
+    else
+    {
+        results = tuningRunner->tuneKernel(id, true);
+    }
+    resultPrinter.setResult(id, results);
+}
+
+void TunerCore::tuneKernels(const std::vector<KernelId>& ids)
+{
+    std::vector<KernelId> kernelIds;
+    std::vector<KernelId> compositionIds;
+    for (const auto id : ids)
+    {
+        if (kernelManager->isComposition(id))
+        {
+            compositionIds.push_back(id);
+        }
+        else
+        {
+            kernelIds.push_back(id);
+        }
+    }
+
+    std::vector<std::vector<TuningResult>> results = tuningRunner->tuneKernels(kernelIds);
+    for (size_t i = 0; i < kernelIds.size(); i++)
+    {
+        resultPrinter.setResult(kernelIds.at(i), results.at(i));
+    }
+
+    // Configurations of kernel compositions are not interleaved, compositions are tuned one by one after the kernels
+    for (const auto id : compositionIds)
+    {
+        tuneKernel(id);
+    }
+}
+
+void TunerCore::tuneKernelForInputs(const KernelId id, const std::vector<std::vector<size_t>>& inputFeatures,
+    const std::function<void(const std::vector<size_t>&)>& inputSetter)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    if (inputFeatures.empty())
+    {
+        throw std::runtime_error(std::string("No inputs specified for tuning of kernel with id: ") + std::to_string(id));
+    }
+
+    const std::string signature = tuningRunner->getInputSignature(id);
+    DecisionTree tree;
+
+    try
+    {
+        for (const auto& features : inputFeatures)
+        {
+            std::string featureString;
+            for (const auto feature : features)
+            {
+                featureString += (featureString.empty() ? "" : ",") + std::to_string(feature);
+            }
+            logger.log(std::string("Tuning kernel with id ") + std::to_string(id) + " for input features: " + featureString);
+
+            // Results of each input are stored separately in results database
+            inputSetter(features);
+            tuningRunner->setInputSignature(id, signature + (signature.empty() ? "" : " ") + "input " + featureString);
+            std::vector<TuningResult> results;
+            if (kernelManager->isComposition(id))
+            {
+                results = tuningRunner->tuneKernelComposition(id);
+            }
+            else
+            {
+                results = tuningRunner->tuneKernel(id);
+            }
+            resultPrinter.setResult(id, results);
+
+            bool found = false;
+            TuningResult bestResult("", KernelConfiguration(DimensionVector(), DimensionVector(), std::vector<ParameterPair>{}));
+            for (const auto& result : results)
+            {
+                if (result.isValid() && (!found || result.getObjectiveValue() < bestResult.getObjectiveValue()))
+                {
+                    bestResult = result;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                logger.log(std::string("No valid configuration found for input features: ") + featureString);
+                continue;
+            }
+            tree.addEntry(features, bestResult.getConfiguration().getParameterPairs());
+        }
+    }
+    catch (...)
+    {
+        // Per-input signature must not remain set, results database keys of later tuning would be wrong
+        tuningRunner->setInputSignature(id, signature);
+        throw;
+    }
+
+    tuningRunner->setInputSignature(id, signature);
+    if (WorkerProcess::isWorker())
+    {
+        return; // worker process skips tuning of calls it does not serve
+    }
+    if (tree.getEntryCount() == 0)
+    {
+        throw std::runtime_error(std::string("No valid configuration found for any input of kernel with id: ") + std::to_string(id));
+    }
+
+    logger.log(std::string("Decision tree for kernel with id ") + std::to_string(id) + " contains " + std::to_string(tree.getEntryCount())
+        + " inputs and " + std::to_string(tree.getNodeCount()) + " nodes");
+    decisionTrees[id] = tree;
+}
+
+std::vector<ParameterPair> TunerCore::getConfigurationForInput(const KernelId id, const std::vector<size_t>& inputFeatures) const
+{
+    auto treePointer = decisionTrees.find(id);
+    if (treePointer == decisionTrees.end())
+    {
+        throw std::runtime_error(std::string("No decision tree found for kernel with id: ") + std::to_string(id));
+    }
+    return treePointer->second.getConfiguration(inputFeatures);
+}
+
+void TunerCore::saveDecisionTree(const KernelId id, const std::string& filePath) const
+{
+    auto treePointer = decisionTrees.find(id);
+    if (treePointer == decisionTrees.end())
+    {
+        throw std::runtime_error(std::string("No decision tree found for kernel with id: ") + std::to_string(id));
+    }
+    treePointer->second.save(filePath);
+}
+
+void TunerCore::loadDecisionTree(const KernelId id, const std::string& filePath)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    decisionTrees[id] = DecisionTree::load(filePath);
+}
+
 void TunerCore::runKernel(const KernelId id, const std::vector<ParameterPair>& configuration, const std::vector<ArgumentOutputDescriptor>& output)
 {
     if (kernelManager->isComposition(id))
@@ -146,6 +315,189 @@ void TunerCore::setSearchMethod(const SearchMethod& method, const std::vector<do
     tuningRunner->setSearchMethod(method, arguments);
 }
 
+void TunerCore::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setSearcher(id, std::move(searcher));
+}
+
+void TunerCore::setTuningObjective(const KernelId id, const std::function<double(const TuningResult&)>& objective)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setObjective(id, objective);
+}
+
+void TunerCore::setStopCondition(const StopCriterion& criterion, const double value)
+{
+    tuningRunner->setStopCondition(criterion, value);
+}
+
+void TunerCore::clearStopConditions()
+{
+    tuningRunner->clearStopConditions();
+}
+
+std::string TunerCore::getTuningStopReason(const KernelId id) const
+{
+    return tuningRunner->getStopReason(id);
+}
+
+void TunerCore::setPriorResults(const KernelId id, const std::string& filePath)
+{
+    std::string kernelName;
+    if (kernelManager->isKernel(id))
+    {
+        kernelName = kernelManager->getKernel(id).getName();
+    }
+    else if (kernelManager->isComposition(id))
+    {
+        kernelName = kernelManager->getKernelComposition(id).getName();
+    }
+    else
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    std::vector<TuningResult> results = ResultLoader::loadResults(filePath, kernelName);
+    if (results.empty())
+    {
+        throw std::runtime_error(std::string("No results for kernel <") + kernelName + "> found in file: " + filePath);
+    }
+    tuningRunner->setPriorResults(id, results);
+    logger.log(std::string("Loaded ") + std::to_string(results.size()) + " prior results for kernel <" + kernelName + ">");
+}
+
+void TunerCore::setMeasurementRepetitions(const size_t warmUpRuns, const size_t repetitions)
+{
+    tuningRunner->setMeasurementRepetitions(warmUpRuns, repetitions);
+}
+
+void TunerCore::setDurationStatistic(const DurationStatistic& statistic)
+{
+    tuningRunner->setDurationStatistic(statistic);
+}
+
+void TunerCore::setProcessIsolation(const TunerFlag flag, const double timeout)
+{
+    tuningRunner->setProcessIsolation(flag, timeout);
+}
+
+void TunerCore::setProcessIsolationArguments(const std::vector<std::string>& arguments)
+{
+    tuningRunner->setProcessIsolationArguments(arguments);
+}
+
+void TunerCore::setAsynchronousValidation(const TunerFlag flag)
+{
+    tuningRunner->setAsynchronousValidation(flag);
+}
+
+void TunerCore::setTuningDevices(const std::vector<size_t>& deviceIndices)
+{
+    if (computeApi != ComputeApi::Opencl)
+    {
+        throw std::runtime_error("Tuning on multiple devices is supported only for OpenCL API");
+    }
+    if (!containsUnique(deviceIndices))
+    {
+        throw std::runtime_error("Tuning device indices must be unique");
+    }
+
+    // Each additional device gets its own context, command queue and copies of kernel arguments
+    std::vector<std::unique_ptr<ComputeEngine>> engines;
+    std::vector<ComputeEngine*> enginePointers;
+    for (const auto index : deviceIndices)
+    {
+        if (index == deviceIndex)
+        {
+            continue;
+        }
+
+        auto engine = std::make_unique<OpenclCore>(platformIndex, index, runMode);
+        engine->setCompilerOptions(compilerOptions);
+        engine->setGlobalSizeType(globalSizeType);
+        engine->setAutomaticGlobalSizeCorrection(globalSizeCorrection);
+        logger.log(std::string("Adding tuning device: ") + engine->getCurrentDeviceInfo().getName());
+        enginePointers.push_back(engine.get());
+        engines.push_back(std::move(engine));
+    }
+
+    tuningRunner->setParallelEngines(enginePointers);
+    parallelEngines = std::move(engines);
+}
+
+void TunerCore::setTuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize)
+{
+    tuningRunner->setTuningCoordinator(bindAddress, port, batchSize);
+}
+
+void TunerCore::runTuningWorker(const KernelId id, const std::string& coordinatorHost, const uint16_t port)
+{
+    tuningRunner->runTuningWorker(id, coordinatorHost, port);
+}
+
+void TunerCore::setResultDatabase(const std::string& filePath)
+{
+    tuningRunner->setResultDatabase(filePath);
+}
+
+void TunerCore::setInputSignature(const KernelId id, const std::string& signature)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setInputSignature(id, signature);
+}
+
+void TunerCore::setOnlineTuning(const KernelId id, const TunerFlag flag, const double explorationProbability, const double maximumSlowdown)
+{
+    tuningRunner->setOnlineTuning(id, flag, explorationProbability, maximumSlowdown);
+}
+
+void TunerCore::setTuningPriority(const KernelId id, const double priority)
+{
+    if (!kernelManager->isKernel(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setTuningPriority(id, priority);
+}
+
+void TunerCore::setTuningBudget(const KernelId id, const double tuningTime, const size_t configurationCount)
+{
+    if (!kernelManager->isKernel(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setTuningBudget(id, tuningTime, configurationCount);
+}
+
+void TunerCore::setFinalReranking(const size_t candidateCount, const size_t rounds)
+{
+    tuningRunner->setFinalReranking(candidateCount, rounds);
+}
+
+void TunerCore::setCheckpointFile(const KernelId id, const std::string& filePath)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setCheckpointFile(id, filePath);
+}
+
+bool TunerCore::isBestResultDistinguishable(const KernelId id) const
+{
+    return tuningRunner->isBestResultDistinguishable(id);
+}
+
 void TunerCore::setValidationMethod(const ValidationMethod& method, const double toleranceThreshold)
 {
     tuningRunner->setValidationMethod(method, toleranceThreshold);
@@ -164,6 +516,15 @@ void TunerCore::setValidationRange(const ArgumentId id, const size_t range)
     tuningRunner->setValidationRange(id, range);
 }
 
+void TunerCore::setValidationBackend(const ArgumentId id, const ValidationBackend& backend)
+{
+    if (id >= argumentManager->getArgumentCount())
+    {
+        throw std::runtime_error(std::string("Invalid argument id: ") + std::to_string(id));
+    }
+    tuningRunner->setValidationBackend(id, backend);
+}
+
 void TunerCore::setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
     const std::vector<ArgumentId>& validatedArgumentIds)
 {
@@ -188,6 +549,20 @@ void TunerCore::setReferenceClass(const KernelId id, std::unique_ptr<ReferenceCl
     tuningRunner->setReferenceClass(id, std::move(referenceClass), validatedArgumentIds);
 }
 
+void TunerCore::setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath)
+{
+    if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    tuningRunner->setReferenceFile(id, argumentId, filePath);
+}
+
+void TunerCore::setReferenceCache(const std::string& directoryPath)
+{
+    tuningRunner->setReferenceCache(directoryPath);
+}
+
 void TunerCore::setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator)
 {
     if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
@@ -219,6 +594,12 @@ void TunerCore::printResult(const KernelId id, std::ostream& outputTarget, const
 
 void TunerCore::printResult(const KernelId id, const std::string& filePath, const PrintFormat& format) const
 {
+    // Worker process has no results to print, it must not overwrite the file written by tuning process
+    if (WorkerProcess::isWorker())
+    {
+        return;
+    }
+
     std::ofstream outputFile(filePath);
 
     if (!outputFile.is_open())
@@ -231,22 +612,46 @@ void TunerCore::printResult(const KernelId id, const std::string& filePath, cons
 
 std::vector<ParameterPair> TunerCore::getBestConfiguration(const KernelId id) const
 {
+    // Results database answers for kernels which were not tuned by this tuner, eg. in computation mode
+    if (!resultPrinter.hasResult(id) && tuningRunner->hasResultDatabase())
+    {
+        if (!kernelManager->isKernel(id) && !kernelManager->isComposition(id))
+        {
+            throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+        }
+        return tuningRunner->getStoredBestConfiguration(id);
+    }
     return resultPrinter.getBestConfiguration(id);
 }
 
 void TunerCore::setCompilerOptions(const std::string& options)
 {
     computeEngine->setCompilerOptions(options);
+    compilerOptions = options;
+    for (const auto& engine : parallelEngines)
+    {
+        engine->setCompilerOptions(options);
+    }
 }
 
 void TunerCore::setGlobalSizeType(const GlobalSizeType& type)
 {
     computeEngine->setGlobalSizeType(type);
+    globalSizeType = type;
+    for (const auto& engine : parallelEngines)
+    {
+        engine->setGlobalSizeType(type);
+    }
 }
 
 void TunerCore::setAutomaticGlobalSizeCorrection(const TunerFlag flag)
 {
     computeEngine->setAutomaticGlobalSizeCorrection(flag);
+    globalSizeCorrection = flag;
+    for (const auto& engine : parallelEngines)
+    {
+        engine->setAutomaticGlobalSizeCorrection(flag);
+    }
 }
 
 void TunerCore::printComputeApiInfo(std::ostream& outputTarget) const
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <fstream>
+#include <map>
 #include <memory>
 #include <vector>
 #include "compute_engine/compute_engine.h"
@@ -9,6 +10,7 @@
 #include "kernel/kernel_manager.h"
 #include "kernel_argument/argument_manager.h"
 #include "tuning_runner/tuning_runner.h"
+#include "utility/decision_tree.h"
 #include "utility/logger.h"
 #include "utility/result_printer.h"
 
@@ -28,7 +30,8 @@ public:
     KernelId addComposition(const std::string& compositionName, const std::vector<KernelId>& kernelIds,
         std::unique_ptr<TuningManipulator> manipulator);
     void addParameter(const KernelId id, const std::string& parameterName, const std::vector<size_t>& parameterValues,
-        const ThreadModifierType& modifierType, const ThreadModifierAction& modifierAction, const Dimension& modifierDimension);
+        const ThreadModifierType& modifierType, const ThreadModifierAction& modifierAction, const Dimension& modifierDimension,
+        const ParameterType& parameterType);
     void addConstraint(const KernelId id, const std::function<bool(std::vector<size_t>)>& constraintFunction,
         const std::vector<std::string>& parameterNames);
     void setKernelArguments(const KernelId id, const std::vector<ArgumentId>& argumentIds);
@@ -43,13 +46,45 @@ public:
 
     // Tuning runner methods
     void tuneKernel(const KernelId id);
+    void resumeTuning(const KernelId id, const std::string& checkpointPath);
+    void tuneKernels(const std::vector<KernelId>& ids);
+    void tuneKernelForInputs(const KernelId id, const std::vector<std::vector<size_t>>& inputFeatures,
+        const std::function<void(const std::vector<size_t>&)>& inputSetter);
+    std::vector<ParameterPair> getConfigurationForInput(const KernelId id, const std::vector<size_t>& inputFeatures) const;
+    void saveDecisionTree(const KernelId id, const std::string& filePath) const;
+    void loadDecisionTree(const KernelId id, const std::string& filePath);
     void runKernel(const KernelId id, const std::vector<ParameterPair>& configuration, const std::vector<ArgumentOutputDescriptor>& output);
     void setSearchMethod(const SearchMethod& method, const std::vector<double>& arguments);
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void setTuningObjective(const KernelId id, const std::function<double(const TuningResult&)>& objective);
+    void setStopCondition(const StopCriterion& criterion, const double value);
+    void clearStopConditions();
+    std::string getTuningStopReason(const KernelId id) const;
+    void setPriorResults(const KernelId id, const std::string& filePath);
+    void setMeasurementRepetitions(const size_t warmUpRuns, const size_t repetitions);
+    void setDurationStatistic(const DurationStatistic& statistic);
+    void setProcessIsolation(const TunerFlag flag, const double timeout);
+    void setProcessIsolationArguments(const std::vector<std::string>& arguments);
+    void setAsynchronousValidation(const TunerFlag flag);
+    void setTuningDevices(const std::vector<size_t>& deviceIndices);
+    void setTuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize);
+    void runTuningWorker(const KernelId id, const std::string& coordinatorHost, const uint16_t port);
+    void setResultDatabase(const std::string& filePath);
+    void setInputSignature(const KernelId id, const std::string& signature);
+    void setOnlineTuning(const KernelId id, const TunerFlag flag, const double explorationProbability, const double maximumSlowdown);
+    void setTuningPriority(const KernelId id, const double priority);
+    void setTuningBudget(const KernelId id, const double tuningTime, const size_t configurationCount);
+    void setFinalReranking(const size_t candidateCount, const size_t rounds);
+    void setCheckpointFile(const KernelId id, const std::string& filePath);
+    bool isBestResultDistinguishable(const KernelId id) const;
     void setValidationMethod(const ValidationMethod& method, const double toleranceThreshold);
     void setValidationRange(const ArgumentId id, const size_t range);
+    void setValidationBackend(const ArgumentId id, const ValidationBackend& backend);
     void setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
         const std::vector<ArgumentId>& validatedArgumentIds);
     void setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass, const std::vector<ArgumentId>& validatedArgumentIds);
+    void setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath);
+    void setReferenceCache(const std::string& directoryPath);
     void setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator);
 
     // Result printer methods
@@ -79,8 +114,17 @@ private:
     std::unique_ptr<KernelManager> kernelManager;
     std::unique_ptr<ComputeEngine> computeEngine;
     std::unique_ptr<TuningRunner> tuningRunner;
+    std::vector<std::unique_ptr<ComputeEngine>> parallelEngines;
     Logger logger;
     ResultPrinter resultPrinter;
+    std::map<KernelId, DecisionTree> decisionTrees;
+    size_t platformIndex;
+    size_t deviceIndex;
+    ComputeApi computeApi;
+    RunMode runMode;
+    std::string compilerOptions;
+    GlobalSizeType globalSizeType;
+    TunerFlag globalSizeCorrection;
 };
 
 } // namespace ktt
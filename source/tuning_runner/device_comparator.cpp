@@ -0,0 +1,357 @@
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+#include "device_comparator.h"
+#include "api/dimension_vector.h"
+#include "dto/kernel_runtime_data.h"
+
+namespace ktt
+{
+
+const ArgumentId DeviceComparator::summaryArgumentId = std::numeric_limits<ArgumentId>::max();
+const ArgumentId DeviceComparator::countArgumentId = std::numeric_limits<ArgumentId>::max() - 1;
+const ArgumentId DeviceComparator::toleranceArgumentId = std::numeric_limits<ArgumentId>::max() - 2;
+const ArgumentId DeviceComparator::firstReferenceArgumentId = std::numeric_limits<ArgumentId>::max() - 3;
+// Grid-stride loop in comparison kernel uses 32-bit indices
+const size_t DeviceComparator::maximumNumberOfElements = (static_cast<size_t>(1) << 31) - 1;
+
+// Number of work-items is fixed, each work-item compares multiple elements and performs only few atomic operations at the end
+static const size_t comparisonGlobalSize = 16384;
+static const size_t comparisonLocalSize = 64;
+static const size_t summarySize = 5;
+static const uint32_t noDeviceMismatch = 0xFFFFFFFF;
+
+static const std::string comparisonPrelude = R"(
+#if defined(__CUDACC__)
+#define KTT_KERNEL extern "C" __global__
+#define KTT_FUNCTION __device__
+#define KTT_GLOBAL
+#define KTT_GLOBAL_ID (blockIdx.x * blockDim.x + threadIdx.x)
+#define KTT_GLOBAL_SIZE (gridDim.x * blockDim.x)
+#define KTT_AS_FLOAT(value) __uint_as_float(value)
+#define KTT_AS_UINT(value) __float_as_uint(value)
+#define KTT_ATOMIC_ADD(pointer, value) atomicAdd(pointer, value)
+#define KTT_ATOMIC_MIN(pointer, value) atomicMin(pointer, value)
+#define KTT_ATOMIC_MAX(pointer, value) atomicMax(pointer, value)
+#define KTT_ATOMIC_CAS(pointer, expected, value) atomicCAS(pointer, expected, value)
+typedef signed char kttInt8;
+typedef unsigned char kttUint8;
+typedef short kttInt16;
+typedef unsigned short kttUint16;
+typedef int kttInt32;
+typedef unsigned int kttUint32;
+typedef long long kttInt64;
+typedef unsigned long long kttUint64;
+#else
+#define KTT_KERNEL __kernel
+#define KTT_FUNCTION
+#define KTT_GLOBAL __global
+#define KTT_GLOBAL_ID ((kttUint32)get_global_id(0))
+#define KTT_GLOBAL_SIZE ((kttUint32)get_global_size(0))
+#define KTT_AS_FLOAT(value) as_float(value)
+#define KTT_AS_UINT(value) as_uint(value)
+#define KTT_ATOMIC_ADD(pointer, value) atomic_add(pointer, value)
+#define KTT_ATOMIC_MIN(pointer, value) atomic_min(pointer, value)
+#define KTT_ATOMIC_MAX(pointer, value) atomic_max(pointer, value)
+#define KTT_ATOMIC_CAS(pointer, expected, value) atomic_cmpxchg(pointer, expected, value)
+typedef char kttInt8;
+typedef uchar kttUint8;
+typedef short kttInt16;
+typedef ushort kttUint16;
+typedef int kttInt32;
+typedef uint kttUint32;
+typedef long kttInt64;
+typedef ulong kttUint64;
+#endif
+
+KTT_FUNCTION float kttHalfToFloat(const kttUint16 value)
+{
+    const kttUint32 sign = ((kttUint32)value & 0x8000u) << 16;
+    const kttUint32 exponent = ((kttUint32)value >> 10) & 0x1Fu;
+    const kttUint32 mantissa = (kttUint32)value & 0x3FFu;
+    if (exponent == 0)
+    {
+        const float subnormal = (float)mantissa * 5.9604644775390625e-8f;
+        return sign != 0 ? -subnormal : subnormal;
+    }
+    if (exponent == 31)
+    {
+        return KTT_AS_FLOAT(sign | 0x7F800000u | (mantissa << 13));
+    }
+    return KTT_AS_FLOAT(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+KTT_FUNCTION void kttAtomicAddFloat(KTT_GLOBAL kttUint32* target, const float value)
+{
+    kttUint32 current = *target;
+    kttUint32 previous;
+    do
+    {
+        previous = current;
+        current = KTT_ATOMIC_CAS(target, previous, KTT_AS_UINT(KTT_AS_FLOAT(previous) + value));
+    }
+    while (current != previous);
+}
+)";
+
+// Placeholders: $NAME kernel name, $ELEMENT stored element type, $TOLERANCE tolerance type, $COMPARISON comparison of single element.
+// Errors are never negative, so their bit patterns can be compared as unsigned integers by atomic maximum.
+static const std::string comparisonKernel = R"(
+KTT_KERNEL void $NAME(KTT_GLOBAL const $ELEMENT* result, KTT_GLOBAL const $ELEMENT* reference, const kttUint32 count,
+    const $TOLERANCE tolerance, KTT_GLOBAL kttUint32* summary)
+{
+    kttUint32 mismatches = 0;
+    kttUint32 firstMismatch = 0xFFFFFFFFu;
+    float maximumAbsoluteError = 0.0f;
+    float maximumRelativeError = 0.0f;
+    float errorSum = 0.0f;
+
+    for (kttUint32 i = KTT_GLOBAL_ID; i < count; i += KTT_GLOBAL_SIZE)
+    {
+$COMPARISON
+    }
+
+    if (mismatches > 0)
+    {
+        KTT_ATOMIC_ADD(&summary[0], mismatches);
+        KTT_ATOMIC_MIN(&summary[1], firstMismatch);
+    }
+    KTT_ATOMIC_MAX(&summary[2], KTT_AS_UINT(maximumAbsoluteError));
+    KTT_ATOMIC_MAX(&summary[3], KTT_AS_UINT(maximumRelativeError));
+    if (errorSum != 0.0f)
+    {
+        kttAtomicAddFloat(&summary[4], errorSum);
+    }
+}
+)";
+
+static const std::string floatingComparison = R"(
+        const $COMPUTE value = $LOAD(result[i]);
+        const $COMPUTE expected = $LOAD(reference[i]);
+        const $COMPUTE error = value > expected ? value - expected : expected - value;
+        errorSum += (float)error;
+        maximumAbsoluteError = (float)error > maximumAbsoluteError ? (float)error : maximumAbsoluteError;
+        if (expected != 0)
+        {
+            const float relativeError = (float)(error / (expected < 0 ? -expected : expected));
+            maximumRelativeError = relativeError > maximumRelativeError ? relativeError : maximumRelativeError;
+        }
+        if (!(error <= tolerance))
+        {
+            firstMismatch = mismatches == 0 ? i : firstMismatch;
+            mismatches++;
+        }
+)";
+
+// Difference is computed in unsigned type and converted back to it after integer promotion, so that it cannot overflow
+static const std::string integerComparison = R"(
+        const $ELEMENT value = result[i];
+        const $ELEMENT expected = reference[i];
+        if (value != expected)
+        {
+            const float error = value > expected ? (float)($UNSIGNED)(($UNSIGNED)value - ($UNSIGNED)expected)
+                : (float)($UNSIGNED)(($UNSIGNED)expected - ($UNSIGNED)value);
+            errorSum += error;
+            maximumAbsoluteError = error > maximumAbsoluteError ? error : maximumAbsoluteError;
+            if (expected != 0)
+            {
+                const float relativeError = error / (expected < 0 ? -(float)expected : (float)expected);
+                maximumRelativeError = relativeError > maximumRelativeError ? relativeError : maximumRelativeError;
+            }
+            firstMismatch = mismatches == 0 ? i : firstMismatch;
+            mismatches++;
+        }
+)";
+
+static void replaceAll(std::string& text, const std::string& placeholder, const std::string& value)
+{
+    size_t position = text.find(placeholder);
+    while (position != std::string::npos)
+    {
+        text.replace(position, placeholder.size(), value);
+        position = text.find(placeholder, position + value.size());
+    }
+}
+
+static std::string getIntegerComparison(const std::string& elementType, const std::string& unsignedType)
+{
+    std::string comparison = integerComparison;
+    replaceAll(comparison, "$UNSIGNED", unsignedType);
+    replaceAll(comparison, "$ELEMENT", elementType);
+    return comparison;
+}
+
+static std::string getFloatingComparison(const std::string& computeType, const std::string& load)
+{
+    std::string comparison = floatingComparison;
+    replaceAll(comparison, "$COMPUTE", computeType);
+    replaceAll(comparison, "$LOAD", load);
+    return comparison;
+}
+
+static void getComparisonTypes(const ArgumentDataType& dataType, std::string& elementType, std::string& comparison)
+{
+    switch (dataType)
+    {
+    case ArgumentDataType::Char:
+        elementType = "kttInt8";
+        comparison = getIntegerComparison(elementType, "kttUint8");
+        break;
+    case ArgumentDataType::UnsignedChar:
+        elementType = "kttUint8";
+        comparison = getIntegerComparison(elementType, "kttUint8");
+        break;
+    case ArgumentDataType::Short:
+        elementType = "kttInt16";
+        comparison = getIntegerComparison(elementType, "kttUint16");
+        break;
+    case ArgumentDataType::UnsignedShort:
+        elementType = "kttUint16";
+        comparison = getIntegerComparison(elementType, "kttUint16");
+        break;
+    case ArgumentDataType::Int:
+        elementType = "kttInt32";
+        comparison = getIntegerComparison(elementType, "kttUint32");
+        break;
+    case ArgumentDataType::UnsignedInt:
+        elementType = "kttUint32";
+        comparison = getIntegerComparison(elementType, "kttUint32");
+        break;
+    case ArgumentDataType::Long:
+        elementType = "kttInt64";
+        comparison = getIntegerComparison(elementType, "kttUint64");
+        break;
+    case ArgumentDataType::UnsignedLong:
+        elementType = "kttUint64";
+        comparison = getIntegerComparison(elementType, "kttUint64");
+        break;
+    case ArgumentDataType::Half:
+        elementType = "kttUint16";
+        comparison = getFloatingComparison("float", "kttHalfToFloat");
+        break;
+    case ArgumentDataType::Float:
+        elementType = "float";
+        comparison = getFloatingComparison("float", "");
+        break;
+    case ArgumentDataType::Double:
+        elementType = "double";
+        comparison = getFloatingComparison("double", "");
+        break;
+    default:
+        throw std::runtime_error("Unsupported argument data type");
+    }
+}
+
+ComparisonSummary DeviceComparator::compare(ComputeEngine& engine, const KernelId kernelId, KernelArgument& resultArgument,
+    KernelArgument& referenceArgument, const size_t numberOfElements, const double tolerance)
+{
+    if (numberOfElements > maximumNumberOfElements)
+    {
+        throw std::runtime_error(std::string("Argument with id: ") + std::to_string(resultArgument.getId())
+            + " has too many elements to be validated on device");
+    }
+    if (resultArgument.getDataType() != referenceArgument.getDataType())
+    {
+        throw std::runtime_error(std::string("Reference argument data type mismatch for argument id: ")
+            + std::to_string(resultArgument.getId()));
+    }
+
+    const ArgumentDataType dataType = referenceArgument.getDataType();
+    const uint32_t count = static_cast<uint32_t>(numberOfElements);
+    const float singleTolerance = static_cast<float>(tolerance);
+    std::vector<uint32_t> initialSummary{0, noDeviceMismatch, 0, 0, 0};
+
+    KernelArgument countArgument(countArgumentId, &count, 1, ArgumentDataType::UnsignedInt, ArgumentMemoryLocation::Device,
+        ArgumentAccessType::ReadOnly, ArgumentUploadType::Scalar);
+    KernelArgument toleranceArgument = dataType == ArgumentDataType::Double
+        ? KernelArgument(toleranceArgumentId, &tolerance, 1, ArgumentDataType::Double, ArgumentMemoryLocation::Device,
+            ArgumentAccessType::ReadOnly, ArgumentUploadType::Scalar)
+        : KernelArgument(toleranceArgumentId, &singleTolerance, 1, ArgumentDataType::Float, ArgumentMemoryLocation::Device,
+            ArgumentAccessType::ReadOnly, ArgumentUploadType::Scalar);
+    KernelArgument summaryArgument(summaryArgumentId, initialSummary.data(), summarySize, ArgumentDataType::UnsignedInt,
+        ArgumentMemoryLocation::Device, ArgumentAccessType::ReadWrite, ArgumentUploadType::Vector);
+
+    // Summary buffer is uploaded again for every comparison, since it is modified by the kernel
+    engine.uploadArgument(summaryArgument);
+    KernelRuntimeData kernelData(kernelId, getKernelName(dataType), getKernelSource(dataType), DimensionVector(comparisonGlobalSize),
+        DimensionVector(comparisonLocalSize), std::vector<ArgumentId>{});
+    std::vector<uint32_t> deviceSummary(summarySize);
+
+    try
+    {
+        engine.runKernel(kernelData, std::vector<KernelArgument*>{&resultArgument, &referenceArgument, &countArgument, &toleranceArgument,
+            &summaryArgument}, std::vector<ArgumentOutputDescriptor>{});
+        engine.downloadArgument(summaryArgumentId, deviceSummary.data(), summarySize * sizeof(uint32_t));
+    }
+    catch (const std::runtime_error&)
+    {
+        engine.clearBuffer(summaryArgumentId);
+        throw;
+    }
+    engine.clearBuffer(summaryArgumentId);
+
+    float maximumAbsoluteError;
+    float maximumRelativeError;
+    float absoluteErrorSum;
+    std::memcpy(&maximumAbsoluteError, &deviceSummary.at(2), sizeof(float));
+    std::memcpy(&maximumRelativeError, &deviceSummary.at(3), sizeof(float));
+    std::memcpy(&absoluteErrorSum, &deviceSummary.at(4), sizeof(float));
+
+    return ComparisonSummary{deviceSummary.at(0), deviceSummary.at(1) == noDeviceMismatch ? ResultComparator::noMismatch
+        : static_cast<size_t>(deviceSummary.at(1)), maximumAbsoluteError, maximumRelativeError, absoluteErrorSum};
+}
+
+std::string DeviceComparator::getKernelName(const ArgumentDataType& dataType)
+{
+    switch (dataType)
+    {
+    case ArgumentDataType::Char:
+        return "kttCompareChar";
+    case ArgumentDataType::UnsignedChar:
+        return "kttCompareUnsignedChar";
+    case ArgumentDataType::Short:
+        return "kttCompareShort";
+    case ArgumentDataType::UnsignedShort:
+        return "kttCompareUnsignedShort";
+    case ArgumentDataType::Int:
+        return "kttCompareInt";
+    case ArgumentDataType::UnsignedInt:
+        return "kttCompareUnsignedInt";
+    case ArgumentDataType::Long:
+        return "kttCompareLong";
+    case ArgumentDataType::UnsignedLong:
+        return "kttCompareUnsignedLong";
+    case ArgumentDataType::Half:
+        return "kttCompareHalf";
+    case ArgumentDataType::Float:
+        return "kttCompareFloat";
+    case ArgumentDataType::Double:
+        return "kttCompareDouble";
+    default:
+        throw std::runtime_error("Unsupported argument data type");
+    }
+}
+
+std::string DeviceComparator::getKernelSource(const ArgumentDataType& dataType)
+{
+    std::string elementType;
+    std::string comparison;
+    getComparisonTypes(dataType, elementType, comparison);
+
+    std::string kernel = comparisonKernel;
+    replaceAll(kernel, "$NAME", getKernelName(dataType));
+    replaceAll(kernel, "$ELEMENT", elementType);
+    replaceAll(kernel, "$TOLERANCE", dataType == ArgumentDataType::Double ? "double" : "float");
+    replaceAll(kernel, "$COMPARISON", comparison);
+
+    std::string source;
+    if (dataType == ArgumentDataType::Double)
+    {
+        source += "\n#if !defined(__CUDACC__)\n#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n#endif\n";
+    }
+    return source + comparisonPrelude + kernel;
+}
+
+} // namespace ktt
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include "ktt_types.h"
+#include "compute_engine/compute_engine.h"
+#include "enum/argument_data_type.h"
+#include "kernel_argument/kernel_argument.h"
+#include "tuning_runner/result_comparator.h"
+
+namespace ktt
+{
+
+// Compares result argument with reference data on device with generated comparison kernel, so that only small summary is downloaded
+// instead of the whole result. Kernel source is written in subset of OpenCL C which also compiles as CUDA. Errors are accumulated in
+// single precision, first mismatch index is exact.
+class DeviceComparator
+{
+public:
+    // Ids of arguments created by comparator, reference data uploaded to device uses ids below these
+    static const ArgumentId summaryArgumentId;
+    static const ArgumentId countArgumentId;
+    static const ArgumentId toleranceArgumentId;
+    static const ArgumentId firstReferenceArgumentId;
+    static const size_t maximumNumberOfElements;
+
+    // Core methods
+    static ComparisonSummary compare(ComputeEngine& engine, const KernelId kernelId, KernelArgument& resultArgument,
+        KernelArgument& referenceArgument, const size_t numberOfElements, const double tolerance);
+    static std::string getKernelName(const ArgumentDataType& dataType);
+    static std::string getKernelSource(const ArgumentDataType& dataType);
+};
+
+} // namespace ktt
@@ -41,10 +41,16 @@ void ManipulatorInterfaceImplementation::runKernel(const KernelId id, const Dime
 
     KernelRunResult result = computeEngine->runKernel(kernelData, getArgumentPointers(kernelData.getArgumentIds()),
         std::vector<ArgumentOutputDescriptor>{});
-    currentResult = KernelRunResult(currentResult.getDuration() + result.getDuration(), currentResult.getOverhead());
+    KernelRunResult previousResult = currentResult;
+    currentResult = KernelRunResult(previousResult.getDuration() + result.getDuration(), previousResult.getOverhead());
+    currentResult.increaseCompilationDuration(previousResult.getCompilationDuration() + result.getCompilationDuration());
+    currentResult.increaseHardwareCounters(previousResult.getHardwareCounters());
+    currentResult.increaseHardwareCounters(result.getHardwareCounters());
+    currentResult.increaseWorkGroupMemory(previousResult.getWorkGroupMemory());
+    currentResult.increaseWorkGroupMemory(result.getWorkGroupMemory());
 
     timer.stop();
-    currentResult.increaseOverhead(timer.getElapsedTime());
+    currentResult.increaseOverhead(timer.getElapsedTime() - result.getCompilationDuration());
 }
 
 DimensionVector ManipulatorInterfaceImplementation::getCurrentGlobalSize(const KernelId id) const
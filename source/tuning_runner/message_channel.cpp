@@ -0,0 +1,184 @@
+#include <stdexcept>
+#include "message_channel.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <cstring>
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define KTT_MESSAGE_CHANNEL_SUPPORT
+#endif
+
+#if defined(KTT_MESSAGE_CHANNEL_SUPPORT) && !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace ktt
+{
+
+#ifdef KTT_MESSAGE_CHANNEL_SUPPORT
+
+MessageChannel::MessageChannel(const int descriptor) :
+    descriptor(descriptor)
+{
+#ifdef SO_NOSIGPIPE
+    int enabled = 1;
+    setsockopt(descriptor, SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+}
+
+MessageChannel::~MessageChannel()
+{
+    close(descriptor);
+}
+
+std::unique_ptr<MessageChannel> MessageChannel::connectTo(const std::string& host, const uint16_t port)
+{
+    addrinfo hints;
+    std::memset(&hints, 0, sizeof(hints));
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo* addresses = nullptr;
+    int status = getaddrinfo(host.c_str(), std::to_string(port).c_str(), &hints, &addresses);
+    if (status != 0)
+    {
+        throw std::runtime_error(std::string("Unable to resolve address of tuning coordinator ") + host + ": " + gai_strerror(status));
+    }
+
+    int descriptor = -1;
+    for (addrinfo* address = addresses; address != nullptr; address = address->ai_next)
+    {
+        descriptor = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+        if (descriptor < 0)
+        {
+            continue;
+        }
+        if (connect(descriptor, address->ai_addr, address->ai_addrlen) == 0)
+        {
+            break;
+        }
+        close(descriptor);
+        descriptor = -1;
+    }
+    freeaddrinfo(addresses);
+
+    if (descriptor < 0)
+    {
+        throw std::runtime_error(std::string("Unable to connect to tuning coordinator ") + host + ":" + std::to_string(port));
+    }
+    return std::make_unique<MessageChannel>(descriptor);
+}
+
+bool MessageChannel::sendMessage(const std::string& message)
+{
+    std::string data = message + '\n';
+    size_t sent = 0;
+
+    while (sent < data.size())
+    {
+        // Writing into connection closed by the other side must not raise SIGPIPE
+        ssize_t count = send(descriptor, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        sent += static_cast<size_t>(count);
+    }
+
+    return true;
+}
+
+bool MessageChannel::receiveMessage(std::string& message)
+{
+    while (!popMessage(message))
+    {
+        char chunk[4096];
+        ssize_t count = recv(descriptor, chunk, sizeof(chunk), 0);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        buffer.append(chunk, static_cast<size_t>(count));
+    }
+
+    return true;
+}
+
+bool MessageChannel::receiveAvailable()
+{
+    char chunk[4096];
+    ssize_t count = recv(descriptor, chunk, sizeof(chunk), MSG_DONTWAIT);
+    if (count < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK))
+    {
+        return true;
+    }
+    if (count <= 0)
+    {
+        return false;
+    }
+
+    buffer.append(chunk, static_cast<size_t>(count));
+    return true;
+}
+
+#else
+
+MessageChannel::MessageChannel(const int descriptor) :
+    descriptor(descriptor)
+{}
+
+MessageChannel::~MessageChannel()
+{}
+
+std::unique_ptr<MessageChannel> MessageChannel::connectTo(const std::string&, const uint16_t)
+{
+    throw std::runtime_error("Distributed tuning is supported only on POSIX platforms");
+}
+
+bool MessageChannel::sendMessage(const std::string&)
+{
+    return false;
+}
+
+bool MessageChannel::receiveMessage(std::string&)
+{
+    return false;
+}
+
+bool MessageChannel::receiveAvailable()
+{
+    return false;
+}
+
+#endif // KTT_MESSAGE_CHANNEL_SUPPORT
+
+bool MessageChannel::popMessage(std::string& message)
+{
+    size_t lineEnd = buffer.find('\n');
+    if (lineEnd == std::string::npos)
+    {
+        return false;
+    }
+
+    message = buffer.substr(0, lineEnd);
+    buffer.erase(0, lineEnd + 1);
+    return true;
+}
+
+int MessageChannel::getDescriptor() const
+{
+    return descriptor;
+}
+
+} // namespace ktt
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ktt
+{
+
+// Connected stream socket which transfers messages consisting of a single line of text. Used for communication between tuning
+// coordinator and tuning workers. Available only on POSIX platforms.
+class MessageChannel
+{
+public:
+    // Constructor and destructor
+    explicit MessageChannel(const int descriptor);
+    ~MessageChannel();
+    MessageChannel(const MessageChannel&) = delete;
+    MessageChannel& operator=(const MessageChannel&) = delete;
+
+    // Core methods
+    static std::unique_ptr<MessageChannel> connectTo(const std::string& host, const uint16_t port);
+    bool sendMessage(const std::string& message);
+    // Blocks until the whole message is received, returns false if the other side closed the connection
+    bool receiveMessage(std::string& message);
+    // Reads data which are already available without blocking, returns false if the other side closed the connection
+    bool receiveAvailable();
+    bool popMessage(std::string& message);
+
+    // Getters
+    int getDescriptor() const;
+
+private:
+    // Attributes
+    int descriptor;
+    std::string buffer;
+};
+
+} // namespace ktt
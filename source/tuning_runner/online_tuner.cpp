@@ -0,0 +1,160 @@
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include "online_tuner.h"
+
+namespace ktt
+{
+
+OnlineTuner::OnlineTuner(const std::vector<KernelConfiguration>& configurations, const double explorationProbability,
+    const double maximumSlowdown, const unsigned int seed) :
+    untestedConfigurations(configurations),
+    explorationProbability(explorationProbability),
+    maximumSlowdown(maximumSlowdown),
+    generator(seed),
+    productionDuration(0),
+    explorationOverhead(0)
+{
+    if (explorationProbability < 0.0 || explorationProbability > 1.0)
+    {
+        throw std::runtime_error("Exploration probability must be between 0.0 and 1.0");
+    }
+    if (maximumSlowdown < 1.0)
+    {
+        throw std::runtime_error("Maximum slowdown of online tuning must be at least 1.0");
+    }
+
+    // Configurations are explored from the back of the list
+    std::shuffle(untestedConfigurations.begin(), untestedConfigurations.end(), generator);
+}
+
+bool OnlineTuner::getExploredConfiguration(KernelConfiguration& configuration)
+{
+    while (!untestedConfigurations.empty() && isTested(untestedConfigurations.back()))
+    {
+        untestedConfigurations.pop_back();
+    }
+
+    if (untestedConfigurations.empty() || getSlowdown() > maximumSlowdown)
+    {
+        return false;
+    }
+
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+    if (distribution(generator) >= explorationProbability)
+    {
+        return false;
+    }
+
+    configuration = untestedConfigurations.back();
+    untestedConfigurations.pop_back();
+    return true;
+}
+
+bool OnlineTuner::getExploitedConfiguration(KernelConfiguration& configuration) const
+{
+    bool found = false;
+    double bestDuration = 0.0;
+
+    for (const auto& statistics : validatedConfigurations)
+    {
+        const double duration = static_cast<double>(statistics.second.totalDuration) / static_cast<double>(statistics.second.runCount);
+        if (!found || duration < bestDuration)
+        {
+            configuration = statistics.second.configuration;
+            bestDuration = duration;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+void OnlineTuner::addResult(const KernelConfiguration& configuration, const uint64_t duration, const bool valid, const bool explored)
+{
+    double bestDuration;
+    if (explored && !valid)
+    {
+        explorationOverhead += duration;
+    }
+    else if (explored && getBestAverageDuration(bestDuration) && static_cast<double>(duration) > bestDuration)
+    {
+        explorationOverhead += duration - static_cast<uint64_t>(bestDuration);
+    }
+
+    productionDuration += duration;
+    addStoredResult(configuration, duration, valid);
+}
+
+void OnlineTuner::addExplorationCost(const uint64_t duration)
+{
+    explorationOverhead += duration;
+    productionDuration += duration;
+}
+
+void OnlineTuner::addStoredResult(const KernelConfiguration& configuration, const uint64_t duration, const bool valid)
+{
+    const std::vector<ParameterPair> parameterPairs = configuration.getParameterPairs();
+    if (!valid)
+    {
+        invalidConfigurations.insert(parameterPairs);
+        return;
+    }
+
+    auto statisticsPointer = validatedConfigurations.find(parameterPairs);
+    if (statisticsPointer == validatedConfigurations.end())
+    {
+        validatedConfigurations.insert(std::make_pair(parameterPairs, ConfigurationStatistics{configuration, duration, 1}));
+        return;
+    }
+
+    statisticsPointer->second.totalDuration += duration;
+    statisticsPointer->second.runCount++;
+}
+
+size_t OnlineTuner::getUntestedConfigurationsCount() const
+{
+    return static_cast<size_t>(std::count_if(untestedConfigurations.begin(), untestedConfigurations.end(),
+        [this](const KernelConfiguration& configuration) { return !isTested(configuration); }));
+}
+
+size_t OnlineTuner::getValidatedConfigurationsCount() const
+{
+    return validatedConfigurations.size();
+}
+
+double OnlineTuner::getSlowdown() const
+{
+    if (productionDuration == 0)
+    {
+        return 1.0;
+    }
+    if (explorationOverhead >= productionDuration)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    return static_cast<double>(productionDuration) / static_cast<double>(productionDuration - explorationOverhead);
+}
+
+bool OnlineTuner::isTested(const KernelConfiguration& configuration) const
+{
+    const std::vector<ParameterPair> parameterPairs = configuration.getParameterPairs();
+    return validatedConfigurations.find(parameterPairs) != validatedConfigurations.end()
+        || invalidConfigurations.find(parameterPairs) != invalidConfigurations.end();
+}
+
+bool OnlineTuner::getBestAverageDuration(double& duration) const
+{
+    KernelConfiguration configuration(DimensionVector(), DimensionVector(), std::vector<ParameterPair>{});
+    if (!getExploitedConfiguration(configuration))
+    {
+        return false;
+    }
+
+    const ConfigurationStatistics& statistics = validatedConfigurations.find(configuration.getParameterPairs())->second;
+    duration = static_cast<double>(statistics.totalDuration) / static_cast<double>(statistics.runCount);
+    return true;
+}
+
+} // namespace ktt
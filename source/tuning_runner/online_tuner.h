@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+#include "kernel/kernel_configuration.h"
+
+namespace ktt
+{
+
+// Epsilon-greedy policy for tuning of a kernel during production runs. Validated configuration with the lowest average duration is
+// exploited, untested configuration is explored with given probability. Exploration is suspended while the time lost by exploring
+// runs would make production runs slower on average than tolerated slowdown allows.
+class OnlineTuner
+{
+public:
+    // Constructor
+    explicit OnlineTuner(const std::vector<KernelConfiguration>& configurations, const double explorationProbability,
+        const double maximumSlowdown, const unsigned int seed);
+
+    // Core methods
+    bool getExploredConfiguration(KernelConfiguration& configuration);
+    bool getExploitedConfiguration(KernelConfiguration& configuration) const;
+    // Exploring run which failed validation is charged fully to exploration, since production run has to be repeated
+    void addResult(const KernelConfiguration& configuration, const uint64_t duration, const bool valid, const bool explored);
+    // Time spent by exploring run outside of kernel, eg. on reference computation and validation, is charged fully to exploration
+    void addExplorationCost(const uint64_t duration);
+    void addStoredResult(const KernelConfiguration& configuration, const uint64_t duration, const bool valid);
+
+    // Getters
+    size_t getUntestedConfigurationsCount() const;
+    size_t getValidatedConfigurationsCount() const;
+    double getSlowdown() const;
+
+private:
+    struct ConfigurationStatistics
+    {
+        KernelConfiguration configuration;
+        uint64_t totalDuration;
+        size_t runCount;
+    };
+
+    // Attributes
+    std::vector<KernelConfiguration> untestedConfigurations;
+    std::map<std::vector<ParameterPair>, ConfigurationStatistics> validatedConfigurations;
+    std::set<std::vector<ParameterPair>> invalidConfigurations;
+    double explorationProbability;
+    double maximumSlowdown;
+    std::mt19937 generator;
+    uint64_t productionDuration;
+    uint64_t explorationOverhead;
+
+    // Helper methods
+    bool isTested(const KernelConfiguration& configuration) const;
+    bool getBestAverageDuration(double& duration) const;
+};
+
+} // namespace ktt
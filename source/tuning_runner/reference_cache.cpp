@@ -0,0 +1,180 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include "reference_cache.h"
+#include "utility/ktt_utility.h"
+#include "utility/mapped_file.h"
+
+namespace ktt
+{
+
+static const char cacheMagic[] = "KTTREF01";
+static const size_t cacheMagicSize = 8;
+
+// All fields are 8 bytes long and argument data is padded to 8 bytes, so that mapped data is suitably aligned for every type
+static size_t getPaddedSize(const size_t size)
+{
+    return (size + 7) / 8 * 8;
+}
+
+static bool readField(const char* data, const size_t size, size_t& offset, uint64_t& value)
+{
+    if (size < offset + sizeof(uint64_t))
+    {
+        return false;
+    }
+    std::memcpy(&value, data + offset, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+    return true;
+}
+
+static void writeField(std::ofstream& file, const uint64_t value)
+{
+    file.write(reinterpret_cast<const char*>(&value), sizeof(uint64_t));
+}
+
+ReferenceCache::ReferenceCache(const std::string& directoryPath) :
+    directoryPath(directoryPath)
+{
+    // Directory is checked with a probe file, so that missing directory is reported before any reference is computed
+    const std::string probePath = getFilePath("probe") + ".tmp";
+    if (!std::ofstream(probePath, std::ios::binary | std::ios::trunc).is_open())
+    {
+        throw std::runtime_error(std::string("Reference cache directory does not exist or is not writable: ") + directoryPath);
+    }
+    std::remove(probePath.c_str());
+}
+
+std::string ReferenceCache::getKey(const std::string& referenceIdentity, const std::vector<const KernelArgument*>& inputArguments,
+    const std::vector<ArgumentId>& validatedArgumentIds)
+{
+    std::string inputs;
+    for (const auto argument : inputArguments)
+    {
+        const uint64_t dataHash = argument->getData() == nullptr ? 0 : getHash(argument->getData(), argument->getDataSizeInBytes());
+        inputs += std::to_string(argument->getId()) + "," + std::to_string(static_cast<int>(argument->getDataType())) + ","
+            + std::to_string(argument->getNumberOfElements()) + "," + hashToString(dataHash) + ";";
+    }
+
+    std::string outputs;
+    for (const auto id : validatedArgumentIds)
+    {
+        outputs += std::to_string(id) + ";";
+    }
+
+    return hashToString(getHash(referenceIdentity)) + "_" + hashToString(getHash(inputs)) + "_" + hashToString(getHash(outputs));
+}
+
+bool ReferenceCache::load(const std::string& key, const std::vector<ArgumentId>& argumentIds, const ArgumentManager& argumentManager,
+    std::vector<KernelArgument>& result) const
+{
+    const std::string filePath = getFilePath(key);
+    if (!std::ifstream(filePath).good())
+    {
+        return false;
+    }
+
+    MappedFile file(filePath);
+    const char* data = static_cast<const char*>(file.getData());
+    const size_t size = file.getSize();
+    if (size < cacheMagicSize || std::memcmp(data, cacheMagic, cacheMagicSize) != 0)
+    {
+        return false;
+    }
+
+    size_t offset = cacheMagicSize;
+    uint64_t count;
+    if (!readField(data, size, offset, count) || count != argumentIds.size())
+    {
+        return false;
+    }
+
+    std::vector<KernelArgument> arguments;
+    for (size_t i = 0; i < count; i++)
+    {
+        uint64_t id;
+        uint64_t dataType;
+        uint64_t numberOfElements;
+        uint64_t byteSize;
+        if (!readField(data, size, offset, id) || !readField(data, size, offset, dataType) || !readField(data, size, offset, numberOfElements)
+            || !readField(data, size, offset, byteSize) || byteSize > size - offset || id != argumentIds.at(i))
+        {
+            return false;
+        }
+
+        // Stale or foreign file is a cache miss, header has to match the argument before any data is copied
+        const KernelArgument& argument = argumentManager.getArgument(static_cast<ArgumentId>(id));
+        const size_t elementSize = argument.getElementSizeInBytes();
+        if (dataType != static_cast<uint64_t>(argument.getDataType()) || byteSize % elementSize != 0
+            || numberOfElements != byteSize / elementSize)
+        {
+            return false;
+        }
+
+        // Data is copied into argument, validation works with owned data
+        arguments.emplace_back(static_cast<ArgumentId>(id), data + offset, static_cast<size_t>(numberOfElements), argument.getDataType(),
+            argument.getMemoryLocation(), argument.getAccessType(), argument.getUploadType());
+        offset += getPaddedSize(static_cast<size_t>(byteSize));
+    }
+
+    result = std::move(arguments);
+    return true;
+}
+
+void ReferenceCache::store(const std::string& key, const std::vector<KernelArgument>& result) const
+{
+    // File is written under temporary name first, so that partially written file is never loaded
+    const std::string filePath = getFilePath(key);
+    const std::string temporaryPath = filePath + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(std::string("Unable to open file: ") + temporaryPath);
+        }
+
+        file.write(cacheMagic, cacheMagicSize);
+        writeField(file, result.size());
+        for (const auto& argument : result)
+        {
+            const size_t byteSize = argument.getDataSizeInBytes();
+            writeField(file, argument.getId());
+            writeField(file, static_cast<uint64_t>(argument.getDataType()));
+            writeField(file, argument.getNumberOfElements());
+            writeField(file, byteSize);
+            file.write(static_cast<const char*>(argument.getData()), byteSize);
+
+            const std::vector<char> padding(getPaddedSize(byteSize) - byteSize, 0);
+            file.write(padding.data(), padding.size());
+        }
+
+        if (!file.good())
+        {
+            throw std::runtime_error(std::string("Unable to write file: ") + temporaryPath);
+        }
+    }
+
+    std::remove(filePath.c_str());
+    if (std::rename(temporaryPath.c_str(), filePath.c_str()) != 0)
+    {
+        throw std::runtime_error(std::string("Unable to write file: ") + filePath);
+    }
+}
+
+const std::string& ReferenceCache::getDirectoryPath() const
+{
+    return directoryPath;
+}
+
+std::string ReferenceCache::getFilePath(const std::string& key) const
+{
+    if (directoryPath.empty() || directoryPath.back() == '/' || directoryPath.back() == '\\')
+    {
+        return directoryPath + key + ".ktt_reference";
+    }
+    return directoryPath + "/" + key + ".ktt_reference";
+}
+
+} // namespace ktt
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "kernel_argument/argument_manager.h"
+#include "kernel_argument/kernel_argument.h"
+
+namespace ktt
+{
+
+// Stores reference results in a directory, one binary file per key. Key is composed of hashes of reference identity (reference
+// kernel source or reference class type) and contents of kernel input arguments, so that stale result is never loaded. Cached
+// files are memory-mapped when they are loaded.
+class ReferenceCache
+{
+public:
+    // Constructor
+    explicit ReferenceCache(const std::string& directoryPath);
+
+    // Core methods
+    static std::string getKey(const std::string& referenceIdentity, const std::vector<const KernelArgument*>& inputArguments,
+        const std::vector<ArgumentId>& validatedArgumentIds);
+    bool load(const std::string& key, const std::vector<ArgumentId>& argumentIds, const ArgumentManager& argumentManager,
+        std::vector<KernelArgument>& result) const;
+    void store(const std::string& key, const std::vector<KernelArgument>& result) const;
+
+    // Getters
+    const std::string& getDirectoryPath() const;
+    std::string getFilePath(const std::string& key) const;
+
+private:
+    // Attributes
+    std::string directoryPath;
+};
+
+} // namespace ktt
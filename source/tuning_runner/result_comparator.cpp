@@ -0,0 +1,397 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "result_comparator.h"
+#include "half.hpp"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define KTT_AVX2_COMPARISON
+#define KTT_AVX2_TARGET __attribute__((target("avx2,f16c")))
+#endif
+
+namespace ktt
+{
+
+using half_float::half;
+
+const size_t ResultComparator::noMismatch = std::numeric_limits<size_t>::max();
+
+// Buffers smaller than this are compared by single thread, since starting threads would take longer than the comparison
+static const size_t parallelComparisonThreshold = 1 << 22;
+static const size_t minimumThreadElements = 1 << 20;
+
+static ComparisonSummary createSummary()
+{
+    return ComparisonSummary{0, ResultComparator::noMismatch, 0.0, 0.0, 0.0};
+}
+
+static void addMismatch(ComparisonSummary& summary, const size_t index)
+{
+    if (summary.mismatchCount == 0)
+    {
+        summary.firstMismatchIndex = index;
+    }
+    summary.mismatchCount++;
+}
+
+// Half and float elements are compared in single precision, as they would be by the kernel
+template <typename T> struct ComparisonType
+{
+    using Type = double;
+};
+
+template <> struct ComparisonType<float>
+{
+    using Type = float;
+};
+
+template <> struct ComparisonType<half>
+{
+    using Type = float;
+};
+
+template <typename T> void compareFloatingScalar(const T* result, const T* reference, const size_t begin, const size_t end,
+    const double tolerance, ComparisonSummary& summary)
+{
+    using C = typename ComparisonType<T>::Type;
+
+    for (size_t i = begin; i < end; i++)
+    {
+        const C referenceValue = static_cast<C>(reference[i]);
+        const C error = std::fabs(static_cast<C>(result[i]) - referenceValue);
+        summary.absoluteErrorSum += static_cast<double>(error);
+        summary.maximumAbsoluteError = error > summary.maximumAbsoluteError ? error : summary.maximumAbsoluteError;
+
+        if (referenceValue != 0)
+        {
+            const double relativeError = static_cast<double>(error / std::fabs(referenceValue));
+            summary.maximumRelativeError = relativeError > summary.maximumRelativeError ? relativeError : summary.maximumRelativeError;
+        }
+        if (!(static_cast<double>(error) <= tolerance))
+        {
+            addMismatch(summary, i);
+        }
+    }
+}
+
+template <typename T> void compareIntegers(const T* result, const T* reference, const size_t begin, const size_t end,
+    ComparisonSummary& summary)
+{
+    for (size_t i = begin; i < end; i++)
+    {
+        if (result[i] == reference[i])
+        {
+            continue;
+        }
+
+        const double referenceValue = static_cast<double>(reference[i]);
+        const double error = std::fabs(static_cast<double>(result[i]) - referenceValue);
+        summary.absoluteErrorSum += error;
+        summary.maximumAbsoluteError = std::max(summary.maximumAbsoluteError, error);
+        if (referenceValue != 0.0)
+        {
+            summary.maximumRelativeError = std::max(summary.maximumRelativeError, error / std::fabs(referenceValue));
+        }
+        addMismatch(summary, i);
+    }
+}
+
+#ifdef KTT_AVX2_COMPARISON
+
+static bool isAvx2Supported()
+{
+    static const bool supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c");
+    return supported;
+}
+
+KTT_AVX2_TARGET static inline __m256 loadSingle(const float* data)
+{
+    return _mm256_loadu_ps(data);
+}
+
+KTT_AVX2_TARGET static inline __m256 loadSingle(const half* data)
+{
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+}
+
+KTT_AVX2_TARGET static inline double reduceMaximum(const __m256d vector)
+{
+    alignas(32) double values[4];
+    _mm256_store_pd(values, vector);
+    return std::max(std::max(values[0], values[1]), std::max(values[2], values[3]));
+}
+
+KTT_AVX2_TARGET static inline double reduceSum(const __m256d vector)
+{
+    alignas(32) double values[4];
+    _mm256_store_pd(values, vector);
+    return (values[0] + values[1]) + (values[2] + values[3]);
+}
+
+// Maximum is computed with error as the first operand, so that NaN error does not replace current maximum
+template <typename T> KTT_AVX2_TARGET size_t compareSingleAvx2(const T* result, const T* reference, const size_t begin, const size_t end,
+    const double tolerance, ComparisonSummary& summary)
+{
+    const __m256 signMask = _mm256_set1_ps(-0.0f);
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256d toleranceVector = _mm256_set1_pd(tolerance);
+    __m256 maximumAbsolute = zero;
+    __m256 maximumRelative = zero;
+    __m256d sum = _mm256_setzero_pd();
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 referenceValue = loadSingle(reference + i);
+        const __m256 absoluteReference = _mm256_andnot_ps(signMask, referenceValue);
+        const __m256 error = _mm256_andnot_ps(signMask, _mm256_sub_ps(loadSingle(result + i), referenceValue));
+        maximumAbsolute = _mm256_max_ps(error, maximumAbsolute);
+
+        const __m256 nonZero = _mm256_cmp_ps(absoluteReference, zero, _CMP_NEQ_OQ);
+        maximumRelative = _mm256_max_ps(_mm256_and_ps(_mm256_div_ps(error, absoluteReference), nonZero), maximumRelative);
+
+        const __m256d lowError = _mm256_cvtps_pd(_mm256_castps256_ps128(error));
+        const __m256d highError = _mm256_cvtps_pd(_mm256_extractf128_ps(error, 1));
+        sum = _mm256_add_pd(sum, _mm256_add_pd(lowError, highError));
+
+        const int mismatches = _mm256_movemask_pd(_mm256_cmp_pd(lowError, toleranceVector, _CMP_NLE_UQ))
+            | (_mm256_movemask_pd(_mm256_cmp_pd(highError, toleranceVector, _CMP_NLE_UQ)) << 4);
+        if (mismatches != 0)
+        {
+            if (summary.mismatchCount == 0)
+            {
+                summary.firstMismatchIndex = i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(mismatches)));
+            }
+            summary.mismatchCount += static_cast<size_t>(__builtin_popcount(static_cast<unsigned int>(mismatches)));
+        }
+    }
+
+    const __m256d lowMaximum = _mm256_cvtps_pd(_mm256_castps256_ps128(maximumAbsolute));
+    const __m256d highMaximum = _mm256_cvtps_pd(_mm256_extractf128_ps(maximumAbsolute, 1));
+    summary.maximumAbsoluteError = std::max(summary.maximumAbsoluteError, reduceMaximum(_mm256_max_pd(lowMaximum, highMaximum)));
+    const __m256d lowRelative = _mm256_cvtps_pd(_mm256_castps256_ps128(maximumRelative));
+    const __m256d highRelative = _mm256_cvtps_pd(_mm256_extractf128_ps(maximumRelative, 1));
+    summary.maximumRelativeError = std::max(summary.maximumRelativeError, reduceMaximum(_mm256_max_pd(lowRelative, highRelative)));
+    summary.absoluteErrorSum += reduceSum(sum);
+    return i;
+}
+
+KTT_AVX2_TARGET static size_t compareDoubleAvx2(const double* result, const double* reference, const size_t begin, const size_t end,
+    const double tolerance, ComparisonSummary& summary)
+{
+    const __m256d signMask = _mm256_set1_pd(-0.0);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d toleranceVector = _mm256_set1_pd(tolerance);
+    __m256d maximumAbsolute = zero;
+    __m256d maximumRelative = zero;
+    __m256d sum = zero;
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        const __m256d referenceValue = _mm256_loadu_pd(reference + i);
+        const __m256d absoluteReference = _mm256_andnot_pd(signMask, referenceValue);
+        const __m256d error = _mm256_andnot_pd(signMask, _mm256_sub_pd(_mm256_loadu_pd(result + i), referenceValue));
+        maximumAbsolute = _mm256_max_pd(error, maximumAbsolute);
+
+        const __m256d nonZero = _mm256_cmp_pd(absoluteReference, zero, _CMP_NEQ_OQ);
+        maximumRelative = _mm256_max_pd(_mm256_and_pd(_mm256_div_pd(error, absoluteReference), nonZero), maximumRelative);
+        sum = _mm256_add_pd(sum, error);
+
+        const int mismatches = _mm256_movemask_pd(_mm256_cmp_pd(error, toleranceVector, _CMP_NLE_UQ));
+        if (mismatches != 0)
+        {
+            if (summary.mismatchCount == 0)
+            {
+                summary.firstMismatchIndex = i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned int>(mismatches)));
+            }
+            summary.mismatchCount += static_cast<size_t>(__builtin_popcount(static_cast<unsigned int>(mismatches)));
+        }
+    }
+
+    summary.maximumAbsoluteError = std::max(summary.maximumAbsoluteError, reduceMaximum(maximumAbsolute));
+    summary.maximumRelativeError = std::max(summary.maximumRelativeError, reduceMaximum(maximumRelative));
+    summary.absoluteErrorSum += reduceSum(sum);
+    return i;
+}
+
+#endif // KTT_AVX2_COMPARISON
+
+template <typename T> void compareFloating(const void* result, const void* reference, const size_t begin, const size_t end,
+    const double tolerance, ComparisonSummary& summary)
+{
+    const T* typedResult = static_cast<const T*>(result);
+    const T* typedReference = static_cast<const T*>(reference);
+    size_t scalarBegin = begin;
+
+#ifdef KTT_AVX2_COMPARISON
+    if (isAvx2Supported())
+    {
+        scalarBegin = compareSingleAvx2(typedResult, typedReference, begin, end, tolerance, summary);
+    }
+#endif
+
+    compareFloatingScalar(typedResult, typedReference, scalarBegin, end, tolerance, summary);
+}
+
+template <> void compareFloating<double>(const void* result, const void* reference, const size_t begin, const size_t end,
+    const double tolerance, ComparisonSummary& summary)
+{
+    const double* typedResult = static_cast<const double*>(result);
+    const double* typedReference = static_cast<const double*>(reference);
+    size_t scalarBegin = begin;
+
+#ifdef KTT_AVX2_COMPARISON
+    if (isAvx2Supported())
+    {
+        scalarBegin = compareDoubleAvx2(typedResult, typedReference, begin, end, tolerance, summary);
+    }
+#endif
+
+    compareFloatingScalar(typedResult, typedReference, scalarBegin, end, tolerance, summary);
+}
+
+template <typename T> void compareIntegers(const void* result, const void* reference, const size_t begin, const size_t end,
+    ComparisonSummary& summary)
+{
+    compareIntegers(static_cast<const T*>(result), static_cast<const T*>(reference), begin, end, summary);
+}
+
+ComparisonSummary ResultComparator::compare(const void* result, const void* reference, const size_t numberOfElements,
+    const ArgumentDataType& dataType, const double tolerance)
+{
+    if (numberOfElements == 0)
+    {
+        return createSummary();
+    }
+    if (result == nullptr || reference == nullptr)
+    {
+        throw std::runtime_error("Compared argument data is not available");
+    }
+
+    const size_t hardwareThreads = static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u));
+    const size_t threadCount = numberOfElements < parallelComparisonThreshold ? 1
+        : std::min(hardwareThreads, numberOfElements / minimumThreadElements);
+    if (threadCount <= 1)
+    {
+        return compareRange(result, reference, 0, numberOfElements, dataType, tolerance);
+    }
+
+    // Chunk boundaries are multiples of vector width, so that only the last chunk has scalar remainder
+    const size_t chunkSize = (numberOfElements / threadCount + 7) / 8 * 8;
+    std::vector<std::future<ComparisonSummary>> chunks;
+    for (size_t begin = 0; begin < numberOfElements; begin += chunkSize)
+    {
+        const size_t end = std::min(begin + chunkSize, numberOfElements);
+        chunks.push_back(std::async(std::launch::async, [result, reference, begin, end, &dataType, tolerance]()
+        {
+            return compareRange(result, reference, begin, end, dataType, tolerance);
+        }));
+    }
+
+    ComparisonSummary summary = createSummary();
+    for (auto& chunk : chunks)
+    {
+        const ComparisonSummary chunkSummary = chunk.get();
+        if (summary.mismatchCount == 0)
+        {
+            summary.firstMismatchIndex = chunkSummary.firstMismatchIndex;
+        }
+        summary.mismatchCount += chunkSummary.mismatchCount;
+        summary.maximumAbsoluteError = std::max(summary.maximumAbsoluteError, chunkSummary.maximumAbsoluteError);
+        summary.maximumRelativeError = std::max(summary.maximumRelativeError, chunkSummary.maximumRelativeError);
+        summary.absoluteErrorSum += chunkSummary.absoluteErrorSum;
+    }
+    return summary;
+}
+
+bool ResultComparator::isFloatingPoint(const ArgumentDataType& dataType)
+{
+    return dataType == ArgumentDataType::Half || dataType == ArgumentDataType::Float || dataType == ArgumentDataType::Double;
+}
+
+double ResultComparator::getElement(const void* data, const size_t index, const ArgumentDataType& dataType)
+{
+    switch (dataType)
+    {
+    case ArgumentDataType::Char:
+        return static_cast<double>(static_cast<const int8_t*>(data)[index]);
+    case ArgumentDataType::UnsignedChar:
+        return static_cast<double>(static_cast<const uint8_t*>(data)[index]);
+    case ArgumentDataType::Short:
+        return static_cast<double>(static_cast<const int16_t*>(data)[index]);
+    case ArgumentDataType::UnsignedShort:
+        return static_cast<double>(static_cast<const uint16_t*>(data)[index]);
+    case ArgumentDataType::Int:
+        return static_cast<double>(static_cast<const int32_t*>(data)[index]);
+    case ArgumentDataType::UnsignedInt:
+        return static_cast<double>(static_cast<const uint32_t*>(data)[index]);
+    case ArgumentDataType::Long:
+        return static_cast<double>(static_cast<const int64_t*>(data)[index]);
+    case ArgumentDataType::UnsignedLong:
+        return static_cast<double>(static_cast<const uint64_t*>(data)[index]);
+    case ArgumentDataType::Half:
+        return static_cast<double>(static_cast<float>(static_cast<const half*>(data)[index]));
+    case ArgumentDataType::Float:
+        return static_cast<double>(static_cast<const float*>(data)[index]);
+    case ArgumentDataType::Double:
+        return static_cast<const double*>(data)[index];
+    default:
+        throw std::runtime_error("Unsupported argument data type");
+    }
+}
+
+ComparisonSummary ResultComparator::compareRange(const void* result, const void* reference, const size_t begin, const size_t end,
+    const ArgumentDataType& dataType, const double tolerance)
+{
+    ComparisonSummary summary = createSummary();
+
+    switch (dataType)
+    {
+    case ArgumentDataType::Char:
+        compareIntegers<int8_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::UnsignedChar:
+        compareIntegers<uint8_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::Short:
+        compareIntegers<int16_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::UnsignedShort:
+        compareIntegers<uint16_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::Int:
+        compareIntegers<int32_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::UnsignedInt:
+        compareIntegers<uint32_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::Long:
+        compareIntegers<int64_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::UnsignedLong:
+        compareIntegers<uint64_t>(result, reference, begin, end, summary);
+        break;
+    case ArgumentDataType::Half:
+        compareFloating<half>(result, reference, begin, end, tolerance, summary);
+        break;
+    case ArgumentDataType::Float:
+        compareFloating<float>(result, reference, begin, end, tolerance, summary);
+        break;
+    case ArgumentDataType::Double:
+        compareFloating<double>(result, reference, begin, end, tolerance, summary);
+        break;
+    default:
+        throw std::runtime_error("Unsupported argument data type");
+    }
+
+    return summary;
+}
+
+} // namespace ktt
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include "enum/argument_data_type.h"
+
+namespace ktt
+{
+
+// Summary of comparison between result and reference data of single argument
+struct ComparisonSummary
+{
+    size_t mismatchCount;
+    size_t firstMismatchIndex;
+    double maximumAbsoluteError;
+    double maximumRelativeError;
+    double absoluteErrorSum;
+};
+
+// Compares raw argument buffers without copying them. Floating point element is mismatched when its absolute error exceeds tolerance
+// or is not a number, integer element is mismatched when it differs from reference. Relative error is computed only for elements with
+// non-zero reference value. Floating point data is compared with AVX2 (and F16C for half) when supported by processor, large buffers
+// are split between multiple threads.
+class ResultComparator
+{
+public:
+    static const size_t noMismatch;
+
+    // Core methods
+    static ComparisonSummary compare(const void* result, const void* reference, const size_t numberOfElements,
+        const ArgumentDataType& dataType, const double tolerance);
+    static bool isFloatingPoint(const ArgumentDataType& dataType);
+    static double getElement(const void* data, const size_t index, const ArgumentDataType& dataType);
+
+private:
+    static ComparisonSummary compareRange(const void* result, const void* reference, const size_t begin, const size_t end,
+        const ArgumentDataType& dataType, const double tolerance);
+};
+
+} // namespace ktt
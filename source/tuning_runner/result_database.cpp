@@ -0,0 +1,156 @@
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include "result_database.h"
+#include "tuning_checkpoint.h"
+#include "utility/ktt_utility.h"
+
+namespace ktt
+{
+
+static const std::string databaseHeader("KTT results database");
+
+ResultDatabase::ResultDatabase(const std::string& filePath) :
+    filePath(filePath),
+    headerMissing(true),
+    lineEndingMissing(false)
+{
+    std::string content;
+    {
+        std::ifstream input(filePath, std::ios::binary);
+        content.assign(std::istreambuf_iterator<char>(input), std::istreambuf_iterator<char>());
+    }
+
+    std::istringstream stream(content);
+    std::string line;
+    if (std::getline(stream, line) && line != databaseHeader)
+    {
+        throw std::runtime_error(std::string("File is not a KTT results database: ") + filePath);
+    }
+
+    // Each entry consists of key, kernel name and serialized result, entry which was not completely written is skipped
+    while (std::getline(stream, line))
+    {
+        const size_t keyEnd = line.find(',');
+        const size_t nameEnd = keyEnd == std::string::npos ? std::string::npos : line.find(',', keyEnd + 1);
+        if (nameEnd == std::string::npos)
+        {
+            continue;
+        }
+
+        try
+        {
+            TuningResult result = TuningCheckpoint::deserializeResult(line.substr(nameEnd + 1), line.substr(keyEnd + 1, nameEnd - keyEnd - 1));
+            insertResult(line.substr(0, keyEnd), result);
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+    }
+
+    headerMissing = content.empty();
+    lineEndingMissing = !content.empty() && content.back() != '\n';
+}
+
+std::string ResultDatabase::getKey(const std::string& source, const std::string& parameterSpace, const DeviceInfo& device,
+    const std::string& inputSignature)
+{
+    return hashToString(getHash(source)) + ":" + hashToString(getHash(parameterSpace)) + ":"
+        + hashToString(getHash(device.getName() + "\n" + device.getVendor())) + ":" + hashToString(getHash(inputSignature));
+}
+
+void ResultDatabase::addResult(const std::string& key, const TuningResult& result)
+{
+    // File is opened only when results are added, so that read-only database can be used in computation mode
+    if (!file.is_open())
+    {
+        file.open(filePath, std::ios::out | std::ios::app);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+        }
+        if (headerMissing)
+        {
+            file << databaseHeader << std::endl;
+        }
+        else if (lineEndingMissing)
+        {
+            // Entry terminated by crash must not be joined with the next entry
+            file << std::endl;
+        }
+    }
+
+    insertResult(key, result);
+    file << key << "," << result.getKernelName() << "," << TuningCheckpoint::serializeResult(result) << std::endl;
+}
+
+bool ResultDatabase::findResult(const std::string& key, const KernelConfiguration& configuration, TuningResult& result) const
+{
+    auto keyPointer = results.find(key);
+    if (keyPointer == results.end())
+    {
+        return false;
+    }
+
+    auto resultPointer = keyPointer->second.find(configuration.getParameterPairs());
+    if (resultPointer == keyPointer->second.end())
+    {
+        return false;
+    }
+
+    result = resultPointer->second;
+    result.setConfiguration(configuration);
+    return true;
+}
+
+bool ResultDatabase::findBestResult(const std::string& key, TuningResult& result) const
+{
+    auto keyPointer = results.find(key);
+    if (keyPointer == results.end())
+    {
+        return false;
+    }
+
+    bool found = false;
+    for (const auto& storedResult : keyPointer->second)
+    {
+        if (storedResult.second.isValid() && (!found || storedResult.second.getObjectiveValue() < result.getObjectiveValue()))
+        {
+            result = storedResult.second;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+const std::string& ResultDatabase::getFilePath() const
+{
+    return filePath;
+}
+
+size_t ResultDatabase::getResultCount(const std::string& key) const
+{
+    auto keyPointer = results.find(key);
+    if (keyPointer == results.end())
+    {
+        return 0;
+    }
+    return keyPointer->second.size();
+}
+
+void ResultDatabase::insertResult(const std::string& key, const TuningResult& result)
+{
+    std::map<std::vector<ParameterPair>, TuningResult>& keyResults = results[key];
+    auto resultPointer = keyResults.find(result.getConfiguration().getParameterPairs());
+
+    if (resultPointer != keyResults.end())
+    {
+        resultPointer->second = result;
+        return;
+    }
+    keyResults.insert(std::make_pair(result.getConfiguration().getParameterPairs(), result));
+}
+
+} // namespace ktt
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include "api/device_info.h"
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+// File based store of tuning results, which persists them across program runs. Results are grouped under key composed of hashes
+// of kernel source, parameter space, device and user supplied input signature, so that results are reused only for identical
+// tuning problem. File is append-only, result which is added again for the same key and configuration replaces the older one.
+class ResultDatabase
+{
+public:
+    // Constructor
+    explicit ResultDatabase(const std::string& filePath);
+
+    // Core methods
+    static std::string getKey(const std::string& source, const std::string& parameterSpace, const DeviceInfo& device,
+        const std::string& inputSignature);
+    void addResult(const std::string& key, const TuningResult& result);
+    bool findResult(const std::string& key, const KernelConfiguration& configuration, TuningResult& result) const;
+    bool findBestResult(const std::string& key, TuningResult& result) const;
+
+    // Getters
+    const std::string& getFilePath() const;
+    size_t getResultCount(const std::string& key) const;
+
+private:
+    // Attributes
+    std::string filePath;
+    std::ofstream file;
+    bool headerMissing;
+    bool lineEndingMissing;
+    std::map<std::string, std::map<std::vector<ParameterPair>, TuningResult>> results;
+
+    // Helper methods
+    void insertResult(const std::string& key, const TuningResult& result);
+};
+
+} // namespace ktt
@@ -1,7 +1,14 @@
+#include <algorithm>
+#include <cmath>
+#include <sstream>
 #include <string>
+#include <typeinfo>
 #include <utility>
+#include "device_comparator.h"
+#include "result_comparator.h"
 #include "result_validator.h"
 #include "utility/ktt_utility.h"
+#include "utility/mapped_file.h"
 
 namespace ktt
 {
@@ -13,7 +20,9 @@ ResultValidator::ResultValidator(ArgumentManager* argumentManager, KernelManager
     logger(logger),
     computeEngine(computeEngine),
     toleranceThreshold(1e-4),
-    validationMethod(ValidationMethod::SideBySideComparison)
+    validationMethod(ValidationMethod::SideBySideComparison),
+    maximumError(0.0),
+    nextDeviceReferenceId(DeviceComparator::firstReferenceArgumentId)
 {}
 
 void ResultValidator::setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
@@ -36,6 +45,36 @@ void ResultValidator::setReferenceClass(const KernelId id, std::unique_ptr<Refer
     referenceClasses.insert(std::make_pair(id, std::make_tuple(std::move(referenceClass), validatedArgumentIds)));
 }
 
+void ResultValidator::setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath)
+{
+    if (filePath.empty())
+    {
+        auto filesPointer = referenceFiles.find(id);
+        if (filesPointer != referenceFiles.end())
+        {
+            filesPointer->second.erase(argumentId);
+            if (filesPointer->second.empty())
+            {
+                referenceFiles.erase(filesPointer);
+            }
+        }
+        return;
+    }
+
+    referenceFiles[id][argumentId] = filePath;
+}
+
+void ResultValidator::setReferenceCache(const std::string& directoryPath)
+{
+    if (directoryPath.empty())
+    {
+        referenceCache.reset();
+        return;
+    }
+
+    referenceCache = std::make_unique<ReferenceCache>(directoryPath);
+}
+
 void ResultValidator::setToleranceThreshold(const double threshold)
 {
     if (threshold < 0.0)
@@ -59,19 +98,38 @@ void ResultValidator::setValidationRange(const ArgumentId id, const size_t range
     argumentValidationRanges.insert(std::make_pair(id, range));
 }
 
+void ResultValidator::setValidationBackend(const ArgumentId id, const ValidationBackend& backend)
+{
+    argumentValidationBackends[id] = backend;
+}
+
 void ResultValidator::computeReferenceResult(const Kernel& kernel)
 {
     computeReferenceResultWithClass(kernel);
     computeReferenceResultWithKernel(kernel);
+    computeReferenceResultWithFile(kernel);
 }
 
 void ResultValidator::clearReferenceResults()
 {
+    clearDeviceReferences();
     referenceClassResults.clear();
     referenceKernelResults.clear();
+    referenceFileResults.clear();
+}
+
+void ResultValidator::resetMaximumError()
+{
+    maximumError = 0.0;
 }
 
 bool ResultValidator::validateArgumentsWithClass(const Kernel& kernel, const KernelConfiguration& configuration)
+{
+    return validateArgumentsWithClass(kernel, configuration, *computeEngine);
+}
+
+bool ResultValidator::validateArgumentsWithClass(const Kernel& kernel, const KernelConfiguration& configuration,
+    ComputeEngine& resultEngine)
 {
     KernelId kernelId = kernel.getId();
 
@@ -81,19 +139,17 @@ bool ResultValidator::validateArgumentsWithClass(const Kernel& kernel, const Ker
         return true; // reference class not present, no validation required
     }
 
-    std::vector<ArgumentId> argumentIds = std::get<1>(referenceClassPointer->second);
-    std::vector<KernelArgument> resultArguments;
-
-    for (const auto argumentId : argumentIds)
-    {
-        KernelArgument resultArgument = computeEngine->downloadArgument(argumentId);
-        resultArguments.push_back(resultArgument);
-    }
-
-    return validateArguments(resultArguments, referenceClassResults.find(kernelId)->second, kernel.getName(), configuration);
+    return validateArgumentsWithResults(kernel, configuration, resultEngine, std::get<1>(referenceClassPointer->second),
+        referenceClassResults.find(kernelId)->second);
 }
 
 bool ResultValidator::validateArgumentsWithKernel(const Kernel& kernel, const KernelConfiguration& configuration)
+{
+    return validateArgumentsWithKernel(kernel, configuration, *computeEngine);
+}
+
+bool ResultValidator::validateArgumentsWithKernel(const Kernel& kernel, const KernelConfiguration& configuration,
+    ComputeEngine& resultEngine)
 {
     KernelId kernelId = kernel.getId();
 
@@ -103,16 +159,79 @@ bool ResultValidator::validateArgumentsWithKernel(const Kernel& kernel, const Ke
         return true; // reference kernel not present, no validation required
     }
 
-    std::vector<ArgumentId> argumentIds = std::get<2>(referenceKernelPointer->second);
+    return validateArgumentsWithResults(kernel, configuration, resultEngine, std::get<2>(referenceKernelPointer->second),
+        referenceKernelResults.find(kernelId)->second);
+}
+
+bool ResultValidator::validateArgumentsWithFile(const Kernel& kernel, const KernelConfiguration& configuration)
+{
+    return validateArgumentsWithFile(kernel, configuration, *computeEngine);
+}
+
+bool ResultValidator::validateArgumentsWithFile(const Kernel& kernel, const KernelConfiguration& configuration,
+    ComputeEngine& resultEngine)
+{
+    KernelId kernelId = kernel.getId();
+
+    auto referenceFilesPointer = referenceFiles.find(kernelId);
+    if (referenceFilesPointer == referenceFiles.end())
+    {
+        return true; // reference files not present, no validation required
+    }
+
+    std::vector<ArgumentId> argumentIds;
+    for (const auto& file : referenceFilesPointer->second)
+    {
+        argumentIds.push_back(file.first);
+    }
+
+    return validateArgumentsWithResults(kernel, configuration, resultEngine, argumentIds, referenceFileResults.find(kernelId)->second);
+}
+
+std::vector<KernelArgument> ResultValidator::downloadValidatedArguments(const Kernel& kernel, const ComputeEngine& resultEngine) const
+{
     std::vector<KernelArgument> resultArguments;
 
-    for (const auto argumentId : argumentIds)
+    for (const auto argumentId : getValidatedArgumentIds(kernel.getId()))
+    {
+        resultArguments.push_back(resultEngine.downloadArgument(argumentId));
+    }
+
+    return resultArguments;
+}
+
+ResultValidator::ValidationOutcome ResultValidator::validateDownloadedArguments(const Kernel& kernel, const KernelConfiguration& configuration,
+    const std::vector<KernelArgument>& resultArguments) const
+{
+    KernelId kernelId = kernel.getId();
+    ValidationOutcome outcome{true, 0.0, std::vector<std::string>{}};
+
+    auto referenceClassPointer = referenceClassResults.find(kernelId);
+    if (referenceClassPointer != referenceClassResults.end())
+    {
+        outcome.valid &= validateArguments(resultArguments, referenceClassPointer->second, kernel.getName(), configuration,
+            std::set<ArgumentId>{}, outcome);
+    }
+    auto referenceKernelPointer = referenceKernelResults.find(kernelId);
+    if (referenceKernelPointer != referenceKernelResults.end())
+    {
+        outcome.valid &= validateArguments(resultArguments, referenceKernelPointer->second, kernel.getName(), configuration,
+            std::set<ArgumentId>{}, outcome);
+    }
+    auto referenceFilePointer = referenceFileResults.find(kernelId);
+    if (referenceFilePointer != referenceFileResults.end())
     {
-        KernelArgument resultArgument = computeEngine->downloadArgument(argumentId);
-        resultArguments.push_back(resultArgument);
+        outcome.valid &= validateArguments(resultArguments, referenceFilePointer->second, kernel.getName(), configuration,
+            std::set<ArgumentId>{}, outcome);
     }
 
-    return validateArguments(resultArguments, referenceKernelResults.find(kernelId)->second, kernel.getName(), configuration);
+    return outcome;
+}
+
+bool ResultValidator::hasReference(const KernelId id) const
+{
+    return referenceClasses.find(id) != referenceClasses.end() || referenceKernels.find(id) != referenceKernels.end()
+        || referenceFiles.find(id) != referenceFiles.end();
 }
 
 double ResultValidator::getToleranceThreshold() const
@@ -125,6 +244,21 @@ ValidationMethod ResultValidator::getValidationMethod() const
     return validationMethod;
 }
 
+ValidationBackend ResultValidator::getValidationBackend(const ArgumentId id) const
+{
+    auto backendPointer = argumentValidationBackends.find(id);
+    if (backendPointer == argumentValidationBackends.end())
+    {
+        return ValidationBackend::Host;
+    }
+    return backendPointer->second;
+}
+
+double ResultValidator::getMaximumError() const
+{
+    return maximumError;
+}
+
 void ResultValidator::computeReferenceResultWithClass(const Kernel& kernel)
 {
     KernelId kernelId = kernel.getId();
@@ -137,23 +271,25 @@ void ResultValidator::computeReferenceResultWithClass(const Kernel& kernel)
 
     ReferenceClass* referenceClass = std::get<0>(referenceClassPointer->second).get();
     std::vector<ArgumentId> referenceArgumentIds = std::get<1>(referenceClassPointer->second);
+    checkReferenceArguments(kernel, referenceArgumentIds);
+    std::vector<KernelArgument> referenceResult;
 
-    for (const auto argumentId : referenceArgumentIds)
+    // Reference class is identified only by its type, cache directory has to be changed when its result depends on other state
+    std::string cacheKey;
+    if (referenceCache != nullptr)
     {
-        if (!elementExists(argumentId, kernel.getArgumentIds()))
-        {
-            throw std::runtime_error(std::string("Reference argument with id: ") + std::to_string(argumentId)
-                + " is not assciated with kernel with id: " + std::to_string(kernel.getId()));
-        }
-        if (argumentManager->getArgument(argumentId).getAccessType() == ArgumentAccessType::ReadOnly)
+        cacheKey = ReferenceCache::getKey(std::string("class ") + typeid(*referenceClass).name() + " " + kernel.getName(),
+            getInputArguments(kernelId), referenceArgumentIds);
+        if (referenceCache->load(cacheKey, referenceArgumentIds, *argumentManager, referenceResult))
         {
-            throw std::runtime_error(std::string("Reference argument with following id is marked as read only: ") + std::to_string(argumentId));
+            logger->log(std::string("Loaded cached reference class result for kernel: ") + kernel.getName());
+            referenceClassResults.insert(std::make_pair(kernelId, referenceResult));
+            return;
         }
     }
 
     logger->log(std::string("Computing reference class result for kernel: ") + kernel.getName());
     referenceClass->computeResult();
-    std::vector<KernelArgument> referenceResult;
 
     for (const auto referenceArgumentId : referenceArgumentIds)
     {
@@ -168,6 +304,11 @@ void ResultValidator::computeReferenceResultWithClass(const Kernel& kernel)
         referenceResult.emplace_back(KernelArgument(referenceArgumentId, referenceClass->getData(referenceArgumentId),
             numberOfElements, argument.getDataType(), argument.getMemoryLocation(), argument.getAccessType(), argument.getUploadType()));
     }
+
+    if (referenceCache != nullptr)
+    {
+        storeCachedReference(cacheKey, referenceResult);
+    }
     referenceClassResults.insert(std::make_pair(kernelId, referenceResult));
 }
 
@@ -184,7 +325,97 @@ void ResultValidator::computeReferenceResultWithKernel(const Kernel& kernel)
     KernelId referenceKernelId = std::get<0>(referenceKernelPointer->second);
     std::vector<ParameterPair> referenceParameters = std::get<1>(referenceKernelPointer->second);
     std::vector<ArgumentId> referenceArgumentIds = std::get<2>(referenceKernelPointer->second);
+    checkReferenceArguments(kernel, referenceArgumentIds);
+
+    const Kernel& referenceKernel = kernelManager->getKernel(referenceKernelId);
+    KernelConfiguration configuration = kernelManager->getKernelConfiguration(referenceKernelId, referenceParameters);
+    std::string source = kernelManager->getKernelSourceWithDefines(referenceKernelId, configuration);
+    std::vector<KernelArgument> referenceResult;
+
+    std::string cacheKey;
+    if (referenceCache != nullptr)
+    {
+        std::stringstream identity;
+        identity << "kernel " << referenceKernel.getName() << " " << configuration.getGlobalSize() << " " << configuration.getLocalSize()
+            << std::endl << source;
+        cacheKey = ReferenceCache::getKey(identity.str(), getInputArguments(referenceKernelId), referenceArgumentIds);
+        if (referenceCache->load(cacheKey, referenceArgumentIds, *argumentManager, referenceResult))
+        {
+            logger->log(std::string("Loaded cached reference kernel result for kernel: ") + kernel.getName());
+            referenceKernelResults.insert(std::make_pair(kernelId, referenceResult));
+            return;
+        }
+    }
+
+    logger->log(std::string("Computing reference kernel result for kernel: ") + kernel.getName());
+    auto result = computeEngine->runKernel(KernelRuntimeData(referenceKernelId, referenceKernel.getName(), source, configuration.getGlobalSize(),
+        configuration.getLocalSize(), {}), getKernelArgumentPointers(referenceKernelId), {});
+
+    for (const auto argumentId : referenceArgumentIds)
+    {
+        referenceResult.push_back(computeEngine->downloadArgument(argumentId));
+    }
+
+    computeEngine->clearBuffers();
+    if (referenceCache != nullptr)
+    {
+        storeCachedReference(cacheKey, referenceResult);
+    }
+    referenceKernelResults.insert(std::make_pair(kernelId, referenceResult));
+}
+
+void ResultValidator::computeReferenceResultWithFile(const Kernel& kernel)
+{
+    KernelId kernelId = kernel.getId();
+
+    auto referenceFilesPointer = referenceFiles.find(kernelId);
+    if (referenceFilesPointer == referenceFiles.end())
+    {
+        return; // reference files not present
+    }
+
+    std::vector<ArgumentId> referenceArgumentIds;
+    for (const auto& file : referenceFilesPointer->second)
+    {
+        referenceArgumentIds.push_back(file.first);
+    }
+    checkReferenceArguments(kernel, referenceArgumentIds);
+
+    logger->log(std::string("Loading reference files for kernel: ") + kernel.getName());
+    std::vector<KernelArgument> referenceResult;
+
+    for (const auto& file : referenceFilesPointer->second)
+    {
+        // Golden file contains raw argument data, number of elements is derived from its size
+        const auto& argument = argumentManager->getArgument(file.first);
+        MappedFile mappedFile(file.second);
+        if (mappedFile.getSize() % argument.getElementSizeInBytes() != 0)
+        {
+            throw std::runtime_error(std::string("Size of reference file: ") + file.second
+                + " is not a multiple of element size of argument with id: " + std::to_string(file.first));
+        }
+
+        referenceResult.emplace_back(KernelArgument(file.first, mappedFile.getData(), mappedFile.getSize() / argument.getElementSizeInBytes(),
+            argument.getDataType(), argument.getMemoryLocation(), argument.getAccessType(), argument.getUploadType()));
+    }
+    referenceFileResults.insert(std::make_pair(kernelId, referenceResult));
+}
+
+void ResultValidator::storeCachedReference(const std::string& cacheKey, const std::vector<KernelArgument>& referenceResult) const
+{
+    // Reference result is already computed, failure to cache it should not abort tuning
+    try
+    {
+        referenceCache->store(cacheKey, referenceResult);
+    }
+    catch (const std::runtime_error& error)
+    {
+        logger->log(std::string("Unable to store reference result in cache: ") + error.what());
+    }
+}
 
+void ResultValidator::checkReferenceArguments(const Kernel& kernel, const std::vector<ArgumentId>& referenceArgumentIds) const
+{
     for (const auto argumentId : referenceArgumentIds)
     {
         if (!elementExists(argumentId, kernel.getArgumentIds()))
@@ -197,32 +428,110 @@ void ResultValidator::computeReferenceResultWithKernel(const Kernel& kernel)
             throw std::runtime_error(std::string("Reference argument with following id is marked as read only: ") + std::to_string(argumentId));
         }
     }
+}
 
-    const Kernel& referenceKernel = kernelManager->getKernel(referenceKernelId);
-    KernelConfiguration configuration = kernelManager->getKernelConfiguration(referenceKernelId, referenceParameters);
-    std::string source = kernelManager->getKernelSourceWithDefines(referenceKernelId, configuration);
+bool ResultValidator::validateArgumentsWithResults(const Kernel& kernel, const KernelConfiguration& configuration,
+    ComputeEngine& resultEngine, const std::vector<ArgumentId>& argumentIds, const std::vector<KernelArgument>& referenceArguments)
+{
+    ValidationOutcome outcome{true, 0.0, std::vector<std::string>{}};
+    std::set<ArgumentId> deviceArgumentIds;
+    bool result = true;
 
-    logger->log(std::string("Computing reference kernel result for kernel: ") + kernel.getName());
-    auto result = computeEngine->runKernel(KernelRuntimeData(referenceKernelId, referenceKernel.getName(), source, configuration.getGlobalSize(),
-        configuration.getLocalSize(), {}), getKernelArgumentPointers(referenceKernelId), {});
-    std::vector<KernelArgument> referenceResult;
+    for (const auto& referenceArgument : referenceArguments)
+    {
+        const ArgumentId id = referenceArgument.getId();
+        if (getValidationBackend(id) != ValidationBackend::Device)
+        {
+            continue;
+        }
 
-    for (const auto argumentId : referenceArgumentIds)
+        try
+        {
+            result &= validateArgumentOnDevice(kernel, resultEngine, referenceArgument, outcome);
+            deviceArgumentIds.insert(id);
+        }
+        catch (const std::runtime_error& error)
+        {
+            outcome.messages.push_back(std::string("Validation on device failed for argument with id: ") + std::to_string(id) + ", reason: "
+                + error.what() + ", argument is validated on host instead");
+        }
+    }
+
+    std::vector<KernelArgument> resultArguments;
+
+    for (const auto argumentId : argumentIds)
     {
-        referenceResult.push_back(computeEngine->downloadArgument(argumentId));
+        if (deviceArgumentIds.find(argumentId) == deviceArgumentIds.end())
+        {
+            KernelArgument resultArgument = resultEngine.downloadArgument(argumentId);
+            resultArguments.push_back(resultArgument);
+        }
     }
 
-    computeEngine->clearBuffers();
-    referenceKernelResults.insert(std::make_pair(kernelId, referenceResult));
+    result &= validateArguments(resultArguments, referenceArguments, kernel.getName(), configuration, deviceArgumentIds, outcome);
+    for (const auto& message : outcome.messages)
+    {
+        logger->log(message);
+    }
+    maximumError = std::max(maximumError, outcome.maximumError);
+    return result;
+}
+
+bool ResultValidator::validateArgumentOnDevice(const Kernel& kernel, ComputeEngine& resultEngine, const KernelArgument& referenceArgument,
+    ValidationOutcome& outcome)
+{
+    const ArgumentId id = referenceArgument.getId();
+    KernelArgument& resultArgument = argumentManager->getArgument(id);
+    size_t range;
+    if (!getComparedRange(id, referenceArgument.getNumberOfElements(), resultArgument.getNumberOfElements(), range, outcome))
+    {
+        return false;
+    }
+
+    // Reference data stays on device under reserved id until reference results are cleared, so it is uploaded only once
+    auto referenceIdPointer = deviceReferenceIds.find(&referenceArgument);
+    if (referenceIdPointer == deviceReferenceIds.end())
+    {
+        referenceIdPointer = deviceReferenceIds.insert(std::make_pair(&referenceArgument, nextDeviceReferenceId)).first;
+        nextDeviceReferenceId--;
+    }
+    KernelArgument deviceReference(referenceIdPointer->second, referenceArgument.getData(), referenceArgument.getNumberOfElements(),
+        referenceArgument.getDataType(), ArgumentMemoryLocation::Device, ArgumentAccessType::ReadOnly, ArgumentUploadType::Vector, false);
+    deviceReferenceEngines.insert(&resultEngine);
+
+    const ComparisonSummary summary = DeviceComparator::compare(resultEngine, kernel.getId(), resultArgument, deviceReference, range,
+        toleranceThreshold);
+    outcome.maximumError = std::max(outcome.maximumError, summary.maximumAbsoluteError);
+    return evaluateSummary(id, summary, referenceArgument, nullptr, outcome);
+}
+
+void ResultValidator::clearDeviceReferences()
+{
+    for (const auto engine : deviceReferenceEngines)
+    {
+        for (const auto& referenceId : deviceReferenceIds)
+        {
+            engine->clearBuffer(referenceId.second);
+        }
+    }
+
+    deviceReferenceIds.clear();
+    deviceReferenceEngines.clear();
 }
 
 bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resultArguments, const std::vector<KernelArgument>& referenceArguments,
-    const std::string kernelName, const KernelConfiguration& configuration) const
+    const std::string kernelName, const KernelConfiguration& configuration, const std::set<ArgumentId>& skippedArgumentIds,
+    ValidationOutcome& outcome) const
 {
     bool validationResult = true;
 
     for (const auto& referenceArgument : referenceArguments)
     {
+        if (skippedArgumentIds.find(referenceArgument.getId()) != skippedArgumentIds.end())
+        {
+            continue;
+        }
+
         bool argumentValidated = false;
 
         for (const auto& resultArgument : resultArguments)
@@ -236,70 +545,20 @@ bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resul
 
             if (referenceDataType != resultArgument.getDataType())
             {
-                logger->log(std::string("Reference class argument data type mismatch for argument id: ") + std::to_string(resultArgument.getId()));
+                outcome.messages.push_back(std::string("Reference class argument data type mismatch for argument id: ")
+                    + std::to_string(resultArgument.getId()));
                 return false;
             }
 
-            bool currentResult;
-            if (referenceDataType == ArgumentDataType::Char)
-            {
-                currentResult = validateResult(resultArgument.getDataChar(), referenceArgument.getDataChar(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::UnsignedChar)
-            {
-                currentResult = validateResult(resultArgument.getDataUnsignedChar(), referenceArgument.getDataUnsignedChar(),
-                    resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::Short)
-            {
-                currentResult = validateResult(resultArgument.getDataShort(), referenceArgument.getDataShort(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::UnsignedShort)
-            {
-                currentResult = validateResult(resultArgument.getDataUnsignedShort(), referenceArgument.getDataUnsignedShort(),
-                    resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::Int)
-            {
-                currentResult = validateResult(resultArgument.getDataInt(), referenceArgument.getDataInt(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::UnsignedInt)
-            {
-                currentResult = validateResult(resultArgument.getDataUnsignedInt(), referenceArgument.getDataUnsignedInt(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::Long)
-            {
-                currentResult = validateResult(resultArgument.getDataLong(), referenceArgument.getDataLong(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::UnsignedLong)
-            {
-                currentResult = validateResult(resultArgument.getDataUnsignedLong(), referenceArgument.getDataUnsignedLong(),
-                    resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::Half)
-            {
-                currentResult = validateResult(resultArgument.getDataHalf(), referenceArgument.getDataHalf(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::Float)
-            {
-                currentResult = validateResult(resultArgument.getDataFloat(), referenceArgument.getDataFloat(), resultArgument.getId());
-            }
-            else if (referenceDataType == ArgumentDataType::Double)
-            {
-                currentResult = validateResult(resultArgument.getDataDouble(), referenceArgument.getDataDouble(), resultArgument.getId());
-            }
-            else
-            {
-                throw std::runtime_error("Unsupported argument data type");
-            }
-
+            bool currentResult = validateArgument(resultArgument, referenceArgument, outcome);
             validationResult &= currentResult;
             argumentValidated = true;
         }
 
         if (!argumentValidated)
         {
-            logger->log(std::string("Result for validated argument with following id not found: ") + std::to_string(referenceArgument.getId()));
+            outcome.messages.push_back(std::string("Result for validated argument with following id not found: ")
+                + std::to_string(referenceArgument.getId()));
             return false;
         }
     }
@@ -307,6 +566,129 @@ bool ResultValidator::validateArguments(const std::vector<KernelArgument>& resul
     return validationResult;
 }
 
+bool ResultValidator::validateArgument(const KernelArgument& resultArgument, const KernelArgument& referenceArgument,
+    ValidationOutcome& outcome) const
+{
+    const ArgumentId id = referenceArgument.getId();
+    size_t range;
+    if (!getComparedRange(id, referenceArgument.getNumberOfElements(), resultArgument.getNumberOfElements(), range, outcome))
+    {
+        return false;
+    }
+
+    // Data is compared in place, all elements are compared even after mismatch is found, so that maximum error is known
+    const ComparisonSummary summary = ResultComparator::compare(resultArgument.getData(), referenceArgument.getData(), range,
+        referenceArgument.getDataType(), toleranceThreshold);
+    outcome.maximumError = std::max(outcome.maximumError, summary.maximumAbsoluteError);
+    return evaluateSummary(id, summary, referenceArgument, resultArgument.getData(), outcome);
+}
+
+bool ResultValidator::getComparedRange(const ArgumentId id, const size_t referenceSize, const size_t resultSize, size_t& range,
+    ValidationOutcome& outcome) const
+{
+    range = referenceSize;
+
+    auto argumentRangePointer = argumentValidationRanges.find(id);
+    if (argumentRangePointer == argumentValidationRanges.end() && resultSize != range)
+    {
+        outcome.messages.push_back(std::string("Number of elements in results differs for argument with id: ") + std::to_string(id)
+            + ", reference size: " + std::to_string(range) + ", result size: " + std::to_string(resultSize));
+        return false;
+    }
+    if (argumentRangePointer != argumentValidationRanges.end())
+    {
+        range = argumentRangePointer->second;
+        if (range > referenceSize || range > resultSize)
+        {
+            outcome.messages.push_back(std::string("Validation range exceeds number of elements in results for argument with id: ")
+                + std::to_string(id) + ", reference size: " + std::to_string(referenceSize) + ", result size: " + std::to_string(resultSize));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool ResultValidator::evaluateSummary(const ArgumentId id, const ComparisonSummary& summary, const KernelArgument& referenceArgument,
+    const void* resultData, ValidationOutcome& outcome) const
+{
+    const ArgumentDataType dataType = referenceArgument.getDataType();
+
+    if (ResultComparator::isFloatingPoint(dataType) && validationMethod == ValidationMethod::AbsoluteDifference)
+    {
+        if (summary.absoluteErrorSum <= toleranceThreshold)
+        {
+            return true;
+        }
+
+        outcome.messages.push_back(std::string("Results differ for argument with id: ") + std::to_string(id) + ", absolute difference is: "
+            + std::to_string(summary.absoluteErrorSum));
+        return false;
+    }
+
+    if (summary.mismatchCount == 0)
+    {
+        return true;
+    }
+
+    // Result data is not available when argument was compared on device, only summary was downloaded
+    const size_t index = summary.firstMismatchIndex;
+    const double referenceValue = ResultComparator::getElement(referenceArgument.getData(), index, dataType);
+    std::stringstream stream;
+    stream << "Results differ for argument with id: " << id << ", index: " << index << ", reference value: " << referenceValue;
+    if (resultData != nullptr)
+    {
+        const double resultValue = ResultComparator::getElement(resultData, index, dataType);
+        stream << ", result value: " << resultValue << ", difference: " << std::fabs(resultValue - referenceValue);
+    }
+    stream << ", mismatched elements: " << summary.mismatchCount << ", maximum absolute error: " << summary.maximumAbsoluteError
+        << ", maximum relative error: " << summary.maximumRelativeError;
+    outcome.messages.push_back(stream.str());
+    return false;
+}
+
+std::vector<ArgumentId> ResultValidator::getValidatedArgumentIds(const KernelId id) const
+{
+    std::vector<ArgumentId> argumentIds;
+
+    auto referenceClassPointer = referenceClasses.find(id);
+    if (referenceClassPointer != referenceClasses.end())
+    {
+        argumentIds = std::get<1>(referenceClassPointer->second);
+    }
+    auto referenceKernelPointer = referenceKernels.find(id);
+    if (referenceKernelPointer != referenceKernels.end())
+    {
+        argumentIds.insert(argumentIds.end(), std::get<2>(referenceKernelPointer->second).cbegin(),
+            std::get<2>(referenceKernelPointer->second).cend());
+    }
+    auto referenceFilesPointer = referenceFiles.find(id);
+    if (referenceFilesPointer != referenceFiles.end())
+    {
+        for (const auto& file : referenceFilesPointer->second)
+        {
+            argumentIds.push_back(file.first);
+        }
+    }
+
+    // Argument validated by several references is downloaded only once
+    std::sort(argumentIds.begin(), argumentIds.end());
+    argumentIds.erase(std::unique(argumentIds.begin(), argumentIds.end()), argumentIds.end());
+    return argumentIds;
+}
+
+std::vector<const KernelArgument*> ResultValidator::getInputArguments(const KernelId id) const
+{
+    std::vector<const KernelArgument*> result;
+
+    for (const auto argumentId : kernelManager->getKernel(id).getArgumentIds())
+    {
+        result.push_back(&static_cast<const ArgumentManager*>(argumentManager)->getArgument(argumentId));
+    }
+
+    return result;
+}
+
 std::vector<KernelArgument*> ResultValidator::getKernelArgumentPointers(const KernelId id) const
 {
     std::vector<KernelArgument*> result;
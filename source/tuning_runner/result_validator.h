@@ -1,18 +1,19 @@
 #pragma once
 
-#include <cmath>
-#include <iostream>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
-#include <type_traits>
 #include <vector>
 #include "api/reference_class.h"
 #include "compute_engine/compute_engine.h"
+#include "enum/validation_backend.h"
 #include "enum/validation_method.h"
 #include "kernel/kernel_manager.h"
 #include "kernel_argument/argument_manager.h"
+#include "tuning_runner/reference_cache.h"
+#include "tuning_runner/result_comparator.h"
 #include "utility/logger.h"
 
 namespace ktt
@@ -21,6 +22,14 @@ namespace ktt
 class ResultValidator
 {
 public:
+    // Result of comparison which does not modify validator state, so that it can be performed by worker threads
+    struct ValidationOutcome
+    {
+        bool valid;
+        double maximumError;
+        std::vector<std::string> messages;
+    };
+
     // Constructor
     explicit ResultValidator(ArgumentManager* argumentManager, KernelManager* kernelManager, Logger* logger, ComputeEngine* computeEngine);
 
@@ -28,17 +37,32 @@ public:
     void setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
         const std::vector<ArgumentId>& validatedArgumentIds);
     void setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass, const std::vector<ArgumentId>& validatedArgumentIds);
+    void setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath);
+    void setReferenceCache(const std::string& directoryPath);
     void setToleranceThreshold(const double threshold);
     void setValidationMethod(const ValidationMethod& method);
     void setValidationRange(const ArgumentId id, const size_t range);
+    void setValidationBackend(const ArgumentId id, const ValidationBackend& backend);
     void computeReferenceResult(const Kernel& kernel);
     void clearReferenceResults();
+    void resetMaximumError();
     bool validateArgumentsWithClass(const Kernel& kernel, const KernelConfiguration& configuration);
     bool validateArgumentsWithKernel(const Kernel& kernel, const KernelConfiguration& configuration);
+    bool validateArgumentsWithFile(const Kernel& kernel, const KernelConfiguration& configuration);
+    // Validates output of configuration which was run on different compute engine than the one used to compute reference results
+    bool validateArgumentsWithClass(const Kernel& kernel, const KernelConfiguration& configuration, ComputeEngine& resultEngine);
+    bool validateArgumentsWithKernel(const Kernel& kernel, const KernelConfiguration& configuration, ComputeEngine& resultEngine);
+    bool validateArgumentsWithFile(const Kernel& kernel, const KernelConfiguration& configuration, ComputeEngine& resultEngine);
+    std::vector<KernelArgument> downloadValidatedArguments(const Kernel& kernel, const ComputeEngine& resultEngine) const;
+    ValidationOutcome validateDownloadedArguments(const Kernel& kernel, const KernelConfiguration& configuration,
+        const std::vector<KernelArgument>& resultArguments) const;
 
     // Getters
+    bool hasReference(const KernelId id) const;
     double getToleranceThreshold() const;
     ValidationMethod getValidationMethod() const;
+    ValidationBackend getValidationBackend(const ArgumentId id) const;
+    double getMaximumError() const;
 
 private:
     // Attributes
@@ -48,84 +72,42 @@ private:
     ComputeEngine* computeEngine;
     double toleranceThreshold;
     ValidationMethod validationMethod;
+    double maximumError;
     std::map<ArgumentId, size_t> argumentValidationRanges;
+    std::map<ArgumentId, ValidationBackend> argumentValidationBackends;
     std::map<KernelId, std::tuple<std::unique_ptr<ReferenceClass>, std::vector<ArgumentId>>> referenceClasses;
     std::map<KernelId, std::tuple<KernelId, std::vector<ParameterPair>, std::vector<ArgumentId>>> referenceKernels;
+    std::map<KernelId, std::map<ArgumentId, std::string>> referenceFiles;
     std::map<KernelId, std::vector<KernelArgument>> referenceClassResults;
     std::map<KernelId, std::vector<KernelArgument>> referenceKernelResults;
+    std::map<KernelId, std::vector<KernelArgument>> referenceFileResults;
+    std::unique_ptr<ReferenceCache> referenceCache;
+    std::map<const KernelArgument*, ArgumentId> deviceReferenceIds;
+    std::set<ComputeEngine*> deviceReferenceEngines;
+    ArgumentId nextDeviceReferenceId;
 
     // Helper methods
     void computeReferenceResultWithClass(const Kernel& kernel);
     void computeReferenceResultWithKernel(const Kernel& kernel);
+    void computeReferenceResultWithFile(const Kernel& kernel);
+    void storeCachedReference(const std::string& cacheKey, const std::vector<KernelArgument>& referenceResult) const;
+    void checkReferenceArguments(const Kernel& kernel, const std::vector<ArgumentId>& referenceArgumentIds) const;
+    bool validateArgumentsWithResults(const Kernel& kernel, const KernelConfiguration& configuration, ComputeEngine& resultEngine,
+        const std::vector<ArgumentId>& argumentIds, const std::vector<KernelArgument>& referenceArguments);
+    bool validateArgumentOnDevice(const Kernel& kernel, ComputeEngine& resultEngine, const KernelArgument& referenceArgument,
+        ValidationOutcome& outcome);
+    void clearDeviceReferences();
+    std::vector<const KernelArgument*> getInputArguments(const KernelId id) const;
     bool validateArguments(const std::vector<KernelArgument>& resultArguments, const std::vector<KernelArgument>& referenceArguments,
-        const std::string kernelName, const KernelConfiguration& configuration) const;
+        const std::string kernelName, const KernelConfiguration& configuration, const std::set<ArgumentId>& skippedArgumentIds,
+        ValidationOutcome& outcome) const;
+    bool validateArgument(const KernelArgument& resultArgument, const KernelArgument& referenceArgument, ValidationOutcome& outcome) const;
+    bool getComparedRange(const ArgumentId id, const size_t referenceSize, const size_t resultSize, size_t& range,
+        ValidationOutcome& outcome) const;
+    bool evaluateSummary(const ArgumentId id, const ComparisonSummary& summary, const KernelArgument& referenceArgument,
+        const void* resultData, ValidationOutcome& outcome) const;
+    std::vector<ArgumentId> getValidatedArgumentIds(const KernelId id) const;
     std::vector<KernelArgument*> getKernelArgumentPointers(const KernelId id) const;
-
-    template <typename T> bool validateResult(const std::vector<T>& result, const std::vector<T>& referenceResult, const ArgumentId id) const
-    {
-        auto argumentRangePointer = argumentValidationRanges.find(id);
-        if (argumentRangePointer == argumentValidationRanges.end() && result.size() != referenceResult.size())
-        {
-            logger->log(std::string("Number of elements in results differs for argument with id: ") + std::to_string(id)
-                + ", reference size: " + std::to_string(referenceResult.size()) + ", result size: " + std::to_string(result.size()));
-            return false;
-        }
-        if (argumentRangePointer != argumentValidationRanges.end())
-        {
-            return validateResultInner(result, referenceResult, argumentRangePointer->second, id, std::is_floating_point<T>());
-        }
-        return validateResultInner(result, referenceResult, referenceResult.size(), id, std::is_floating_point<T>());
-    }
-
-    template <typename T> bool validateResultInner(const std::vector<T>& result, const std::vector<T>& referenceResult, const size_t range,
-        const ArgumentId id, std::true_type) const
-    {
-        if (validationMethod == ValidationMethod::AbsoluteDifference)
-        {
-            double difference = 0.0;
-            for (size_t i = 0; i < range; i++)
-            {
-                difference += std::fabs(result.at(i) - referenceResult.at(i));
-            }
-            if (difference > toleranceThreshold)
-            {
-                logger->log(std::string("Results differ for argument with id: ") + std::to_string(id) + ", absolute difference is: "
-                    + std::to_string(difference));
-                return false;
-            }
-            return true;
-        }
-        else
-        {
-            for (size_t i = 0; i < range; i++)
-            {
-                if (std::fabs(result.at(i) - referenceResult.at(i)) > toleranceThreshold)
-                {
-                    logger->log(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
-                        + ", reference value: " + std::to_string(referenceResult.at(i)) + ", result value: " + std::to_string(result.at(i))
-                        + ", difference: " + std::to_string(std::fabs(result.at(i) - referenceResult.at(i))));
-                    return false;
-                }
-            }
-            return true;
-        }
-    }
-
-    template <typename T> bool validateResultInner(const std::vector<T>& result, const std::vector<T>& referenceResult, const size_t range,
-        const ArgumentId id, std::false_type) const
-    {
-        for (size_t i = 0; i < range; i++)
-        {
-            if (result.at(i) != referenceResult.at(i))
-            {
-                logger->log(std::string("Results differ for argument with id: ") + std::to_string(id) + ", index: " + std::to_string(i)
-                    + ", reference value: " + std::to_string(referenceResult.at(i)) + ", result value: " + std::to_string(result.at(i))
-                    + ", difference: " + std::to_string(std::fabs(result.at(i) - referenceResult.at(i))));
-                return false;
-            }
-        }
-        return true;
-    }
 };
 
 } // namespace ktt
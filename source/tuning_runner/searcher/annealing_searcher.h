@@ -1,11 +1,11 @@
 #pragma once
 
 #include <algorithm>
-#include <chrono>
+#include <cstdint>
 #include <limits>
 #include <random>
 #include <stdexcept>
-#include "searcher.h"
+#include "api/searcher.h"
 
 namespace ktt
 {
@@ -16,66 +16,88 @@ public:
     static const size_t maximumAlreadyVisitedStates = 10;
     static const size_t maximumDifferences = 3;
 
-    AnnealingSearcher(const std::vector<KernelConfiguration>& configurations, const double fraction, const double maximumTemperature) :
+    AnnealingSearcher(const std::vector<KernelConfiguration>& configurations, const double fraction, const double maximumTemperature,
+        const unsigned int randomSeed) :
         configurations(configurations),
         fraction(fraction),
         maximumTemperature(maximumTemperature),
         visitedStatesCount(0),
-        currentState(0),
-        neighbourState(0),
-        alreadyVisistedStatesCount(0),
         executionTimes(configurations.size(), std::numeric_limits<double>::max()),
-        generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count())),
-        intDistribution(0, static_cast<int>(configurations.size())),
+        generator(randomSeed),
+        intDistribution(0, static_cast<int>(configurations.size()) - 1),
         probabilityDistribution(0.0, 1.0)
     {
         if (configurations.size() == 0)
         {
             throw std::runtime_error("Configurations vector provided for searcher is empty");
         }
-        auto initialState = static_cast<size_t>(intDistribution(generator));
-        currentState = initialState;
-        index = initialState;
+        addChain();
     }
 
     KernelConfiguration getNextConfiguration() override
     {
         visitedStatesCount++;
-        return configurations.at(index);
+        return configurations.at(chains.at(0).neighbourState);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        calculateNextState(chains.at(0), getDuration(previousResult));
     }
 
-    void calculateNextConfiguration(const double previousConfigurationDuration) override
+    // Each configuration in batch is proposed by a separate annealing chain, new chains are started from random states
+    // when batch larger than current number of chains is requested
+    std::vector<KernelConfiguration> getNextConfigurationBatch(const size_t maximumCount) override
     {
-        if (previousConfigurationDuration > 0.0) // workaround for recursive calls
+        std::vector<KernelConfiguration> batch;
+        for (auto& chain : chains)
         {
-            exploredIndices.push_back(currentState);
-            executionTimes.at(index) = previousConfigurationDuration;
+            if (batch.size() == maximumCount)
+            {
+                break;
+            }
+            if (!chain.pending)
+            {
+                chain.pending = true;
+                visitedStatesCount++;
+                batch.push_back(configurations.at(chain.neighbourState));
+            }
         }
-        
-        auto progress = visitedStatesCount / static_cast<double>(getConfigurationsCount());
-        auto temperature = maximumTemperature * (1.0 - progress);
 
-        auto acceptanceProbability = getAcceptanceProbability(executionTimes.at(currentState), executionTimes.at(neighbourState), temperature);
-        auto randomProbability = probabilityDistribution(generator);
-        if (acceptanceProbability > randomProbability)
+        while (chains.size() < std::min(maximumCount, configurations.size()))
         {
-            currentState = neighbourState;
+            addChain();
+            chains.back().pending = true;
+            visitedStatesCount++;
+            batch.push_back(configurations.at(chains.back().neighbourState));
         }
+        return batch;
+    }
 
-        auto neighbours = getNeighbours(currentState);
-        neighbourState = neighbours.at(static_cast<size_t>(intDistribution(generator)) % neighbours.size());
+    void processBatchResult(const TuningResult& result) override
+    {
+        for (auto& chain : chains)
+        {
+            if (chain.pending && isSameConfiguration(configurations.at(chain.neighbourState), result.getConfiguration()))
+            {
+                chain.pending = false;
+                calculateNextState(chain, getDuration(result));
+                return;
+            }
+        }
+    }
 
-        if (executionTimes.at(neighbourState) != std::numeric_limits<double>::max())
+    // Invalidated configuration is given the same energy as configuration whose run failed
+    void invalidateResult(const TuningResult& result) override
+    {
+        for (size_t i = 0; i < configurations.size(); i++)
         {
-            if (alreadyVisistedStatesCount < maximumAlreadyVisitedStates)
+            if (executionTimes.at(i) != std::numeric_limits<double>::max() && isSameConfiguration(configurations.at(i), result.getConfiguration()))
             {
-                alreadyVisistedStatesCount++;
-                calculateNextConfiguration(-1.0);
+                executionTimes.at(i) = static_cast<double>(UINT64_MAX);
                 return;
             }
         }
-        alreadyVisistedStatesCount = 0;
-        index = neighbourState;
     }
 
     size_t getConfigurationsCount() const override
@@ -84,14 +106,18 @@ public:
     }
 
 private:
+    struct AnnealingChain
+    {
+        size_t currentState;
+        size_t neighbourState;
+        bool pending;
+    };
+
     std::vector<KernelConfiguration> configurations;
-    size_t index;
     double fraction;
     double maximumTemperature;
     size_t visitedStatesCount;
-    size_t currentState;
-    size_t neighbourState;
-    size_t alreadyVisistedStatesCount;
+    std::vector<AnnealingChain> chains;
 
     std::vector<double> executionTimes;
     std::vector<size_t> exploredIndices;
@@ -101,6 +127,69 @@ private:
     std::uniform_real_distribution<double> probabilityDistribution;
 
     // Helper methods
+    void addChain()
+    {
+        auto initialState = static_cast<size_t>(intDistribution(generator));
+        chains.push_back(AnnealingChain{initialState, initialState, false});
+    }
+
+    void calculateNextState(AnnealingChain& chain, const double previousConfigurationDuration)
+    {
+        exploredIndices.push_back(chain.neighbourState);
+        executionTimes.at(chain.neighbourState) = previousConfigurationDuration;
+
+        for (size_t alreadyVisitedStatesCount = 0; ; alreadyVisitedStatesCount++)
+        {
+            auto progress = visitedStatesCount / static_cast<double>(getConfigurationsCount());
+            auto temperature = maximumTemperature * (1.0 - progress);
+
+            auto acceptanceProbability = getAcceptanceProbability(executionTimes.at(chain.currentState),
+                executionTimes.at(chain.neighbourState), temperature);
+            auto randomProbability = probabilityDistribution(generator);
+            if (acceptanceProbability > randomProbability)
+            {
+                chain.currentState = chain.neighbourState;
+            }
+
+            auto neighbours = getNeighbours(chain.currentState);
+            chain.neighbourState = neighbours.at(static_cast<size_t>(intDistribution(generator)) % neighbours.size());
+
+            if (executionTimes.at(chain.neighbourState) == std::numeric_limits<double>::max()
+                || alreadyVisitedStatesCount >= maximumAlreadyVisitedStates)
+            {
+                break;
+            }
+        }
+    }
+
+    double getDuration(const TuningResult& result) const
+    {
+        if (!result.isValid())
+        {
+            return static_cast<double>(UINT64_MAX);
+        }
+        return result.getObjectiveValue();
+    }
+
+    bool isSameConfiguration(const KernelConfiguration& first, const KernelConfiguration& second) const
+    {
+        std::vector<ParameterPair> firstPairs = first.getParameterPairs();
+        std::vector<ParameterPair> secondPairs = second.getParameterPairs();
+        if (firstPairs.size() != secondPairs.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < firstPairs.size(); i++)
+        {
+            if (std::get<1>(firstPairs.at(i)) != std::get<1>(secondPairs.at(i)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     std::vector<size_t> getNeighbours(const size_t referenceId) const
     {
         std::vector<size_t> neighbours;
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include "parameter_effect_model.h"
+#include "api/searcher.h"
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+// Searcher which selects configuration with the highest expected improvement of objective value per unit of evaluation cost, consisting
+// of compilation duration and kernel run. Both objective value and compilation duration are predicted by per-parameter models learned
+// from evaluated configurations. Configurations whose programs are already cached by compute engine are assumed to require no compilation.
+class CostAwareSearcher : public Searcher
+{
+public:
+    static const size_t candidateCount = 16;
+    static constexpr double explorationProbability = 0.1;
+    static constexpr double minimumDeviation = 0.01;
+    static constexpr double pi = 3.14159265358979323846;
+
+    CostAwareSearcher(const std::vector<KernelConfiguration>& configurations, const double fraction, const double costWeight,
+        const unsigned int randomSeed, const std::function<bool(const KernelConfiguration&)>& isCached) :
+        configurations(configurations),
+        fraction(fraction),
+        costWeight(costWeight),
+        isCached(isCached),
+        index(0),
+        bestObjective(std::numeric_limits<double>::max()),
+        runDurationSum(0.0),
+        runCount(0),
+        explored(configurations.size(), false),
+        objectives(configurations.size(), std::numeric_limits<double>::max()),
+        objectiveModel(configurations.empty() ? 0 : configurations.at(0).getParameterPairs().size()),
+        compilationModel(configurations.empty() ? 0 : configurations.at(0).getParameterPairs().size()),
+        generator(randomSeed)
+    {
+        if (configurations.size() == 0)
+        {
+            throw std::runtime_error("Configurations vector provided for searcher is empty");
+        }
+
+        for (const auto& configuration : configurations)
+        {
+            points.push_back(getParameterValues(configuration));
+        }
+
+        std::uniform_int_distribution<size_t> distribution(0, configurations.size() - 1);
+        index = distribution(generator);
+    }
+
+    KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        explored.at(index) = true;
+
+        // Zero compilation duration means that program was taken from cache, such measurement says nothing about compilation cost
+        if (previousResult.getCompilationDuration() > 0)
+        {
+            compilationModel.addMeasurement(points.at(index), static_cast<double>(previousResult.getCompilationDuration()));
+        }
+        if (previousResult.isValid())
+        {
+            objectives.at(index) = previousResult.getObjectiveValue();
+            objectiveModel.addMeasurement(points.at(index), previousResult.getObjectiveValue());
+            bestObjective = std::min(bestObjective, previousResult.getObjectiveValue());
+            runDurationSum += static_cast<double>(previousResult.getTotalDuration());
+            runCount++;
+        }
+
+        selectNextIndex();
+    }
+
+    // Run of invalidated configuration still contributes to evaluation cost, only its objective value is forgotten
+    void invalidateResult(const TuningResult& result) override
+    {
+        const size_t resultIndex = static_cast<size_t>(std::find(points.begin(), points.end(), getParameterValues(result.getConfiguration()))
+            - points.begin());
+        if (resultIndex == points.size() || objectives.at(resultIndex) == std::numeric_limits<double>::max())
+        {
+            return;
+        }
+
+        objectiveModel.removeMeasurement(points.at(resultIndex), objectives.at(resultIndex));
+        objectives.at(resultIndex) = std::numeric_limits<double>::max();
+        bestObjective = *std::min_element(objectives.begin(), objectives.end());
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
+    }
+
+private:
+    std::vector<KernelConfiguration> configurations;
+    double fraction;
+    double costWeight;
+    std::function<bool(const KernelConfiguration&)> isCached;
+    size_t index;
+    double bestObjective;
+    double runDurationSum;
+    size_t runCount;
+    std::vector<bool> explored;
+    std::vector<double> objectives;
+    std::vector<std::vector<size_t>> points;
+    ParameterEffectModel objectiveModel;
+    ParameterEffectModel compilationModel;
+    std::default_random_engine generator;
+
+    // Helper methods
+    void selectNextIndex()
+    {
+        std::vector<size_t> unexplored;
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            if (!explored.at(i))
+            {
+                unexplored.push_back(i);
+            }
+        }
+
+        if (unexplored.empty())
+        {
+            return;
+        }
+
+        std::uniform_int_distribution<size_t> distribution(0, unexplored.size() - 1);
+        std::uniform_real_distribution<double> probabilityDistribution(0.0, 1.0);
+
+        // Models need at least one measurement per parameter before their predictions are used
+        if (objectiveModel.getMeasurementCount() <= points.at(0).size() || probabilityDistribution(generator) < explorationProbability)
+        {
+            index = unexplored.at(distribution(generator));
+            return;
+        }
+
+        std::vector<size_t> candidates;
+        if (unexplored.size() <= candidateCount)
+        {
+            candidates = unexplored;
+        }
+        else
+        {
+            for (size_t i = 0; i < candidateCount; i++)
+            {
+                candidates.push_back(unexplored.at(distribution(generator)));
+            }
+        }
+
+        const double averageRunDuration = runCount > 0 ? runDurationSum / static_cast<double>(runCount) : 0.0;
+        const double deviation = std::fmax(minimumDeviation, objectiveModel.getLogDeviation());
+        const double bestLogObjective = std::log(std::max(std::numeric_limits<double>::min(), bestObjective));
+        double bestScore = -std::numeric_limits<double>::max();
+
+        for (const auto candidate : candidates)
+        {
+            double compilationCost = 0.0;
+            if (compilationModel.getMeasurementCount() > 0 && !(isCached && isCached(configurations.at(candidate))))
+            {
+                compilationCost = compilationModel.predict(points.at(candidate));
+            }
+
+            // Expected improvement of logarithm of objective value, prediction error is assumed to be normally distributed
+            const double predicted = std::log(std::max(std::numeric_limits<double>::min(), objectiveModel.predict(points.at(candidate))));
+            const double z = (bestLogObjective - predicted) / deviation;
+            const double improvement = deviation * (z * 0.5 * std::erfc(-z / std::sqrt(2.0)) + std::exp(-0.5 * z * z) / std::sqrt(2.0 * pi));
+
+            const double cost = std::max(1.0, compilationCost + averageRunDuration);
+            const double score = std::log(std::max(std::numeric_limits<double>::min(), improvement)) - costWeight * std::log(cost);
+
+            if (score > bestScore)
+            {
+                bestScore = score;
+                index = candidate;
+            }
+        }
+    }
+
+    static std::vector<size_t> getParameterValues(const KernelConfiguration& configuration)
+    {
+        std::vector<size_t> values;
+        for (const auto& parameterPair : configuration.getParameterPairs())
+        {
+            values.push_back(std::get<1>(parameterPair));
+        }
+        return values;
+    }
+};
+
+} // namespace ktt
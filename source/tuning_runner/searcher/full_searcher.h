@@ -1,6 +1,6 @@
 #pragma once
 
-#include "searcher.h"
+#include "api/searcher.h"
 
 namespace ktt
 {
@@ -23,11 +23,25 @@ public:
         return configurations.at(index);
     }
 
-    void calculateNextConfiguration(const double) override
+    void calculateNextConfiguration(const TuningResult&) override
     {
         index++;
     }
 
+    std::vector<KernelConfiguration> getNextConfigurationBatch(const size_t maximumCount) override
+    {
+        std::vector<KernelConfiguration> batch;
+        while (batch.size() < maximumCount && index < getConfigurationsCount())
+        {
+            batch.push_back(configurations.at(index));
+            index++;
+        }
+        return batch;
+    }
+
+    void processBatchResult(const TuningResult&) override
+    {}
+
     size_t getConfigurationsCount() const override
     {
         return configurations.size();
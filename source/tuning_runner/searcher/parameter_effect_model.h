@@ -0,0 +1,125 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace ktt
+{
+
+// Additive model of logarithm of a measured quantity (eg. duration), where each parameter value contributes by its average deviation
+// from overall mean. Model is cheap to update and predicts unmeasured configurations from measured configurations sharing parameter values.
+class ParameterEffectModel
+{
+public:
+    explicit ParameterEffectModel(const size_t parameterCount) :
+        logSum(0.0),
+        logSquareSum(0.0),
+        measurementCount(0),
+        valueEffects(parameterCount)
+    {}
+
+    void addMeasurement(const std::vector<size_t>& parameterValues, const double value)
+    {
+        if (value <= 0.0)
+        {
+            return;
+        }
+
+        const double logValue = std::log(value);
+        logSum += logValue;
+        logSquareSum += logValue * logValue;
+        measurementCount++;
+
+        for (size_t i = 0; i < parameterValues.size() && i < valueEffects.size(); i++)
+        {
+            std::pair<double, size_t>& effect = valueEffects.at(i)[parameterValues.at(i)];
+            effect.first += logValue;
+            effect.second++;
+        }
+    }
+
+    // Value has to be the same as when the measurement was added
+    void removeMeasurement(const std::vector<size_t>& parameterValues, const double value)
+    {
+        if (value <= 0.0 || measurementCount == 0)
+        {
+            return;
+        }
+
+        const double logValue = std::log(value);
+        logSum -= logValue;
+        logSquareSum -= logValue * logValue;
+        measurementCount--;
+
+        for (size_t i = 0; i < parameterValues.size() && i < valueEffects.size(); i++)
+        {
+            auto effectPointer = valueEffects.at(i).find(parameterValues.at(i));
+            if (effectPointer == valueEffects.at(i).end())
+            {
+                continue;
+            }
+
+            effectPointer->second.first -= logValue;
+            effectPointer->second.second--;
+            if (effectPointer->second.second == 0)
+            {
+                valueEffects.at(i).erase(effectPointer);
+            }
+        }
+    }
+
+    // Returns 1.0 if no measurements were added yet
+    double predict(const std::vector<size_t>& parameterValues) const
+    {
+        if (measurementCount == 0)
+        {
+            return 1.0;
+        }
+
+        const double mean = logSum / static_cast<double>(measurementCount);
+        double prediction = mean;
+
+        for (size_t i = 0; i < parameterValues.size() && i < valueEffects.size(); i++)
+        {
+            auto effectPointer = valueEffects.at(i).find(parameterValues.at(i));
+            if (effectPointer == valueEffects.at(i).end())
+            {
+                continue;
+            }
+
+            // Effects supported by few measurements are shrunk towards zero
+            const double count = static_cast<double>(effectPointer->second.second);
+            prediction += (effectPointer->second.first / count - mean) * count / (count + 1.0);
+        }
+
+        return std::exp(prediction);
+    }
+
+    // Returns standard deviation of logarithms of measured values
+    double getLogDeviation() const
+    {
+        if (measurementCount < 2)
+        {
+            return 0.0;
+        }
+
+        const double mean = logSum / static_cast<double>(measurementCount);
+        return std::sqrt(std::max(0.0, logSquareSum / static_cast<double>(measurementCount) - mean * mean));
+    }
+
+    size_t getMeasurementCount() const
+    {
+        return measurementCount;
+    }
+
+private:
+    double logSum;
+    double logSquareSum;
+    size_t measurementCount;
+    std::vector<std::map<size_t, std::pair<double, size_t>>> valueEffects;
+};
+
+} // namespace ktt
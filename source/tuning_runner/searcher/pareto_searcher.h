@@ -0,0 +1,201 @@
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include "api/searcher.h"
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+// Multi-objective searcher which maintains Pareto front of evaluated configurations with regards to kernel duration, objective value,
+// maximum validation error and work-group memory. Next configuration is either neighbour of randomly selected front member, which
+// differs in single parameter value, or random unexplored configuration.
+class ParetoSearcher : public Searcher
+{
+public:
+    static constexpr double explorationProbability = 0.2;
+
+    ParetoSearcher(const std::vector<KernelConfiguration>& configurations, const double fraction, const unsigned int randomSeed) :
+        configurations(configurations),
+        fraction(fraction),
+        index(0),
+        explored(configurations.size(), false),
+        generator(randomSeed)
+    {
+        if (configurations.size() == 0)
+        {
+            throw std::runtime_error("Configurations vector provided for searcher is empty");
+        }
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            points.push_back(getParameterValues(configurations.at(i)));
+        }
+
+        index = getRandomUnexploredIndex();
+    }
+
+    KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        explored.at(index) = true;
+        if (previousResult.isValid())
+        {
+            validResults.insert(std::make_pair(index, previousResult));
+            updateFront(index, previousResult);
+        }
+
+        std::uniform_real_distribution<double> probabilityDistribution(0.0, 1.0);
+        if (front.empty() || probabilityDistribution(generator) < explorationProbability)
+        {
+            index = getRandomUnexploredIndex();
+            return;
+        }
+
+        std::uniform_int_distribution<size_t> frontDistribution(0, front.size() - 1);
+        std::vector<size_t> neighbours = getUnexploredNeighbours(front.at(frontDistribution(generator)).first);
+
+        if (neighbours.empty())
+        {
+            index = getRandomUnexploredIndex();
+            return;
+        }
+
+        std::uniform_int_distribution<size_t> neighbourDistribution(0, neighbours.size() - 1);
+        index = neighbours.at(neighbourDistribution(generator));
+    }
+
+    // Front is rebuilt from remaining valid results, since configurations dominated by invalidated result may belong to it again
+    void invalidateResult(const TuningResult& result) override
+    {
+        const std::vector<size_t> values = getParameterValues(result.getConfiguration());
+        auto resultPointer = std::find_if(validResults.begin(), validResults.end(),
+            [this, &values](const std::pair<const size_t, TuningResult>& member)
+        {
+            return points.at(member.first) == values;
+        });
+        if (resultPointer == validResults.end())
+        {
+            return;
+        }
+
+        validResults.erase(resultPointer);
+        front.clear();
+        for (const auto& member : validResults)
+        {
+            updateFront(member.first, member.second);
+        }
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
+    }
+
+    std::vector<KernelConfiguration> getParetoFront() const
+    {
+        std::vector<KernelConfiguration> result;
+        for (const auto& member : front)
+        {
+            result.push_back(configurations.at(member.first));
+        }
+        return result;
+    }
+
+private:
+    std::vector<KernelConfiguration> configurations;
+    double fraction;
+    size_t index;
+    std::vector<bool> explored;
+    std::vector<std::vector<size_t>> points;
+    std::vector<std::pair<size_t, TuningResult>> front;
+    std::map<size_t, TuningResult> validResults;
+    std::default_random_engine generator;
+
+    // Helper methods
+    void updateFront(const size_t resultIndex, const TuningResult& result)
+    {
+        for (const auto& member : front)
+        {
+            if (member.second.dominates(result))
+            {
+                return;
+            }
+        }
+
+        front.erase(std::remove_if(front.begin(), front.end(), [&result](const std::pair<size_t, TuningResult>& member)
+        {
+            return result.dominates(member.second);
+        }), front.end());
+        front.push_back(std::make_pair(resultIndex, result));
+    }
+
+    std::vector<size_t> getUnexploredNeighbours(const size_t center) const
+    {
+        std::vector<size_t> neighbours;
+        const std::vector<size_t>& centerPoint = points.at(center);
+
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            if (explored.at(i))
+            {
+                continue;
+            }
+
+            size_t differences = 0;
+            for (size_t j = 0; j < centerPoint.size() && differences < 2; j++)
+            {
+                if (points.at(i).at(j) != centerPoint.at(j))
+                {
+                    differences++;
+                }
+            }
+
+            if (differences == 1)
+            {
+                neighbours.push_back(i);
+            }
+        }
+
+        return neighbours;
+    }
+
+    size_t getRandomUnexploredIndex()
+    {
+        std::vector<size_t> unexplored;
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            if (!explored.at(i))
+            {
+                unexplored.push_back(i);
+            }
+        }
+
+        if (unexplored.empty())
+        {
+            return index;
+        }
+
+        std::uniform_int_distribution<size_t> distribution(0, unexplored.size() - 1);
+        return unexplored.at(distribution(generator));
+    }
+
+    static std::vector<size_t> getParameterValues(const KernelConfiguration& configuration)
+    {
+        std::vector<size_t> values;
+        for (const auto& parameterPair : configuration.getParameterPairs())
+        {
+            values.push_back(std::get<1>(parameterPair));
+        }
+        return values;
+    }
+};
+
+} // namespace ktt
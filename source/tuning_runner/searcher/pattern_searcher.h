@@ -0,0 +1,316 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include "api/searcher.h"
+#include "kernel/kernel_parameter.h"
+
+namespace ktt
+{
+
+// Compass pattern search in the space of parameter value indices. Ordinal parameter values are ordered by their magnitude and polled
+// with current step size in both directions, categorical parameters are polled with all of their other values. Step size is halved
+// when no poll point improves the current configuration, search is restarted from random configuration after polling with step one.
+class PatternSearcher : public Searcher
+{
+public:
+    PatternSearcher(const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters, const double fraction,
+        const unsigned int randomSeed) :
+        configurations(configurations),
+        fraction(fraction),
+        index(0),
+        center(0),
+        centerDuration(std::numeric_limits<double>::max()),
+        initialStep(1),
+        step(1),
+        pollGenerated(false),
+        evaluatingCenter(true),
+        durations(configurations.size(), std::numeric_limits<double>::max()),
+        explored(configurations.size(), false),
+        generator(randomSeed)
+    {
+        if (configurations.size() == 0)
+        {
+            throw std::runtime_error("Configurations vector provided for searcher is empty");
+        }
+
+        for (const auto& parameter : parameters)
+        {
+            std::vector<size_t> values = parameter.getValues();
+            if (parameter.getParameterType() == ParameterType::Ordinal)
+            {
+                std::sort(values.begin(), values.end());
+                initialStep = std::max(initialStep, values.size() / 4);
+            }
+            parameterNames.push_back(parameter.getName());
+            parameterValues.push_back(values);
+            ordinal.push_back(parameter.getParameterType() == ParameterType::Ordinal);
+        }
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            std::vector<size_t> point = getPoint(configurations.at(i));
+            points.push_back(point);
+            pointIndices.insert(std::make_pair(point, i));
+        }
+
+        restart();
+    }
+
+    KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        double duration = std::numeric_limits<double>::max();
+        if (previousResult.isValid())
+        {
+            duration = previousResult.getObjectiveValue();
+        }
+        durations.at(index) = duration;
+        explored.at(index) = true;
+
+        if (evaluatingCenter)
+        {
+            evaluatingCenter = false;
+            centerDuration = duration;
+        }
+        else if (duration < centerDuration)
+        {
+            moveCenter(index);
+        }
+
+        selectNextIndex();
+    }
+
+    // Poll points are compared against the center again once center result is invalidated
+    void invalidateResult(const TuningResult& result) override
+    {
+        auto pointPointer = pointIndices.find(getPoint(result.getConfiguration()));
+        if (pointPointer == pointIndices.end() || durations.at(pointPointer->second) == std::numeric_limits<double>::max())
+        {
+            return;
+        }
+
+        durations.at(pointPointer->second) = std::numeric_limits<double>::max();
+        if (pointPointer->second == center)
+        {
+            centerDuration = std::numeric_limits<double>::max();
+        }
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
+    }
+
+private:
+    std::vector<KernelConfiguration> configurations;
+    double fraction;
+    std::vector<std::string> parameterNames;
+    std::vector<std::vector<size_t>> parameterValues;
+    std::vector<bool> ordinal;
+    std::vector<std::vector<size_t>> points;
+    std::map<std::vector<size_t>, size_t> pointIndices;
+
+    size_t index;
+    size_t center;
+    double centerDuration;
+    size_t initialStep;
+    size_t step;
+    std::deque<size_t> pollIndices;
+    bool pollGenerated;
+    bool evaluatingCenter;
+    std::vector<double> durations;
+    std::vector<bool> explored;
+    std::default_random_engine generator;
+
+    // Helper methods
+    void selectNextIndex()
+    {
+        while (true)
+        {
+            if (pollIndices.empty())
+            {
+                if (pollGenerated)
+                {
+                    if (step == 1)
+                    {
+                        restart();
+                        return;
+                    }
+                    step /= 2;
+                }
+                generatePoll();
+                pollGenerated = true;
+                continue;
+            }
+
+            size_t candidate = pollIndices.front();
+            pollIndices.pop_front();
+
+            if (!explored.at(candidate))
+            {
+                index = candidate;
+                return;
+            }
+            if (durations.at(candidate) < centerDuration)
+            {
+                moveCenter(candidate);
+            }
+        }
+    }
+
+    void moveCenter(const size_t newCenter)
+    {
+        center = newCenter;
+        centerDuration = durations.at(newCenter);
+        pollIndices.clear();
+        pollGenerated = false;
+    }
+
+    void restart()
+    {
+        std::vector<size_t> unexplored;
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            if (!explored.at(i))
+            {
+                unexplored.push_back(i);
+            }
+        }
+
+        if (unexplored.empty())
+        {
+            return;
+        }
+
+        std::uniform_int_distribution<size_t> distribution(0, unexplored.size() - 1);
+        center = unexplored.at(distribution(generator));
+        centerDuration = std::numeric_limits<double>::max();
+        index = center;
+        step = initialStep;
+        pollIndices.clear();
+        pollGenerated = false;
+        evaluatingCenter = true;
+    }
+
+    void generatePoll()
+    {
+        const std::vector<size_t>& centerPoint = points.at(center);
+
+        for (size_t i = 0; i < centerPoint.size(); i++)
+        {
+            std::vector<size_t> targets;
+            if (ordinal.at(i))
+            {
+                size_t lastIndex = parameterValues.at(i).size() - 1;
+                targets.push_back(centerPoint.at(i) >= step ? centerPoint.at(i) - step : 0);
+                targets.push_back(std::min(lastIndex, centerPoint.at(i) + step));
+            }
+            else
+            {
+                for (size_t j = 0; j < parameterValues.at(i).size(); j++)
+                {
+                    targets.push_back(j);
+                }
+            }
+
+            for (const auto target : targets)
+            {
+                if (target == centerPoint.at(i))
+                {
+                    continue;
+                }
+
+                std::vector<size_t> point = centerPoint;
+                point.at(i) = target;
+                size_t candidate = projectPoint(point);
+                if (candidate != center && std::find(pollIndices.begin(), pollIndices.end(), candidate) == pollIndices.end())
+                {
+                    pollIndices.push_back(candidate);
+                }
+            }
+        }
+    }
+
+    // Returns index of the configuration closest to specified point, which may not satisfy constraints
+    size_t projectPoint(const std::vector<size_t>& point) const
+    {
+        auto pointPointer = pointIndices.find(point);
+        if (pointPointer != pointIndices.end())
+        {
+            return pointPointer->second;
+        }
+
+        size_t categoricalPenalty = 1;
+        for (size_t i = 0; i < point.size(); i++)
+        {
+            if (ordinal.at(i))
+            {
+                categoricalPenalty += parameterValues.at(i).size();
+            }
+        }
+
+        size_t bestIndex = center;
+        size_t bestDistance = std::numeric_limits<size_t>::max();
+        for (size_t i = 0; i < points.size(); i++)
+        {
+            if (i == center)
+            {
+                continue;
+            }
+
+            size_t distance = 0;
+            for (size_t j = 0; j < point.size(); j++)
+            {
+                size_t first = points.at(i).at(j);
+                size_t second = point.at(j);
+                if (ordinal.at(j))
+                {
+                    distance += first > second ? first - second : second - first;
+                }
+                else if (first != second)
+                {
+                    distance += categoricalPenalty;
+                }
+            }
+
+            if (distance < bestDistance)
+            {
+                bestDistance = distance;
+                bestIndex = i;
+            }
+        }
+
+        return bestIndex;
+    }
+
+    std::vector<size_t> getPoint(const KernelConfiguration& configuration) const
+    {
+        std::vector<size_t> point(parameterNames.size(), 0);
+        for (const auto& parameterPair : configuration.getParameterPairs())
+        {
+            for (size_t i = 0; i < parameterNames.size(); i++)
+            {
+                if (std::get<0>(parameterPair) != parameterNames.at(i))
+                {
+                    continue;
+                }
+
+                const std::vector<size_t>& values = parameterValues.at(i);
+                point.at(i) = static_cast<size_t>(std::find(values.begin(), values.end(), std::get<1>(parameterPair)) - values.begin());
+                break;
+            }
+        }
+        return point;
+    }
+};
+
+} // namespace ktt
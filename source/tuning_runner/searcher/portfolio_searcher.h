@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include "api/searcher.h"
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+// Meta-searcher which distributes evaluations among multiple underlying searchers. Searcher is selected with discounted UCB1 policy,
+// where searcher is rewarded when configuration proposed by it improves the best found duration. Evaluated results are shared,
+// configurations proposed by a searcher which were already evaluated are answered from cache without spending tuning budget.
+// Searcher which received as many results as its configurations count is exhausted and no longer asked for configurations.
+class PortfolioSearcher : public Searcher
+{
+public:
+    static constexpr double discountFactor = 0.95;
+    static constexpr double explorationWeight = 1.0;
+    static const size_t maximumCachedAnswers = 100;
+
+    PortfolioSearcher(const std::vector<KernelConfiguration>& configurations, std::vector<std::unique_ptr<Searcher>> searchers,
+        const double fraction, const unsigned int randomSeed) :
+        configurations(configurations),
+        searchers(std::move(searchers)),
+        fraction(fraction),
+        index(0),
+        currentSearcher(0),
+        proposedBySearcher(false),
+        bestDuration(std::numeric_limits<double>::max()),
+        selectionCounts(this->searchers.size(), 0.0),
+        rewardSums(this->searchers.size(), 0.0),
+        answerCounts(this->searchers.size(), 0),
+        explored(configurations.size(), false),
+        generator(randomSeed)
+    {
+        if (configurations.size() == 0)
+        {
+            throw std::runtime_error("Configurations vector provided for searcher is empty");
+        }
+        if (this->searchers.empty())
+        {
+            throw std::runtime_error("Portfolio searcher requires at least one underlying searcher");
+        }
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            indices.insert(std::make_pair(getParameterValues(configurations.at(i)), i));
+        }
+
+        selectNextIndex();
+    }
+
+    KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        explored.at(index) = true;
+        cachedResults.insert(std::make_pair(index, previousResult));
+        if (proposedBySearcher)
+        {
+            answerResult(currentSearcher, previousResult);
+        }
+
+        double reward = 0.0;
+        if (previousResult.isValid() && previousResult.getObjectiveValue() < bestDuration)
+        {
+            bestDuration = previousResult.getObjectiveValue();
+            reward = 1.0;
+        }
+
+        for (size_t i = 0; i < searchers.size(); i++)
+        {
+            selectionCounts.at(i) *= discountFactor;
+            rewardSums.at(i) *= discountFactor;
+        }
+        selectionCounts.at(currentSearcher) += 1.0;
+        rewardSums.at(currentSearcher) += reward;
+
+        selectNextIndex();
+    }
+
+    // Cached answer is replaced by invalidated result, searchers which did not receive the result ignore it
+    void invalidateResult(const TuningResult& result) override
+    {
+        auto indexPointer = indices.find(getParameterValues(result.getConfiguration()));
+        if (indexPointer == indices.end() || cachedResults.find(indexPointer->second) == cachedResults.end())
+        {
+            return;
+        }
+
+        cachedResults.at(indexPointer->second) = result;
+        bestDuration = std::numeric_limits<double>::max();
+        for (const auto& cachedResult : cachedResults)
+        {
+            if (cachedResult.second.isValid())
+            {
+                bestDuration = std::min(bestDuration, cachedResult.second.getObjectiveValue());
+            }
+        }
+
+        for (auto& searcher : searchers)
+        {
+            searcher->invalidateResult(result);
+        }
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
+    }
+
+private:
+    std::vector<KernelConfiguration> configurations;
+    std::vector<std::unique_ptr<Searcher>> searchers;
+    double fraction;
+    size_t index;
+    size_t currentSearcher;
+    bool proposedBySearcher;
+    double bestDuration;
+    std::vector<double> selectionCounts;
+    std::vector<double> rewardSums;
+    std::vector<size_t> answerCounts;
+    std::vector<bool> explored;
+    std::map<std::vector<size_t>, size_t> indices;
+    std::map<size_t, TuningResult> cachedResults;
+    std::default_random_engine generator;
+
+    // Helper methods
+    void selectNextIndex()
+    {
+        currentSearcher = selectSearcher();
+        Searcher* searcher = searchers.at(currentSearcher).get();
+
+        for (size_t i = 0; i < maximumCachedAnswers && !isExhausted(currentSearcher); i++)
+        {
+            auto indexPointer = indices.find(getParameterValues(searcher->getNextConfiguration()));
+            if (indexPointer == indices.end())
+            {
+                break;
+            }
+
+            if (!explored.at(indexPointer->second))
+            {
+                index = indexPointer->second;
+                proposedBySearcher = true;
+                return;
+            }
+            answerResult(currentSearcher, cachedResults.at(indexPointer->second));
+        }
+
+        // Searcher is exhausted or keeps proposing explored configurations, random unexplored configuration is evaluated instead
+        std::vector<size_t> unexplored;
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            if (!explored.at(i))
+            {
+                unexplored.push_back(i);
+            }
+        }
+
+        if (!unexplored.empty())
+        {
+            std::uniform_int_distribution<size_t> distribution(0, unexplored.size() - 1);
+            index = unexplored.at(distribution(generator));
+        }
+        proposedBySearcher = false;
+    }
+
+    void answerResult(const size_t searcherIndex, const TuningResult& result)
+    {
+        searchers.at(searcherIndex)->calculateNextConfiguration(result);
+        answerCounts.at(searcherIndex)++;
+    }
+
+    bool isExhausted(const size_t searcherIndex) const
+    {
+        return answerCounts.at(searcherIndex) >= searchers.at(searcherIndex)->getConfigurationsCount();
+    }
+
+    size_t selectSearcher() const
+    {
+        double totalCount = 0.0;
+        for (size_t i = 0; i < searchers.size(); i++)
+        {
+            if (selectionCounts.at(i) == 0.0 && !isExhausted(i))
+            {
+                return i;
+            }
+            totalCount += selectionCounts.at(i);
+        }
+
+        size_t bestSearcher = 0;
+        double bestScore = -std::numeric_limits<double>::max();
+        for (size_t i = 0; i < searchers.size(); i++)
+        {
+            if (isExhausted(i))
+            {
+                continue;
+            }
+
+            double score = rewardSums.at(i) / selectionCounts.at(i)
+                + explorationWeight * std::sqrt(2.0 * std::log(std::max(1.0, totalCount)) / selectionCounts.at(i));
+            if (score > bestScore)
+            {
+                bestScore = score;
+                bestSearcher = i;
+            }
+        }
+        return bestSearcher;
+    }
+
+    static std::vector<size_t> getParameterValues(const KernelConfiguration& configuration)
+    {
+        std::vector<size_t> values;
+        for (const auto& parameterPair : configuration.getParameterPairs())
+        {
+            values.push_back(std::get<1>(parameterPair));
+        }
+        return values;
+    }
+};
+
+} // namespace ktt
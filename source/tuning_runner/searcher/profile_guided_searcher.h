@@ -0,0 +1,320 @@
+#pragma once
+
+#include <algorithm>
+#include <deque>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include "parameter_effect_model.h"
+#include "api/searcher.h"
+#include "kernel/kernel_parameter.h"
+
+namespace ktt
+{
+
+// Local search guided by hardware counters collected during kernel runs. Rule layer determines dominant bottleneck of the current
+// configuration (cache misses, branch misses or low number of instructions per cycle) by comparing derived metrics with their reference
+// levels. Neighbouring configurations, which differ in single parameter value, are then evaluated in order of predicted value of the
+// bottleneck metric, predictions are made by per-parameter models learned from explored configurations. If counters are not available
+// or no metric exceeds its reference level, neighbours are ordered by predicted objective value instead.
+class ProfileGuidedSearcher : public Searcher
+{
+public:
+    static constexpr double cacheMissRateReference = 0.05;
+    static constexpr double branchMissRateReference = 0.02;
+    static constexpr double cyclesPerInstructionReference = 1.0;
+
+    ProfileGuidedSearcher(const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters,
+        const double fraction, const unsigned int randomSeed) :
+        configurations(configurations),
+        fraction(fraction),
+        index(0),
+        center(0),
+        centerObjective(std::numeric_limits<double>::max()),
+        objectives(configurations.size(), std::numeric_limits<double>::max()),
+        metrics(configurations.size()),
+        explored(configurations.size(), false),
+        objectiveModel(parameters.size()),
+        metricModels(metricCount, ParameterEffectModel(parameters.size())),
+        generator(randomSeed)
+    {
+        if (configurations.size() == 0)
+        {
+            throw std::runtime_error("Configurations vector provided for searcher is empty");
+        }
+
+        for (const auto& parameter : parameters)
+        {
+            std::vector<size_t> values = parameter.getValues();
+            if (parameter.getParameterType() == ParameterType::Ordinal)
+            {
+                std::sort(values.begin(), values.end());
+            }
+            parameterNames.push_back(parameter.getName());
+            parameterValues.push_back(values);
+            ordinal.push_back(parameter.getParameterType() == ParameterType::Ordinal);
+        }
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            std::vector<size_t> point = getPoint(configurations.at(i));
+            points.push_back(point);
+            pointIndices.insert(std::make_pair(point, i));
+        }
+
+        restart();
+    }
+
+    KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        explored.at(index) = true;
+
+        if (previousResult.isValid())
+        {
+            objectives.at(index) = previousResult.getObjectiveValue();
+            objectiveModel.addMeasurement(points.at(index), objectives.at(index));
+            metrics.at(index) = getMetrics(previousResult.getHardwareCounters());
+
+            for (size_t i = 0; i < metrics.at(index).size(); i++)
+            {
+                // Small offset allows metrics which are zero to be modelled in logarithmic space
+                metricModels.at(i).addMeasurement(points.at(index), metrics.at(index).at(i) + 1e-9);
+            }
+        }
+
+        if (objectives.at(index) < centerObjective)
+        {
+            center = index;
+            centerObjective = objectives.at(index);
+            candidateIndices.clear();
+            generateCandidates();
+        }
+
+        selectNextIndex();
+    }
+
+    // Invalidated measurements are removed from models, next valid result replaces invalidated center
+    void invalidateResult(const TuningResult& result) override
+    {
+        auto pointPointer = pointIndices.find(getPoint(result.getConfiguration()));
+        if (pointPointer == pointIndices.end() || objectives.at(pointPointer->second) == std::numeric_limits<double>::max())
+        {
+            return;
+        }
+
+        const size_t resultIndex = pointPointer->second;
+        objectiveModel.removeMeasurement(points.at(resultIndex), objectives.at(resultIndex));
+        for (size_t i = 0; i < metrics.at(resultIndex).size(); i++)
+        {
+            metricModels.at(i).removeMeasurement(points.at(resultIndex), metrics.at(resultIndex).at(i) + 1e-9);
+        }
+
+        objectives.at(resultIndex) = std::numeric_limits<double>::max();
+        metrics.at(resultIndex).clear();
+        if (resultIndex == center)
+        {
+            centerObjective = std::numeric_limits<double>::max();
+        }
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
+    }
+
+private:
+    static const size_t metricCount = 3;
+
+    std::vector<KernelConfiguration> configurations;
+    double fraction;
+    std::vector<std::string> parameterNames;
+    std::vector<std::vector<size_t>> parameterValues;
+    std::vector<bool> ordinal;
+    std::vector<std::vector<size_t>> points;
+    std::map<std::vector<size_t>, size_t> pointIndices;
+
+    size_t index;
+    size_t center;
+    double centerObjective;
+    std::deque<size_t> candidateIndices;
+    std::vector<double> objectives;
+    std::vector<std::vector<double>> metrics;
+    std::vector<bool> explored;
+    ParameterEffectModel objectiveModel;
+    std::vector<ParameterEffectModel> metricModels;
+    std::default_random_engine generator;
+
+    // Helper methods
+    void selectNextIndex()
+    {
+        while (!candidateIndices.empty())
+        {
+            size_t candidate = candidateIndices.front();
+            candidateIndices.pop_front();
+
+            if (!explored.at(candidate))
+            {
+                index = candidate;
+                return;
+            }
+        }
+
+        // All neighbours of current configuration were explored without improvement
+        restart();
+    }
+
+    void restart()
+    {
+        std::vector<size_t> unexplored;
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            if (!explored.at(i))
+            {
+                unexplored.push_back(i);
+            }
+        }
+
+        if (unexplored.empty())
+        {
+            return;
+        }
+
+        std::uniform_int_distribution<size_t> distribution(0, unexplored.size() - 1);
+        index = unexplored.at(distribution(generator));
+        centerObjective = std::numeric_limits<double>::max();
+        candidateIndices.clear();
+    }
+
+    void generateCandidates()
+    {
+        const std::vector<size_t>& centerPoint = points.at(center);
+        std::vector<size_t> neighbours;
+
+        for (size_t i = 0; i < centerPoint.size(); i++)
+        {
+            std::vector<size_t> targets;
+            if (ordinal.at(i))
+            {
+                if (centerPoint.at(i) > 0)
+                {
+                    targets.push_back(centerPoint.at(i) - 1);
+                }
+                targets.push_back(centerPoint.at(i) + 1);
+            }
+            else
+            {
+                for (size_t j = 0; j < parameterValues.at(i).size(); j++)
+                {
+                    targets.push_back(j);
+                }
+            }
+
+            for (const auto target : targets)
+            {
+                if (target == centerPoint.at(i) || target >= parameterValues.at(i).size())
+                {
+                    continue;
+                }
+
+                std::vector<size_t> point = centerPoint;
+                point.at(i) = target;
+                auto pointPointer = pointIndices.find(point);
+                if (pointPointer != pointIndices.end() && !explored.at(pointPointer->second))
+                {
+                    neighbours.push_back(pointPointer->second);
+                }
+            }
+        }
+
+        const size_t bottleneck = getDominantBottleneck(metrics.at(center));
+        std::vector<std::pair<double, size_t>> scoredNeighbours;
+        for (const auto neighbour : neighbours)
+        {
+            double score;
+            if (bottleneck < metricCount && metricModels.at(bottleneck).getMeasurementCount() > 1)
+            {
+                score = metricModels.at(bottleneck).predict(points.at(neighbour));
+            }
+            else
+            {
+                score = objectiveModel.predict(points.at(neighbour));
+            }
+            scoredNeighbours.push_back(std::make_pair(score, neighbour));
+        }
+
+        std::sort(scoredNeighbours.begin(), scoredNeighbours.end());
+        for (const auto& scoredNeighbour : scoredNeighbours)
+        {
+            candidateIndices.push_back(scoredNeighbour.second);
+        }
+    }
+
+    // Returns metricCount if no metric exceeds its reference level
+    static size_t getDominantBottleneck(const std::vector<double>& configurationMetrics)
+    {
+        const double references[metricCount] = {cacheMissRateReference, branchMissRateReference, cyclesPerInstructionReference};
+        size_t bottleneck = metricCount;
+        double highestRatio = 1.0;
+
+        for (size_t i = 0; i < configurationMetrics.size(); i++)
+        {
+            double ratio = configurationMetrics.at(i) / references[i];
+            if (ratio > highestRatio)
+            {
+                highestRatio = ratio;
+                bottleneck = i;
+            }
+        }
+
+        return bottleneck;
+    }
+
+    // Cache miss rate, branch miss rate and cycles per instruction, empty if counters were not collected
+    static std::vector<double> getMetrics(const std::map<std::string, uint64_t>& counters)
+    {
+        auto getCounter = [&counters](const std::string& name)
+        {
+            auto counterPointer = counters.find(name);
+            return counterPointer == counters.end() ? 0.0 : static_cast<double>(counterPointer->second);
+        };
+
+        const double cacheReferences = getCounter("Cache references");
+        const double branches = getCounter("Branches");
+        const double instructions = getCounter("Instructions");
+        if (cacheReferences == 0.0 || branches == 0.0 || instructions == 0.0)
+        {
+            return std::vector<double>{};
+        }
+
+        return std::vector<double>{getCounter("Cache misses") / cacheReferences, getCounter("Branch misses") / branches,
+            getCounter("Cycles") / instructions};
+    }
+
+    std::vector<size_t> getPoint(const KernelConfiguration& configuration) const
+    {
+        std::vector<size_t> point(parameterNames.size(), 0);
+        for (const auto& parameterPair : configuration.getParameterPairs())
+        {
+            for (size_t i = 0; i < parameterNames.size(); i++)
+            {
+                if (std::get<0>(parameterPair) != parameterNames.at(i))
+                {
+                    continue;
+                }
+
+                const std::vector<size_t>& values = parameterValues.at(i);
+                point.at(i) = static_cast<size_t>(std::find(values.begin(), values.end(), std::get<1>(parameterPair)) - values.begin());
+                break;
+            }
+        }
+        return point;
+    }
+};
+
+} // namespace ktt
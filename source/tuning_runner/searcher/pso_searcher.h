@@ -1,10 +1,9 @@
 #pragma once
 
 #include <algorithm>
-#include <chrono>
 #include <limits>
 #include <random>
-#include "searcher.h"
+#include "api/searcher.h"
 #include "kernel/kernel_parameter.h"
 
 namespace ktt
@@ -14,7 +13,7 @@ class PSOSearcher : public Searcher
 {
 public:
     PSOSearcher(const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters, const double fraction,
-        const size_t swarmSize, const double influenceGlobal, const double influenceLocal, const double influenceRandom) :
+        const size_t swarmSize, const double influenceGlobal, const double influenceLocal, const double influenceRandom, const unsigned int randomSeed) :
         configurations(configurations),
         parameters(parameters),
         fraction(fraction),
@@ -25,12 +24,13 @@ public:
         executionTimes(configurations.size(), std::numeric_limits<double>::max()),
         particleIndex(0),
         particlePositions(swarmSize),
+        pendingParticles(swarmSize, false),
         globalBestTime(std::numeric_limits<double>::max()),
         localBestTimes(swarmSize, std::numeric_limits<double>::max()),
         globalBestConfiguration(DimensionVector(), DimensionVector(), std::vector<ParameterPair>{}),
         localBestConfigurations(swarmSize, KernelConfiguration(DimensionVector(), DimensionVector(), std::vector<ParameterPair>{})),
-        generator(static_cast<unsigned int>(std::chrono::system_clock::now().time_since_epoch().count())),
-        intDistribution(0, static_cast<int>(configurations.size())),
+        generator(randomSeed),
+        intDistribution(0, static_cast<int>(configurations.size()) - 1),
         probabilityDistribution(0.0, 1.0)
     {
         if (configurations.size() == 0)
@@ -49,52 +49,89 @@ public:
         return configurations.at(index);
     }
 
-    void calculateNextConfiguration(const double previousConfigurationDuration) override
+    void calculateNextConfiguration(const TuningResult& previousResult) override
     {
-        exploredIndices.push_back(index);
-        executionTimes.at(index) = previousConfigurationDuration;
-        if (previousConfigurationDuration < localBestTimes.at(particleIndex))
+        double previousConfigurationDuration = std::numeric_limits<double>::max();
+        if (previousResult.isValid())
         {
-            localBestTimes.at(particleIndex) = previousConfigurationDuration;
-            localBestConfigurations.at(particleIndex) = configurations.at(index);
+            previousConfigurationDuration = previousResult.getObjectiveValue();
         }
-        if (previousConfigurationDuration < globalBestTime)
+
+        updateParticle(particleIndex, previousConfigurationDuration);
+
+        particleIndex++;
+        if (particleIndex == swarmSize)
         {
-            globalBestTime = previousConfigurationDuration;
-            globalBestConfiguration = configurations.at(index);
+            particleIndex = 0;
         }
-        
-        auto newIndex = index;
-        do
+        index = particlePositions[particleIndex];
+    }
+
+    // Batch of configurations contains current positions of all particles whose results are not pending
+    std::vector<KernelConfiguration> getNextConfigurationBatch(const size_t maximumCount) override
+    {
+        std::vector<KernelConfiguration> batch;
+        for (size_t i = 0; i < swarmSize && batch.size() < maximumCount; i++)
         {
-            auto nextConfiguration = configurations.at(index);
-            for (size_t i = 0; i < nextConfiguration.getParameterPairs().size(); i++)
+            if (!pendingParticles.at(i))
             {
-                if (probabilityDistribution(generator) <= influenceGlobal)
-                {
-                    nextConfiguration.parameterPairs.at(i) = globalBestConfiguration.getParameterPairs().at(i);
-                }
-                else if (probabilityDistribution(generator) <= influenceLocal)
-                {
-                    nextConfiguration.parameterPairs.at(i) = localBestConfigurations.at(particleIndex).getParameterPairs().at(i);
-                }
-                else if (probabilityDistribution(generator) <= influenceRandom)
+                pendingParticles.at(i) = true;
+                batch.push_back(configurations.at(particlePositions.at(i)));
+            }
+        }
+        return batch;
+    }
+
+    void processBatchResult(const TuningResult& result) override
+    {
+        size_t resultIndex = indexFromConfiguration(result.getConfiguration());
+        for (size_t i = 0; i < swarmSize; i++)
+        {
+            if (pendingParticles.at(i) && particlePositions.at(i) == resultIndex)
+            {
+                double duration = std::numeric_limits<double>::max();
+                if (result.isValid())
                 {
-                    std::uniform_int_distribution<size_t> distribution(0, parameters.at(i).getValues().size());
-                    std::get<1>(nextConfiguration.parameterPairs.at(i)) = parameters.at(i).getValues().at(distribution(generator));
+                    duration = result.getObjectiveValue();
                 }
+                pendingParticles.at(i) = false;
+                updateParticle(i, duration);
+                return;
             }
-            newIndex = indexFromConfiguration(nextConfiguration);
         }
-        while (newIndex >= configurations.size());
-        particlePositions.at(particleIndex) = newIndex;
+    }
 
-        particleIndex++;
-        if (particleIndex == swarmSize)
+    // Particles which had invalidated configuration as their best forget it, global best is selected again from remaining results
+    void invalidateResult(const TuningResult& result) override
+    {
+        const size_t resultIndex = indexFromConfiguration(result.getConfiguration());
+        if (resultIndex >= configurations.size() || executionTimes.at(resultIndex) == std::numeric_limits<double>::max())
         {
-            particleIndex = 0;
+            return;
+        }
+        executionTimes.at(resultIndex) = std::numeric_limits<double>::max();
+
+        for (size_t i = 0; i < swarmSize; i++)
+        {
+            if (localBestTimes.at(i) != std::numeric_limits<double>::max()
+                && indexFromConfiguration(localBestConfigurations.at(i)) == resultIndex)
+            {
+                localBestTimes.at(i) = std::numeric_limits<double>::max();
+            }
+        }
+
+        if (globalBestTime != std::numeric_limits<double>::max() && indexFromConfiguration(globalBestConfiguration) == resultIndex)
+        {
+            globalBestTime = std::numeric_limits<double>::max();
+            for (size_t i = 0; i < configurations.size(); i++)
+            {
+                if (executionTimes.at(i) < globalBestTime)
+                {
+                    globalBestTime = executionTimes.at(i);
+                    globalBestConfiguration = configurations.at(i);
+                }
+            }
         }
-        index = particlePositions[particleIndex];
     }
 
     size_t getConfigurationsCount() const override
@@ -116,6 +153,7 @@ private:
     size_t index;
     size_t particleIndex;
     std::vector<size_t> particlePositions;
+    std::vector<bool> pendingParticles;
 
     double globalBestTime;
     std::vector<double> localBestTimes;
@@ -126,7 +164,50 @@ private:
     std::uniform_int_distribution<int> intDistribution;
     std::uniform_real_distribution<double> probabilityDistribution;
 
-    // Helper method
+    // Helper methods
+    void updateParticle(const size_t particle, const double duration)
+    {
+        size_t position = particlePositions.at(particle);
+        exploredIndices.push_back(position);
+        executionTimes.at(position) = duration;
+        if (duration < localBestTimes.at(particle))
+        {
+            localBestTimes.at(particle) = duration;
+            localBestConfigurations.at(particle) = configurations.at(position);
+        }
+        if (duration < globalBestTime)
+        {
+            globalBestTime = duration;
+            globalBestConfiguration = configurations.at(position);
+        }
+
+        auto newIndex = position;
+        do
+        {
+            // Best configurations are empty until particle or swarm receives a valid result
+            auto nextConfiguration = configurations.at(position);
+            for (size_t i = 0; i < nextConfiguration.getParameterPairs().size(); i++)
+            {
+                if (probabilityDistribution(generator) <= influenceGlobal && globalBestTime < std::numeric_limits<double>::max())
+                {
+                    nextConfiguration.parameterPairs.at(i) = globalBestConfiguration.getParameterPairs().at(i);
+                }
+                else if (probabilityDistribution(generator) <= influenceLocal && localBestTimes.at(particle) < std::numeric_limits<double>::max())
+                {
+                    nextConfiguration.parameterPairs.at(i) = localBestConfigurations.at(particle).getParameterPairs().at(i);
+                }
+                else if (probabilityDistribution(generator) <= influenceRandom)
+                {
+                    std::uniform_int_distribution<size_t> distribution(0, parameters.at(i).getValues().size() - 1);
+                    std::get<1>(nextConfiguration.parameterPairs.at(i)) = parameters.at(i).getValues().at(distribution(generator));
+                }
+            }
+            newIndex = indexFromConfiguration(nextConfiguration);
+        }
+        while (newIndex >= configurations.size());
+        particlePositions.at(particle) = newIndex;
+    }
+
     size_t indexFromConfiguration(const KernelConfiguration& target) const
     {
         size_t configurationIndex = 0;
@@ -2,7 +2,7 @@
 
 #include <algorithm>
 #include <random>
-#include "searcher.h"
+#include "api/searcher.h"
 
 namespace ktt
 {
@@ -10,7 +10,7 @@ namespace ktt
 class RandomSearcher : public Searcher
 {
 public:
-    RandomSearcher(const std::vector<KernelConfiguration>& configurations, const double fraction) :
+    RandomSearcher(const std::vector<KernelConfiguration>& configurations, const double fraction, const unsigned int randomSeed) :
         configurations(configurations),
         index(0),
         fraction(fraction)
@@ -20,8 +20,7 @@ public:
             throw std::runtime_error("Configurations vector provided for searcher is empty");
         }
 
-        std::random_device device;
-        std::default_random_engine engine(device());
+        std::default_random_engine engine(randomSeed);
         std::shuffle(std::begin(this->configurations), std::end(this->configurations), engine);
     }
 
@@ -30,11 +29,25 @@ public:
         return configurations.at(index);
     }
 
-    void calculateNextConfiguration(const double) override
+    void calculateNextConfiguration(const TuningResult&) override
     {
         index++;
     }
 
+    std::vector<KernelConfiguration> getNextConfigurationBatch(const size_t maximumCount) override
+    {
+        std::vector<KernelConfiguration> batch;
+        while (batch.size() < maximumCount && index < getConfigurationsCount())
+        {
+            batch.push_back(configurations.at(index));
+            index++;
+        }
+        return batch;
+    }
+
+    void processBatchResult(const TuningResult&) override
+    {}
+
     size_t getConfigurationsCount() const override
     {
         return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
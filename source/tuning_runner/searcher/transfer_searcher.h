@@ -0,0 +1,277 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include "api/searcher.h"
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+class TransferSearcher : public Searcher
+{
+public:
+    static constexpr double explorationProbability = 0.1;
+
+    TransferSearcher(const std::vector<KernelConfiguration>& configurations, const std::vector<TuningResult>& priorResults, const double fraction,
+        const size_t seedCount, const unsigned int randomSeed) :
+        configurations(configurations),
+        index(0),
+        fraction(fraction),
+        seedIndex(0),
+        priorDurations(configurations.size(), std::numeric_limits<double>::max()),
+        durationSums(configurations.size(), 0.0),
+        durationWeights(configurations.size(), 0.0),
+        correctionSums(configurations.size(), 0.0),
+        correctionWeights(configurations.size(), 0.0),
+        measuredDurations(configurations.size(), std::numeric_limits<double>::max()),
+        explored(configurations.size(), false),
+        generator(randomSeed),
+        intDistribution(0, static_cast<int>(configurations.size()) - 1),
+        probabilityDistribution(0.0, 1.0)
+    {
+        if (configurations.size() == 0)
+        {
+            throw std::runtime_error("Configurations vector provided for searcher is empty");
+        }
+
+        std::map<std::vector<size_t>, size_t> indices;
+        for (const auto& configuration : configurations)
+        {
+            std::vector<size_t> values;
+            for (const auto& parameterPair : configuration.getParameterPairs())
+            {
+                values.push_back(std::get<1>(parameterPair));
+            }
+            indices.insert(std::make_pair(values, parameterValues.size()));
+            parameterValues.push_back(values);
+        }
+
+        for (const auto& result : priorResults)
+        {
+            size_t priorIndex = matchConfiguration(result.getConfiguration(), indices);
+            if (priorIndex < configurations.size())
+            {
+                priorDurations.at(priorIndex) = std::min(priorDurations.at(priorIndex), result.getObjectiveValue());
+            }
+        }
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            if (priorDurations.at(i) != std::numeric_limits<double>::max())
+            {
+                seeds.push_back(i);
+            }
+        }
+        std::sort(seeds.begin(), seeds.end(), [this](const size_t first, const size_t second)
+        {
+            return priorDurations.at(first) < priorDurations.at(second);
+        });
+        seeds.resize(std::min(seeds.size(), seedCount));
+
+        index = selectNextIndex();
+    }
+
+    KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const TuningResult& previousResult) override
+    {
+        explored.at(index) = true;
+        if (previousResult.isValid() && previousResult.getObjectiveValue() > 0.0)
+        {
+            measuredDurations.at(index) = previousResult.getObjectiveValue();
+            updateModel(index, measuredDurations.at(index), 1.0);
+        }
+        index = selectNextIndex();
+    }
+
+    void invalidateResult(const TuningResult& result) override
+    {
+        std::vector<size_t> values;
+        for (const auto& parameterPair : result.getConfiguration().getParameterPairs())
+        {
+            values.push_back(std::get<1>(parameterPair));
+        }
+
+        const size_t resultIndex = static_cast<size_t>(std::find(parameterValues.begin(), parameterValues.end(), values)
+            - parameterValues.begin());
+        if (resultIndex == parameterValues.size() || measuredDurations.at(resultIndex) == std::numeric_limits<double>::max())
+        {
+            return;
+        }
+
+        updateModel(resultIndex, measuredDurations.at(resultIndex), -1.0);
+        measuredDurations.at(resultIndex) = std::numeric_limits<double>::max();
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return std::max(static_cast<size_t>(1), std::min(configurations.size(), static_cast<size_t>(configurations.size() * fraction)));
+    }
+
+private:
+    std::vector<KernelConfiguration> configurations;
+    std::vector<std::vector<size_t>> parameterValues;
+    size_t index;
+    double fraction;
+    std::vector<size_t> seeds;
+    size_t seedIndex;
+
+    std::vector<double> priorDurations;
+    std::vector<double> durationSums;
+    std::vector<double> durationWeights;
+    std::vector<double> correctionSums;
+    std::vector<double> correctionWeights;
+    std::vector<double> measuredDurations;
+    std::vector<bool> explored;
+
+    std::default_random_engine generator;
+    std::uniform_int_distribution<int> intDistribution;
+    std::uniform_real_distribution<double> probabilityDistribution;
+
+    // Helper methods
+    size_t matchConfiguration(const KernelConfiguration& priorConfiguration, const std::map<std::vector<size_t>, size_t>& indices) const
+    {
+        std::vector<ParameterPair> priorPairs = priorConfiguration.getParameterPairs();
+        std::vector<size_t> values;
+
+        for (const auto& parameterPair : configurations.at(0).getParameterPairs())
+        {
+            auto pairPointer = std::find_if(priorPairs.cbegin(), priorPairs.cend(), [&parameterPair](const ParameterPair& priorPair)
+            {
+                return std::get<0>(priorPair) == std::get<0>(parameterPair);
+            });
+
+            if (pairPointer == priorPairs.cend())
+            {
+                return configurations.size();
+            }
+            values.push_back(std::get<1>(*pairPointer));
+        }
+
+        auto indexPointer = indices.find(values);
+        if (indexPointer == indices.end())
+        {
+            return configurations.size();
+        }
+        return indexPointer->second;
+    }
+
+    // Measured durations are propagated to all configurations, weighted by number of matching parameter values. Configurations with prior
+    // result use measured ratio between current and prior duration as a correction, other configurations use measured durations directly.
+    // Measurement is removed from the model with negative sign.
+    void updateModel(const size_t measuredIndex, const double duration, const double sign)
+    {
+        const auto& measuredValues = parameterValues.at(measuredIndex);
+        const bool priorKnown = priorDurations.at(measuredIndex) != std::numeric_limits<double>::max();
+        const double logDuration = std::log(duration);
+        const double logCorrection = priorKnown ? std::log(duration / priorDurations.at(measuredIndex)) : 0.0;
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            int differences = 0;
+            for (size_t j = 0; j < measuredValues.size(); j++)
+            {
+                if (parameterValues.at(i).at(j) != measuredValues.at(j))
+                {
+                    differences++;
+                }
+            }
+
+            double weight = sign * std::ldexp(1.0, -differences);
+            durationSums.at(i) += weight * logDuration;
+            durationWeights.at(i) += weight;
+
+            if (priorKnown)
+            {
+                correctionSums.at(i) += weight * logCorrection;
+                correctionWeights.at(i) += weight;
+            }
+        }
+    }
+
+    double getPredictedDuration(const size_t configurationIndex) const
+    {
+        if (priorDurations.at(configurationIndex) != std::numeric_limits<double>::max())
+        {
+            if (correctionWeights.at(configurationIndex) == 0.0)
+            {
+                return priorDurations.at(configurationIndex);
+            }
+            return priorDurations.at(configurationIndex)
+                * std::exp(correctionSums.at(configurationIndex) / correctionWeights.at(configurationIndex));
+        }
+
+        if (durationWeights.at(configurationIndex) == 0.0)
+        {
+            return std::numeric_limits<double>::max();
+        }
+        return std::exp(durationSums.at(configurationIndex) / durationWeights.at(configurationIndex));
+    }
+
+    size_t selectNextIndex()
+    {
+        while (seedIndex < seeds.size())
+        {
+            size_t seed = seeds.at(seedIndex);
+            seedIndex++;
+            if (!explored.at(seed))
+            {
+                return seed;
+            }
+        }
+
+        if (probabilityDistribution(generator) >= explorationProbability)
+        {
+            size_t bestIndex = configurations.size();
+            double bestDuration = std::numeric_limits<double>::max();
+
+            for (size_t i = 0; i < configurations.size(); i++)
+            {
+                if (explored.at(i))
+                {
+                    continue;
+                }
+
+                double predictedDuration = getPredictedDuration(i);
+                if (predictedDuration < bestDuration)
+                {
+                    bestDuration = predictedDuration;
+                    bestIndex = i;
+                }
+            }
+
+            if (bestIndex != configurations.size())
+            {
+                return bestIndex;
+            }
+        }
+
+        return getRandomUnexploredIndex();
+    }
+
+    size_t getRandomUnexploredIndex()
+    {
+        size_t start = static_cast<size_t>(intDistribution(generator));
+
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            size_t candidate = (start + i) % configurations.size();
+            if (!explored.at(candidate))
+            {
+                return candidate;
+            }
+        }
+
+        return start;
+    }
+};
+
+} // namespace ktt
@@ -0,0 +1,118 @@
+#include <stdexcept>
+#include "stop_condition.h"
+
+namespace ktt
+{
+
+StopCondition::StopCondition() :
+    elapsedTime(0),
+    failedConfigurationsCount(0),
+    configurationsWithoutImprovementCount(0),
+    bestDuration(UINT64_MAX)
+{}
+
+void StopCondition::setCriterion(const StopCriterion& criterion, const double value)
+{
+    if (value < 0.0)
+    {
+        throw std::runtime_error("Stop condition value cannot be negative");
+    }
+    criteria[criterion] = value;
+}
+
+void StopCondition::clearCriteria()
+{
+    criteria.clear();
+}
+
+void StopCondition::initialize()
+{
+    elapsedTime = 0;
+    failedConfigurationsCount = 0;
+    configurationsWithoutImprovementCount = 0;
+    bestDuration = UINT64_MAX;
+    timer.start();
+}
+
+void StopCondition::updateStatus(const bool validResult, const uint64_t duration)
+{
+    timer.stop();
+    elapsedTime = timer.getElapsedTime();
+
+    if (!validResult)
+    {
+        failedConfigurationsCount++;
+        configurationsWithoutImprovementCount++;
+        return;
+    }
+
+    if (duration < bestDuration)
+    {
+        bestDuration = duration;
+        configurationsWithoutImprovementCount = 0;
+    }
+    else
+    {
+        configurationsWithoutImprovementCount++;
+    }
+}
+
+bool StopCondition::isSatisfied() const
+{
+    for (const auto& criterion : criteria)
+    {
+        if (isCriterionSatisfied(criterion.first, criterion.second))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+std::string StopCondition::getStatusString() const
+{
+    for (const auto& criterion : criteria)
+    {
+        if (isCriterionSatisfied(criterion.first, criterion.second))
+        {
+            return getCriterionString(criterion.first, criterion.second);
+        }
+    }
+    return std::string("All configurations provided by search method were explored");
+}
+
+bool StopCondition::isCriterionSatisfied(const StopCriterion& criterion, const double value) const
+{
+    switch (criterion)
+    {
+    case StopCriterion::TuningDuration:
+        return static_cast<double>(elapsedTime) / 1'000'000'000.0 >= value;
+    case StopCriterion::FailedConfigurations:
+        return static_cast<double>(failedConfigurationsCount) >= value;
+    case StopCriterion::ConfigurationsWithoutImprovement:
+        return static_cast<double>(configurationsWithoutImprovementCount) >= value;
+    case StopCriterion::TargetDuration:
+        return bestDuration != UINT64_MAX && static_cast<double>(bestDuration) <= value;
+    default:
+        throw std::runtime_error("Unknown stop criterion");
+    }
+}
+
+std::string StopCondition::getCriterionString(const StopCriterion& criterion, const double value)
+{
+    switch (criterion)
+    {
+    case StopCriterion::TuningDuration:
+        return std::string("Tuning duration limit of ") + std::to_string(value) + "s was reached";
+    case StopCriterion::FailedConfigurations:
+        return std::string("Limit of ") + std::to_string(static_cast<size_t>(value)) + " failed configurations was reached";
+    case StopCriterion::ConfigurationsWithoutImprovement:
+        return std::string("No improvement was found within last ") + std::to_string(static_cast<size_t>(value)) + " configurations";
+    case StopCriterion::TargetDuration:
+        return std::string("Target duration of ") + std::to_string(static_cast<uint64_t>(value)) + "ns was reached";
+    default:
+        throw std::runtime_error("Unknown stop criterion");
+    }
+}
+
+} // namespace ktt
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include "enum/stop_criterion.h"
+#include "utility/timer.h"
+
+namespace ktt
+{
+
+class StopCondition
+{
+public:
+    // Constructor
+    StopCondition();
+
+    // Core methods
+    void setCriterion(const StopCriterion& criterion, const double value);
+    void clearCriteria();
+    void initialize();
+    void updateStatus(const bool validResult, const uint64_t duration);
+
+    // Getters
+    bool isSatisfied() const;
+    std::string getStatusString() const;
+
+private:
+    // Attributes
+    std::map<StopCriterion, double> criteria;
+    Timer timer;
+    uint64_t elapsedTime;
+    size_t failedConfigurationsCount;
+    size_t configurationsWithoutImprovementCount;
+    uint64_t bestDuration;
+
+    // Helper methods
+    bool isCriterionSatisfied(const StopCriterion& criterion, const double value) const;
+    static std::string getCriterionString(const StopCriterion& criterion, const double value);
+};
+
+} // namespace ktt
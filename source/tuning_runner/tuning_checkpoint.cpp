@@ -0,0 +1,246 @@
+#include <iomanip>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include "tuning_checkpoint.h"
+
+namespace ktt
+{
+
+static const std::string checkpointHeader("KTT tuning checkpoint");
+static const std::string entryTerminator("end");
+
+TuningCheckpoint::TuningCheckpoint() :
+    searchSeed(0)
+{}
+
+void TuningCheckpoint::create(const std::string& filePath, const std::string& kernelName, const unsigned int searchSeed)
+{
+    journal.close();
+    journal.open(filePath, std::ios::out | std::ios::trunc);
+    if (!journal.is_open())
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+
+    this->searchSeed = searchSeed;
+    recordedResults.clear();
+    journal << checkpointHeader << "," << kernelName << "," << searchSeed << std::endl;
+}
+
+void TuningCheckpoint::load(const std::string& filePath, const std::string& kernelName)
+{
+    std::string content;
+    {
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open())
+        {
+            throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+        }
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::istringstream stream(content);
+    std::string line;
+    std::vector<std::string> header;
+    if (std::getline(stream, line))
+    {
+        header = splitLine(line);
+    }
+    if (header.size() != 3 || header.at(0) != checkpointHeader)
+    {
+        throw std::runtime_error(std::string("File is not a KTT tuning checkpoint: ") + filePath);
+    }
+    if (header.at(1) != kernelName)
+    {
+        throw std::runtime_error(std::string("Checkpoint file ") + filePath + " does not belong to kernel: " + kernelName);
+    }
+
+    searchSeed = static_cast<unsigned int>(std::stoul(header.at(2)));
+    recordedResults.clear();
+
+    while (std::getline(stream, line))
+    {
+        // Last entry may be incomplete if the process was terminated while writing it
+        try
+        {
+            TuningResult result = deserializeResult(line, kernelName);
+            recordedResults.insert(std::make_pair(result.getConfiguration().getParameterPairs(), result));
+        }
+        catch (const std::exception&)
+        {
+            continue;
+        }
+    }
+
+    journal.close();
+    journal.open(filePath, std::ios::out | std::ios::app);
+    if (!journal.is_open())
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+    if (!content.empty() && content.back() != '\n')
+    {
+        journal << std::endl;
+    }
+}
+
+void TuningCheckpoint::appendResult(const TuningResult& result)
+{
+    if (!journal.is_open())
+    {
+        return;
+    }
+
+    // Entry is flushed immediately, so that it survives crash of the tuning process
+    journal << serializeResult(result) << std::endl;
+}
+
+bool TuningCheckpoint::restoreResult(const KernelConfiguration& configuration, TuningResult& result) const
+{
+    auto resultPointer = recordedResults.find(configuration.getParameterPairs());
+    if (resultPointer == recordedResults.end())
+    {
+        return false;
+    }
+
+    result = resultPointer->second;
+    result.setConfiguration(configuration);
+    return true;
+}
+
+bool TuningCheckpoint::isOpen() const
+{
+    return journal.is_open();
+}
+
+unsigned int TuningCheckpoint::getSearchSeed() const
+{
+    return searchSeed;
+}
+
+size_t TuningCheckpoint::getRecordedResultCount() const
+{
+    return recordedResults.size();
+}
+
+std::string TuningCheckpoint::serializeResult(const TuningResult& result)
+{
+    std::stringstream stream;
+    stream << std::setprecision(std::numeric_limits<double>::max_digits10);
+    stream << (result.isValid() ? 1 : 0) << "," << result.getKernelDuration() << "," << result.getManipulatorDuration() << ","
+        << result.getCompilationDuration() << "," << result.getMaximumError() << "," << result.getWorkGroupMemory() << ","
+        << (result.hasCustomObjective() ? 1 : 0) << "," << result.getObjectiveValue();
+
+    stream << "," << result.getKernelDurationSamples().size();
+    for (const auto sample : result.getKernelDurationSamples())
+    {
+        stream << "," << sample;
+    }
+
+    std::vector<ParameterPair> parameterPairs = result.getConfiguration().getParameterPairs();
+    stream << "," << parameterPairs.size();
+    for (const auto& parameterPair : parameterPairs)
+    {
+        stream << "," << std::get<0>(parameterPair) << "," << std::get<1>(parameterPair);
+    }
+
+    stream << "," << result.getDeviceId() << "," << escapeText(result.getDeviceName()) << "," << escapeText(result.getStatusMessage()) << ","
+        << entryTerminator;
+    return stream.str();
+}
+
+TuningResult TuningCheckpoint::deserializeResult(const std::string& line, const std::string& kernelName)
+{
+    std::vector<std::string> values = splitLine(line);
+    if (values.size() < 13 || values.back() != entryTerminator)
+    {
+        throw std::runtime_error("Incomplete checkpoint entry");
+    }
+
+    size_t position = 8;
+    const size_t sampleCount = std::stoull(values.at(position++));
+    if (values.size() < position + sampleCount + 5)
+    {
+        throw std::runtime_error("Incomplete checkpoint entry");
+    }
+
+    std::vector<uint64_t> samples;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        samples.push_back(std::stoull(values.at(position++)));
+    }
+
+    const size_t parameterCount = std::stoull(values.at(position++));
+    if (values.size() != position + 2 * parameterCount + 4)
+    {
+        throw std::runtime_error("Incomplete checkpoint entry");
+    }
+
+    std::vector<ParameterPair> parameterPairs;
+    for (size_t i = 0; i < parameterCount; i++)
+    {
+        parameterPairs.push_back(ParameterPair(values.at(position), std::stoull(values.at(position + 1))));
+        position += 2;
+    }
+
+    TuningResult result(kernelName, KernelConfiguration(DimensionVector(), DimensionVector(), parameterPairs), values.at(position + 2));
+    result.setDevice(std::stoull(values.at(position)), values.at(position + 1));
+    if (!samples.empty())
+    {
+        result.setKernelDurationSamples(samples, DurationStatistic::Median);
+    }
+    result.setKernelDuration(std::stoull(values.at(1)));
+    result.setManipulatorDuration(std::stoull(values.at(2)));
+    result.setCompilationDuration(std::stoull(values.at(3)));
+    result.setMaximumError(std::stod(values.at(4)));
+    result.setWorkGroupMemory(std::stoull(values.at(5)));
+    if (values.at(6) == "1")
+    {
+        result.setObjectiveValue(std::stod(values.at(7)));
+    }
+    result.setValid(values.at(0) == "1");
+    return result;
+}
+
+std::string TuningCheckpoint::escapeText(const std::string& text)
+{
+    std::string result = text;
+    for (auto& character : result)
+    {
+        if (character == ',')
+        {
+            character = ';';
+        }
+        else if (character == '\n' || character == '\r')
+        {
+            character = ' ';
+        }
+    }
+    return result;
+}
+
+std::vector<std::string> TuningCheckpoint::splitLine(const std::string& line)
+{
+    std::vector<std::string> result;
+    std::string current;
+
+    for (const auto character : line)
+    {
+        if (character == ',')
+        {
+            result.push_back(current);
+            current.clear();
+        }
+        else if (character != '\r')
+        {
+            current += character;
+        }
+    }
+    result.push_back(current);
+
+    return result;
+}
+
+} // namespace ktt
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+// Append-only journal of tuning results, which is flushed after every evaluated configuration. Journal starts with a header containing
+// kernel name and search seed, so that tuning can be resumed with identical searcher state by replaying recorded results.
+class TuningCheckpoint
+{
+public:
+    // Constructor
+    TuningCheckpoint();
+
+    // Core methods
+    void create(const std::string& filePath, const std::string& kernelName, const unsigned int searchSeed);
+    void load(const std::string& filePath, const std::string& kernelName);
+    void appendResult(const TuningResult& result);
+    bool restoreResult(const KernelConfiguration& configuration, TuningResult& result) const;
+
+    // Getters
+    bool isOpen() const;
+    unsigned int getSearchSeed() const;
+    size_t getRecordedResultCount() const;
+
+    // Serialization of results into a single line, restored results contain only parameters of configuration
+    static std::string serializeResult(const TuningResult& result);
+    static TuningResult deserializeResult(const std::string& line, const std::string& kernelName);
+
+private:
+    // Attributes
+    std::ofstream journal;
+    unsigned int searchSeed;
+    std::map<std::vector<ParameterPair>, TuningResult> recordedResults;
+
+    // Helper methods
+    static std::string escapeText(const std::string& text);
+    static std::vector<std::string> splitLine(const std::string& line);
+};
+
+} // namespace ktt
@@ -0,0 +1,354 @@
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include "tuning_checkpoint.h"
+#include "tuning_coordinator.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <cstring>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+#define KTT_TUNING_COORDINATOR_SUPPORT
+#endif
+
+namespace ktt
+{
+
+#ifdef KTT_TUNING_COORDINATOR_SUPPORT
+
+TuningCoordinator::TuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize, Logger* logger) :
+    listeningDescriptor(-1),
+    port(port),
+    batchSize(batchSize),
+    logger(logger)
+{
+    if (batchSize == 0)
+    {
+        throw std::runtime_error("Batch size of tuning coordinator must be greater than zero");
+    }
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port);
+    if (inet_pton(AF_INET, bindAddress.c_str(), &address.sin_addr) != 1)
+    {
+        throw std::runtime_error(std::string("Invalid bind address of tuning coordinator: ") + bindAddress);
+    }
+
+    listeningDescriptor = socket(AF_INET, SOCK_STREAM, 0);
+    if (listeningDescriptor < 0)
+    {
+        throw std::runtime_error(std::string("Unable to create socket for tuning coordinator: ") + std::strerror(errno));
+    }
+
+    int enabled = 1;
+    setsockopt(listeningDescriptor, SOL_SOCKET, SO_REUSEADDR, &enabled, sizeof(enabled));
+
+    if (bind(listeningDescriptor, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || listen(listeningDescriptor, SOMAXCONN) != 0)
+    {
+        std::string reason = std::strerror(errno);
+        close(listeningDescriptor);
+        throw std::runtime_error(std::string("Unable to listen on ") + bindAddress + ":" + std::to_string(port) + " for tuning workers: "
+            + reason);
+    }
+
+    socklen_t addressLength = sizeof(address);
+    if (getsockname(listeningDescriptor, reinterpret_cast<sockaddr*>(&address), &addressLength) == 0)
+    {
+        this->port = ntohs(address.sin_port);
+    }
+}
+
+TuningCoordinator::~TuningCoordinator()
+{
+    close(listeningDescriptor);
+}
+
+bool TuningCoordinator::isSupported()
+{
+    return true;
+}
+
+void TuningCoordinator::coordinate(const std::string& kernelName,
+    const std::function<std::vector<KernelConfiguration>(const size_t)>& getBatch, const std::function<void(const TuningResult&)>& processResult)
+{
+    std::vector<ConnectedWorker> workers;
+    std::deque<KernelConfiguration> requeuedConfigurations;
+    std::map<std::vector<ParameterPair>, size_t> failedAttempts;
+    size_t nextWorkerId = 0;
+    logger->log(std::string("Waiting for workers of kernel <") + kernelName + "> on port " + std::to_string(port));
+
+    auto disconnectWorker = [this, &kernelName, &requeuedConfigurations, &failedAttempts, &processResult](ConnectedWorker& worker)
+    {
+        std::vector<KernelConfiguration>& outstanding = worker.outstandingConfigurations;
+        if (!worker.registered)
+        {
+            return;
+        }
+        logger->log(std::string("Worker ") + std::to_string(worker.id) + " disconnected, " + std::to_string(outstanding.size())
+            + " configurations are given to other workers");
+
+        // Worker measures configurations in order, so only the first outstanding configuration could have caused its termination
+        for (size_t i = outstanding.size(); i > 0; i--)
+        {
+            const KernelConfiguration& configuration = outstanding.at(i - 1);
+            if (i == 1 && ++failedAttempts[configuration.getParameterPairs()] >= maximumAttempts)
+            {
+                processResult(TuningResult(kernelName, configuration, "Failed kernel run: worker terminated while running configuration "
+                    + std::to_string(maximumAttempts) + " times"));
+                continue;
+            }
+            requeuedConfigurations.push_front(configuration);
+        }
+        outstanding.clear();
+    };
+
+    while (true)
+    {
+        bool workerRegistered = false;
+        bool configurationsOutstanding = false;
+
+        for (auto& worker : workers)
+        {
+            if (!worker.registered)
+            {
+                continue;
+            }
+            workerRegistered = true;
+
+            if (worker.outstandingConfigurations.empty())
+            {
+                std::vector<KernelConfiguration> batch;
+                while (batch.size() < batchSize && !requeuedConfigurations.empty())
+                {
+                    batch.push_back(requeuedConfigurations.front());
+                    requeuedConfigurations.pop_front();
+                }
+                if (batch.size() < batchSize)
+                {
+                    std::vector<KernelConfiguration> nextBatch = getBatch(batchSize - batch.size());
+                    batch.insert(batch.end(), nextBatch.begin(), nextBatch.end());
+                }
+
+                // Failed send is detected as closed connection when the channel is polled
+                if (!batch.empty())
+                {
+                    worker.outstandingConfigurations = batch;
+                    worker.channel->sendMessage(std::string("batch ") + std::to_string(batch.size()));
+                    for (const auto& configuration : batch)
+                    {
+                        worker.channel->sendMessage(serializeConfiguration(configuration));
+                    }
+                }
+            }
+            configurationsOutstanding |= !worker.outstandingConfigurations.empty();
+        }
+
+        if (workerRegistered && !configurationsOutstanding && requeuedConfigurations.empty())
+        {
+            break;
+        }
+
+        std::vector<pollfd> descriptors(workers.size() + 1);
+        descriptors.at(0).fd = listeningDescriptor;
+        for (size_t i = 0; i < workers.size(); i++)
+        {
+            descriptors.at(i + 1).fd = workers.at(i).channel->getDescriptor();
+        }
+        for (auto& descriptor : descriptors)
+        {
+            descriptor.events = POLLIN;
+            descriptor.revents = 0;
+        }
+
+        if (poll(descriptors.data(), static_cast<nfds_t>(descriptors.size()), -1) < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw std::runtime_error(std::string("Tuning coordinator failed to wait for workers: ") + std::strerror(errno));
+        }
+
+        std::vector<size_t> closedWorkers;
+        for (size_t i = 0; i < workers.size(); i++)
+        {
+            if (descriptors.at(i + 1).revents == 0)
+            {
+                continue;
+            }
+
+            ConnectedWorker& worker = workers.at(i);
+            bool connected = worker.channel->receiveAvailable();
+            std::string message;
+
+            while (connected && worker.channel->popMessage(message))
+            {
+                if (!worker.registered)
+                {
+                    if (message != std::string("hello ") + kernelName)
+                    {
+                        worker.channel->sendMessage("reject");
+                        connected = false;
+                        continue;
+                    }
+                    worker.registered = true;
+                    logger->log(std::string("Worker ") + std::to_string(worker.id) + " registered for kernel <" + kernelName + ">");
+                    continue;
+                }
+
+                std::unique_ptr<TuningResult> result;
+                try
+                {
+                    result = std::make_unique<TuningResult>(TuningCheckpoint::deserializeResult(message, kernelName));
+                }
+                catch (const std::exception&)
+                {
+                    logger->log(std::string("Worker ") + std::to_string(worker.id) + " sent malformed result and is disconnected");
+                    connected = false;
+                    continue;
+                }
+
+                std::vector<KernelConfiguration>& outstanding = worker.outstandingConfigurations;
+                std::vector<ParameterPair> parameterPairs = result->getConfiguration().getParameterPairs();
+                auto configurationPointer = std::find_if(outstanding.begin(), outstanding.end(),
+                    [&parameterPairs](const KernelConfiguration& configuration)
+                {
+                    return configuration.getParameterPairs() == parameterPairs;
+                });
+                if (configurationPointer == outstanding.end())
+                {
+                    continue;
+                }
+
+                result->setConfiguration(*configurationPointer);
+                outstanding.erase(configurationPointer);
+                processResult(*result);
+            }
+
+            if (!connected)
+            {
+                disconnectWorker(worker);
+                closedWorkers.push_back(i);
+            }
+        }
+
+        for (auto index = closedWorkers.rbegin(); index != closedWorkers.rend(); ++index)
+        {
+            workers.erase(workers.begin() + static_cast<std::ptrdiff_t>(*index));
+        }
+
+        if (descriptors.at(0).revents != 0)
+        {
+            int descriptor = accept(listeningDescriptor, nullptr, nullptr);
+            if (descriptor >= 0)
+            {
+                workers.push_back(ConnectedWorker{std::make_unique<MessageChannel>(descriptor), nextWorkerId++, false,
+                    std::vector<KernelConfiguration>{}});
+            }
+        }
+    }
+
+    for (auto& worker : workers)
+    {
+        worker.channel->sendMessage("done");
+    }
+}
+
+#else
+
+TuningCoordinator::TuningCoordinator(const std::string&, const uint16_t port, const size_t batchSize, Logger* logger) :
+    listeningDescriptor(-1),
+    port(port),
+    batchSize(batchSize),
+    logger(logger)
+{
+    throw std::runtime_error("Distributed tuning is supported only on POSIX platforms");
+}
+
+TuningCoordinator::~TuningCoordinator()
+{}
+
+bool TuningCoordinator::isSupported()
+{
+    return false;
+}
+
+void TuningCoordinator::coordinate(const std::string&, const std::function<std::vector<KernelConfiguration>(const size_t)>&,
+    const std::function<void(const TuningResult&)>&)
+{
+    throw std::runtime_error("Distributed tuning is supported only on POSIX platforms");
+}
+
+#endif // KTT_TUNING_COORDINATOR_SUPPORT
+
+uint16_t TuningCoordinator::getPort() const
+{
+    return port;
+}
+
+std::string TuningCoordinator::serializeConfiguration(const KernelConfiguration& configuration)
+{
+    std::stringstream stream;
+    bool first = true;
+
+    for (const auto& parameterPair : configuration.getParameterPairs())
+    {
+        if (!first)
+        {
+            stream << ",";
+        }
+        stream << std::get<0>(parameterPair) << "," << std::get<1>(parameterPair);
+        first = false;
+    }
+
+    return stream.str();
+}
+
+std::vector<ParameterPair> TuningCoordinator::deserializeConfiguration(const std::string& message)
+{
+    std::vector<ParameterPair> result;
+    if (message.empty())
+    {
+        return result;
+    }
+
+    std::stringstream stream(message);
+    std::string name;
+    std::string value;
+    while (std::getline(stream, name, ','))
+    {
+        size_t parsedLength = 0;
+        size_t parsedValue = 0;
+        try
+        {
+            if (std::getline(stream, value, ','))
+            {
+                parsedValue = static_cast<size_t>(std::stoull(value, &parsedLength));
+            }
+        }
+        catch (const std::exception&)
+        {
+            parsedLength = 0;
+        }
+
+        if (parsedLength == 0 || parsedLength != value.size())
+        {
+            throw std::runtime_error(std::string("Malformed configuration received from tuning coordinator: ") + message);
+        }
+        result.push_back(ParameterPair(name, parsedValue));
+    }
+
+    return result;
+}
+
+} // namespace ktt
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "message_channel.h"
+#include "dto/tuning_result.h"
+#include "kernel/kernel_configuration.h"
+#include "utility/logger.h"
+
+namespace ktt
+{
+
+// Listening side of distributed tuning. Workers are separate processes with their own tuner, which connect over TCP, register for
+// a kernel and receive batches of configurations. Worker returns one result per configuration as soon as it is measured. Configurations
+// of a worker which disconnected before returning their results are given to other workers. Available only on POSIX platforms.
+//
+// Protocol consists of single line messages:
+// worker -> coordinator: "hello <kernel name>", then one serialized tuning result per received configuration
+// coordinator -> worker: "batch <count>" followed by count configurations, "reject" on kernel mismatch, "done" when tuning ends
+class TuningCoordinator
+{
+public:
+    // Constructor and destructor
+    // Bind address is IPv4 address of local interface, eg. 127.0.0.1 for workers on the same node or 0.0.0.0 for all interfaces
+    explicit TuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize, Logger* logger);
+    ~TuningCoordinator();
+    TuningCoordinator(const TuningCoordinator&) = delete;
+    TuningCoordinator& operator=(const TuningCoordinator&) = delete;
+
+    // Core methods
+    static bool isSupported();
+    // Returns after batch provider returns no configurations and results of all distributed configurations were processed
+    void coordinate(const std::string& kernelName, const std::function<std::vector<KernelConfiguration>(const size_t)>& getBatch,
+        const std::function<void(const TuningResult&)>& processResult);
+
+    // Getters
+    uint16_t getPort() const;
+
+    // Serialization of configurations sent to workers
+    static std::string serializeConfiguration(const KernelConfiguration& configuration);
+    static std::vector<ParameterPair> deserializeConfiguration(const std::string& message);
+
+private:
+    // Configuration which was running when its worker disconnected is given to another worker at most this many times
+    static constexpr size_t maximumAttempts = 2;
+
+    struct ConnectedWorker
+    {
+        std::unique_ptr<MessageChannel> channel;
+        size_t id;
+        bool registered;
+        std::vector<KernelConfiguration> outstandingConfigurations;
+    };
+
+    // Attributes
+    int listeningDescriptor;
+    uint16_t port;
+    size_t batchSize;
+    Logger* logger;
+};
+
+} // namespace ktt
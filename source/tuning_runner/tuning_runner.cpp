@@ -1,12 +1,27 @@
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <future>
 #include <iterator>
+#include <mutex>
+#include <numeric>
+#include <random>
 #include <sstream>
 #include <string>
+#include <thread>
 #include "tuning_runner.h"
 #include "searcher/annealing_searcher.h"
+#include "searcher/cost_aware_searcher.h"
 #include "searcher/full_searcher.h"
+#include "searcher/pareto_searcher.h"
+#include "searcher/pattern_searcher.h"
+#include "searcher/portfolio_searcher.h"
+#include "searcher/profile_guided_searcher.h"
 #include "searcher/pso_searcher.h"
 #include "searcher/random_searcher.h"
+#include "searcher/transfer_searcher.h"
 #include "utility/ktt_utility.h"
 #include "utility/timer.h"
 
@@ -19,18 +34,23 @@ TuningRunner::TuningRunner(ArgumentManager* argumentManager, KernelManager* kern
     kernelManager(kernelManager),
     logger(logger),
     computeEngine(computeEngine),
-    resultValidator(nullptr),
+    resultValidator(std::make_unique<ResultValidator>(argumentManager, kernelManager, logger, computeEngine)),
     manipulatorInterfaceImplementation(std::make_unique<ManipulatorInterfaceImplementation>(computeEngine)),
     searchMethod(SearchMethod::FullSearch),
+    fixedSearchSeed(false),
+    searchSeed(0),
+    warmUpRuns(0),
+    repetitions(1),
+    durationStatistic(DurationStatistic::Median),
+    rerankingCandidates(0),
+    rerankingRounds(0),
+    processIsolation(false),
+    isolationTimeout(0.0),
+    asynchronousValidation(false),
     runMode(runMode)
-{
-    if (runMode == RunMode::Tuning)
-    {
-        resultValidator = std::make_unique<ResultValidator>(argumentManager, kernelManager, logger, computeEngine);
-    }
-}
+{}
 
-std::vector<TuningResult> TuningRunner::tuneKernel(const KernelId id)
+std::vector<TuningResult> TuningRunner::tuneKernel(const KernelId id, const bool resume)
 {
     if (runMode == RunMode::Computation)
     {
@@ -44,66 +64,265 @@ std::vector<TuningResult> TuningRunner::tuneKernel(const KernelId id)
 
     std::vector<TuningResult> results;
     const Kernel& kernel = kernelManager->getKernel(id);
+    const std::string workerTaskName = getWorkerTaskName("kernel", kernel.getName());
+    // Worker process replays the tuning program only to reach the call it serves, other tuning is skipped there without reference
+    if (WorkerProcess::isWorker() && !WorkerProcess::isWorker(workerTaskName))
+    {
+        return results;
+    }
     resultValidator->computeReferenceResult(kernel);
 
-    std::unique_ptr<Searcher> searcher = getSearcher(searchMethod, searchArguments, kernelManager->getKernelConfigurations(id,
-        computeEngine->getCurrentDeviceInfo()), kernel.getParameters());
+    std::vector<KernelConfiguration> configurations = kernelManager->getKernelConfigurations(id, computeEngine->getCurrentDeviceInfo());
+    auto runConfiguration = [this, &kernel](const KernelConfiguration& configuration)
+    {
+        return runKernelConfiguration(kernel, configuration);
+    };
+    auto resetBuffers = [this, &kernel]() { resetKernelBuffers(kernel); };
+    auto measureConfiguration = [this, &kernel](const KernelConfiguration& configuration)
+    {
+        return measureKernelConfiguration(kernel, configuration);
+    };
+
+    if (WorkerProcess::isWorker(workerTaskName))
+    {
+        serveIsolatedRuns(kernel.getName(), configurations, measureConfiguration, runConfiguration, resetBuffers);
+    }
+
+    TuningCheckpoint checkpoint;
+    const std::string databaseKey = getResultDatabaseKey(id);
+    unsigned int randomSeed = openCheckpoint(checkpoint, id, kernel.getName(), resume);
+
+    std::unique_ptr<Searcher> defaultSearcher;
+    Searcher* searcher = getCustomSearcher(id);
+    if (searcher == nullptr)
+    {
+        defaultSearcher = getSearcher(id, searchMethod, searchArguments, configurations, kernel.getParameters(), randomSeed);
+        searcher = defaultSearcher.get();
+    }
+    searcher->initialize(configurations, kernel.getParameters());
     size_t configurationsCount = searcher->getConfigurationsCount();
+    stopCondition.initialize();
+    stopReasons.erase(id);
+    distinguishableResults.erase(id);
 
-    for (size_t i = 0; i < configurationsCount; i++)
+    WorkerProcess worker(workerTaskName, isolationArguments);
+    DeviceInfo deviceInfo = computeEngine->getCurrentDeviceInfo();
+
+    if (tuningCoordinator != nullptr)
     {
-        KernelConfiguration currentConfiguration = searcher->getNextConfiguration();
-        TuningResult result(kernel.getName(), currentConfiguration);
+        tuneKernelDistributed(id, kernel, *searcher, checkpoint, databaseKey, configurationsCount, results);
+    }
+    else if (!parallelEngines.empty() && !kernel.hasTuningManipulator() && !processIsolation)
+    {
+        tuneKernelInParallel(id, kernel, *searcher, checkpoint, databaseKey, configurationsCount, results);
+    }
+    else
+    {
+        if (!parallelEngines.empty())
+        {
+            logger->log(std::string("Kernel <") + kernel.getName() + "> is tuned only on the primary device, parallel tuning is not supported "
+                + "for kernels with tuning manipulator or with process isolation enabled");
+        }
 
-        try
+        // Results whose validation is pending are stored only after it completes, so that unvalidated result is never reused
+        const bool deferValidation = asynchronousValidation && !processIsolation && resultValidator->hasReference(id);
+        const size_t maximumPendingValidations = std::max(std::thread::hardware_concurrency(), 1u);
+        std::deque<PendingValidation> pendingValidations;
+
+        for (size_t i = 0; i < configurationsCount; i++)
         {
-            std::stringstream stream;
-            stream << "Launching kernel <" << kernel.getName() << "> with configuration (" << i + 1 << " / " << configurationsCount << "): "
-                << currentConfiguration;
-            logger->log(stream.str());
+            KernelConfiguration currentConfiguration = searcher->getNextConfiguration();
+            TuningResult result(kernel.getName(), currentConfiguration);
+            bool validationPending = false;
 
-            if (kernel.hasTuningManipulator())
+            const std::string storeName = findStoredResult(checkpoint, databaseKey, currentConfiguration, result);
+            if (!storeName.empty())
             {
-                auto manipulatorPointer = tuningManipulators.find(id);
-                result = runKernelWithManipulator(kernel, manipulatorPointer->second.get(), currentConfiguration,
-                    std::vector<ArgumentOutputDescriptor>{});
+                std::stringstream stream;
+                stream << "Restoring result of kernel <" << kernel.getName() << "> with configuration (" << i + 1 << " / " << configurationsCount
+                    << ") from " << storeName << ": " << currentConfiguration;
+                logger->log(stream.str());
             }
             else
             {
-                result = runKernelSimple(kernel, currentConfiguration, std::vector<ArgumentOutputDescriptor>{});
+                std::stringstream stream;
+                stream << "Launching kernel <" << kernel.getName() << "> with configuration (" << i + 1 << " / " << configurationsCount << "): "
+                    << currentConfiguration;
+                logger->log(stream.str());
+
+                if (processIsolation)
+                {
+                    result = runIsolated(worker, "measure", currentConfiguration, kernel.getName());
+                }
+                else if (deferValidation)
+                {
+                    std::vector<KernelArgument> validatedOutput;
+                    result = measureKernelConfiguration(kernel, currentConfiguration, &validatedOutput);
+                    if (result.isValid())
+                    {
+                        startValidation(kernel, results.size(), currentConfiguration, std::move(validatedOutput), pendingValidations);
+                        validationPending = true;
+                    }
+                }
+                else
+                {
+                    result = measureKernelConfiguration(kernel, currentConfiguration);
+                }
+                result.setDevice(deviceInfo.getId(), deviceInfo.getName());
+                evaluateObjective(id, result);
+                if (!validationPending)
+                {
+                    storeResult(checkpoint, databaseKey, result);
+                }
+            }
+            results.push_back(result);
+            searcher->calculateNextConfiguration(result);
+
+            // Stop condition is updated with result whose validation is pending only after validation completes
+            if (!validationPending)
+            {
+                stopCondition.updateStatus(result.isValid(), result.getTotalDuration());
+            }
+            completeValidations(kernel, *searcher, checkpoint, databaseKey, maximumPendingValidations, pendingValidations, results);
+
+            if (stopCondition.isSatisfied())
+            {
+                break;
             }
         }
-        catch (const std::runtime_error& error)
+
+        completeValidations(kernel, *searcher, checkpoint, databaseKey, 0, pendingValidations, results);
+    }
+
+    logTuningStop(id, kernel.getName());
+    if (processIsolation)
+    {
+        rerankResults(id, kernel.getName(), results, [this, &worker, &kernel](const KernelConfiguration& configuration)
         {
-            logger->log(std::string("Kernel run failed, reason: ") + error.what() + "\n");
-            results.emplace_back(kernel.getName(), currentConfiguration, std::string("Failed kernel run: ") + error.what());
+            return runIsolated(worker, "run", configuration, kernel.getName());
+        }, []() {});
+    }
+    else
+    {
+        rerankResults(id, kernel.getName(), results, runConfiguration, resetBuffers);
+    }
+
+    computeEngine->clearBuffers();
+    resultValidator->clearReferenceResults();
+    return results;
+}
+
+std::vector<std::vector<TuningResult>> TuningRunner::tuneKernels(const std::vector<KernelId>& ids)
+{
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    if (!containsUnique(ids))
+    {
+        throw std::runtime_error("Kernels tuned together must have unique ids");
+    }
+    for (const auto id : ids)
+    {
+        if (!kernelManager->isKernel(id))
+        {
+            throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
         }
+    }
+    if (WorkerProcess::isWorker())
+    {
+        // Kernels tuned together are never isolated, worker process skips their tuning
+        return std::vector<std::vector<TuningResult>>(ids.size());
+    }
+    if (tuningCoordinator != nullptr || !parallelEngines.empty() || processIsolation)
+    {
+        logger->log("Kernels tuned together are run only on the primary device inside tuning process");
+    }
+
+    // Reference kernels clear all buffers, so references are computed before any configuration is run
+    std::vector<std::unique_ptr<BatchTuningState>> states;
+    for (const auto id : ids)
+    {
+        const Kernel& kernel = kernelManager->getKernel(id);
+        resultValidator->computeReferenceResult(kernel);
+
+        auto state = std::make_unique<BatchTuningState>();
+        state->kernel = &kernel;
+        std::vector<KernelConfiguration> configurations = kernelManager->getKernelConfigurations(id, computeEngine->getCurrentDeviceInfo());
+        state->databaseKey = getResultDatabaseKey(id);
+        unsigned int randomSeed = openCheckpoint(state->checkpoint, id, kernel.getName(), false);
 
-        searcher->calculateNextConfiguration(static_cast<double>(result.getTotalDuration()));
-        if (validateResult(kernel, result))
+        state->searcher = getCustomSearcher(id);
+        if (state->searcher == nullptr)
         {
-            results.push_back(result);
+            state->defaultSearcher = getSearcher(id, searchMethod, searchArguments, configurations, kernel.getParameters(), randomSeed);
+            state->searcher = state->defaultSearcher.get();
         }
-        else
+        state->searcher->initialize(configurations, kernel.getParameters());
+        state->configurationsCount = state->searcher->getConfigurationsCount();
+
+        auto priorityPointer = tuningPriorities.find(id);
+        state->priority = priorityPointer == tuningPriorities.end() ? 1.0 : priorityPointer->second;
+        state->stopCondition = stopCondition;
+        state->stopCondition.initialize();
+        state->spentTime = 0;
+        state->finished = state->configurationsCount == 0;
+        stopReasons.erase(id);
+        distinguishableResults.erase(id);
+        if (state->finished)
         {
-            results.emplace_back(kernel.getName(), currentConfiguration, "Results differ");
+            stopReasons[id] = state->stopCondition.getStatusString();
         }
+        states.push_back(std::move(state));
+    }
 
-        computeEngine->clearBuffers(ArgumentAccessType::ReadWrite);
-        computeEngine->clearBuffers(ArgumentAccessType::WriteOnly);
+    // Device time is shared in proportion to priorities, next configuration belongs to the kernel with the lowest weighted time
+    while (true)
+    {
+        BatchTuningState* nextState = nullptr;
+        for (const auto& state : states)
+        {
+            if (state->finished)
+            {
+                continue;
+            }
+            const double share = static_cast<double>(state->spentTime) / state->priority;
+            const double nextShare = nextState == nullptr ? 0.0 : static_cast<double>(nextState->spentTime) / nextState->priority;
+            if (nextState == nullptr || share < nextShare || share == nextShare && state->priority > nextState->priority)
+            {
+                nextState = state.get();
+            }
+        }
 
-        if (kernel.hasTuningManipulator())
+        if (nextState == nullptr)
         {
-            computeEngine->clearBuffers(ArgumentAccessType::ReadOnly);
+            break;
         }
+        nextState->finished = tuneNextBatchConfiguration(*nextState);
+    }
+
+    std::vector<std::vector<TuningResult>> results;
+    for (const auto& state : states)
+    {
+        const Kernel& kernel = *state->kernel;
+        auto runConfiguration = [this, &kernel](const KernelConfiguration& configuration)
+        {
+            return runKernelConfiguration(kernel, configuration);
+        };
+        auto resetBuffers = [this, &kernel]() { resetKernelBuffers(kernel); };
+
+        logger->log(std::string("Tuning of kernel <") + kernel.getName() + "> stopped, reason: " + stopReasons[kernel.getId()]);
+        rerankResults(kernel.getId(), kernel.getName(), state->results, runConfiguration, resetBuffers);
+        results.push_back(state->results);
     }
 
+    // Read-only arguments shared by the kernels were uploaded only once
     computeEngine->clearBuffers();
     resultValidator->clearReferenceResults();
     return results;
 }
 
-std::vector<TuningResult> TuningRunner::tuneKernelComposition(const KernelId id)
+std::vector<TuningResult> TuningRunner::tuneKernelComposition(const KernelId id, const bool resume)
 {
     if (runMode == RunMode::Computation)
     {
@@ -117,48 +336,126 @@ std::vector<TuningResult> TuningRunner::tuneKernelComposition(const KernelId id)
 
     std::vector<TuningResult> results;
     const KernelComposition& composition = kernelManager->getKernelComposition(id);
+    const std::string workerTaskName = getWorkerTaskName("composition", composition.getName());
+    if (WorkerProcess::isWorker() && !WorkerProcess::isWorker(workerTaskName))
+    {
+        return results;
+    }
     const Kernel& compatibilityKernel = compositionToKernel(composition);
     resultValidator->computeReferenceResult(compatibilityKernel);
 
-    std::unique_ptr<Searcher> searcher = getSearcher(searchMethod, searchArguments, kernelManager->getKernelCompositionConfigurations(id,
-        computeEngine->getCurrentDeviceInfo()), composition.getParameters());
+    std::vector<KernelConfiguration> configurations = kernelManager->getKernelCompositionConfigurations(id,
+        computeEngine->getCurrentDeviceInfo());
+    auto runConfiguration = [this, id, &composition](const KernelConfiguration& configuration)
+    {
+        auto manipulatorPointer = tuningManipulators.find(id);
+        return runCompositionWithManipulator(composition, manipulatorPointer->second.get(), configuration,
+            std::vector<ArgumentOutputDescriptor>{});
+    };
+    auto resetBuffers = [this]() { computeEngine->clearBuffers(); };
+    auto measureConfiguration = [this, &composition, &compatibilityKernel, &runConfiguration, &resetBuffers](
+        const KernelConfiguration& configuration)
+    {
+        TuningResult result(composition.getName(), configuration);
+        try
+        {
+            result = runRepeatedly([&runConfiguration, &configuration]() { return runConfiguration(configuration); }, resetBuffers);
+        }
+        catch (const std::runtime_error& error)
+        {
+            logger->log(std::string("Kernel composition run failed, reason: ") + error.what() + "\n");
+            result = TuningResult(composition.getName(), configuration, std::string("Failed kernel composition run: ") + error.what());
+        }
+
+        if (result.isValid() && !validateResult(compatibilityKernel, result, *computeEngine))
+        {
+            result.setValid(false);
+            result.setStatusMessage("Results differ");
+        }
+
+        computeEngine->clearBuffers();
+        return result;
+    };
+
+    if (WorkerProcess::isWorker(workerTaskName))
+    {
+        serveIsolatedRuns(composition.getName(), configurations, measureConfiguration, runConfiguration, resetBuffers);
+    }
+
+    TuningCheckpoint checkpoint;
+    const std::string databaseKey = getResultDatabaseKey(id);
+    unsigned int randomSeed = openCheckpoint(checkpoint, id, composition.getName(), resume);
+
+    std::unique_ptr<Searcher> defaultSearcher;
+    Searcher* searcher = getCustomSearcher(id);
+    if (searcher == nullptr)
+    {
+        defaultSearcher = getSearcher(id, searchMethod, searchArguments, configurations, composition.getParameters(), randomSeed);
+        searcher = defaultSearcher.get();
+    }
+    searcher->initialize(configurations, composition.getParameters());
     size_t configurationsCount = searcher->getConfigurationsCount();
+    stopCondition.initialize();
+    stopReasons.erase(id);
+    distinguishableResults.erase(id);
+
+    WorkerProcess worker(workerTaskName, isolationArguments);
+    DeviceInfo deviceInfo = computeEngine->getCurrentDeviceInfo();
 
     for (size_t i = 0; i < configurationsCount; i++)
     {
         KernelConfiguration currentConfiguration = searcher->getNextConfiguration();
         TuningResult result(composition.getName(), currentConfiguration);
 
-        try
+        const std::string storeName = findStoredResult(checkpoint, databaseKey, currentConfiguration, result);
+        if (!storeName.empty())
         {
             std::stringstream stream;
-            stream << "Launching kernel composition <" << composition.getName() << "> with configuration (" << i + 1 << " / " << configurationsCount
-                << "): " << currentConfiguration;
+            stream << "Restoring result of kernel composition <" << composition.getName() << "> with configuration (" << i + 1 << " / "
+                << configurationsCount << ") from " << storeName << ": " << currentConfiguration;
             logger->log(stream.str());
-
-            auto manipulatorPointer = tuningManipulators.find(id);
-            result = runCompositionWithManipulator(composition, manipulatorPointer->second.get(), currentConfiguration,
-                std::vector<ArgumentOutputDescriptor>{});
         }
-        catch (const std::runtime_error& error)
+        else
         {
-            logger->log(std::string("Kernel composition run failed, reason: ") + error.what() + "\n");
-            results.emplace_back(composition.getName(), currentConfiguration, std::string("Failed kernel composition run: ") + error.what());
-        }
+            std::stringstream stream;
+            stream << "Launching kernel composition <" << composition.getName() << "> with configuration (" << i + 1 << " / "
+                << configurationsCount << "): " << currentConfiguration;
+            logger->log(stream.str());
 
-        searcher->calculateNextConfiguration(static_cast<double>(result.getTotalDuration()));
-        if (validateResult(compatibilityKernel, result))
-        {
-            results.push_back(result);
+            if (processIsolation)
+            {
+                result = runIsolated(worker, "measure", currentConfiguration, composition.getName());
+            }
+            else
+            {
+                result = measureConfiguration(currentConfiguration);
+            }
+            result.setDevice(deviceInfo.getId(), deviceInfo.getName());
+            evaluateObjective(id, result);
+            storeResult(checkpoint, databaseKey, result);
         }
-        else
+        results.push_back(result);
+        searcher->calculateNextConfiguration(result);
+        stopCondition.updateStatus(result.isValid(), result.getTotalDuration());
+
+        if (stopCondition.isSatisfied())
         {
-            results.emplace_back(composition.getName(), currentConfiguration, "Results differ");
+            break;
         }
-
-        computeEngine->clearBuffers();
     }
 
+    logTuningStop(id, composition.getName());
+    if (processIsolation)
+    {
+        rerankResults(id, composition.getName(), results, [this, &worker, &composition](const KernelConfiguration& configuration)
+        {
+            return runIsolated(worker, "run", configuration, composition.getName());
+        }, []() {});
+    }
+    else
+    {
+        rerankResults(id, composition.getName(), results, runConfiguration, resetBuffers);
+    }
     computeEngine->clearBuffers();
     resultValidator->clearReferenceResults();
     return results;
@@ -174,6 +471,12 @@ void TuningRunner::runKernel(const KernelId id, const std::vector<ParameterPair>
     const Kernel& kernel = kernelManager->getKernel(id);
     const KernelConfiguration launchConfiguration = kernelManager->getKernelConfiguration(id, configuration);
 
+    if (onlineTuningSettings.find(id) != onlineTuningSettings.end())
+    {
+        runKernelOnline(kernel, launchConfiguration, output);
+        return;
+    }
+
     std::stringstream stream;
     stream << "Running kernel <" << kernel.getName() << "> with configuration: " << launchConfiguration;
     logger->log(stream.str());
@@ -187,7 +490,7 @@ void TuningRunner::runKernel(const KernelId id, const std::vector<ParameterPair>
         }
         else
         {
-            runKernelSimple(kernel, launchConfiguration, output);
+            runKernelSimple(kernel, launchConfiguration, output, *computeEngine);
         }
     }
     catch (const std::runtime_error& error)
@@ -235,7 +538,13 @@ void TuningRunner::setSearchMethod(const SearchMethod& method, const std::vector
 
     if (method == SearchMethod::RandomSearch && arguments.size() < 1
         || method == SearchMethod::Annealing && arguments.size() < 2
-        || method == SearchMethod::PSO && arguments.size() < 5)
+        || method == SearchMethod::PSO && arguments.size() < 5
+        || method == SearchMethod::TransferLearning && arguments.size() < 2
+        || method == SearchMethod::PatternSearch && arguments.size() < 1
+        || method == SearchMethod::Portfolio && arguments.size() < 1
+        || method == SearchMethod::Pareto && arguments.size() < 1
+        || method == SearchMethod::CostAware && arguments.size() < 2
+        || method == SearchMethod::ProfileGuided && arguments.size() < 1)
     {
         throw std::runtime_error(std::string("Insufficient number of arguments given for specified search method: ")
             + getSearchMethodName(method));
@@ -245,172 +554,1388 @@ void TuningRunner::setSearchMethod(const SearchMethod& method, const std::vector
     this->searchMethod = method;
 }
 
-void TuningRunner::setValidationMethod(const ValidationMethod& method, const double toleranceThreshold)
+void TuningRunner::setSearchSeed(const unsigned int seed)
+{
+    fixedSearchSeed = true;
+    searchSeed = seed;
+}
+
+void TuningRunner::setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher)
 {
     if (runMode == RunMode::Computation)
     {
-        throw std::runtime_error("Validation cannot be performed in computation mode");
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+
+    if (customSearchers.find(id) != customSearchers.end())
+    {
+        customSearchers.erase(id);
+    }
+    if (searcher != nullptr)
+    {
+        customSearchers.insert(std::make_pair(id, std::move(searcher)));
     }
-    resultValidator->setValidationMethod(method);
-    resultValidator->setToleranceThreshold(toleranceThreshold);
 }
 
-void TuningRunner::setValidationRange(const ArgumentId id, const size_t range)
+void TuningRunner::setObjective(const KernelId id, const std::function<double(const TuningResult&)>& objective)
 {
     if (runMode == RunMode::Computation)
     {
-        throw std::runtime_error("Validation cannot be performed in computation mode");
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+
+    if (objectives.find(id) != objectives.end())
+    {
+        objectives.erase(id);
+    }
+    if (objective)
+    {
+        objectives.insert(std::make_pair(id, objective));
     }
-    resultValidator->setValidationRange(id, range);
 }
 
-void TuningRunner::setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
-    const std::vector<ArgumentId>& validatedArgumentIds)
+void TuningRunner::setStopCondition(const StopCriterion& criterion, const double value)
 {
     if (runMode == RunMode::Computation)
     {
-        throw std::runtime_error("Validation cannot be performed in computation mode");
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
     }
-    resultValidator->setReferenceKernel(id, referenceId, referenceConfiguration, validatedArgumentIds);
+    stopCondition.setCriterion(criterion, value);
 }
 
-void TuningRunner::setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass,
-    const std::vector<ArgumentId>& validatedArgumentIds)
+void TuningRunner::clearStopConditions()
+{
+    stopCondition.clearCriteria();
+}
+
+void TuningRunner::setPriorResults(const KernelId id, const std::vector<TuningResult>& results)
 {
     if (runMode == RunMode::Computation)
     {
-        throw std::runtime_error("Validation cannot be performed in computation mode");
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
     }
-    resultValidator->setReferenceClass(id, std::move(referenceClass), validatedArgumentIds);
+    priorResults[id] = results;
 }
 
-void TuningRunner::setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator)
+void TuningRunner::setMeasurementRepetitions(const size_t warmUpRuns, const size_t repetitions)
 {
-    if (tuningManipulators.find(id) != tuningManipulators.end())
+    if (runMode == RunMode::Computation)
     {
-        tuningManipulators.erase(id);
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
     }
-    tuningManipulators.insert(std::make_pair(id, std::move(manipulator)));
+    if (repetitions == 0)
+    {
+        throw std::runtime_error("Number of measurement repetitions must be greater than zero");
+    }
+
+    this->warmUpRuns = warmUpRuns;
+    this->repetitions = repetitions;
 }
 
-TuningResult TuningRunner::runKernelSimple(const Kernel& kernel, const KernelConfiguration& configuration,
-    const std::vector<ArgumentOutputDescriptor>& output)
+void TuningRunner::setDurationStatistic(const DurationStatistic& statistic)
 {
-    KernelId kernelId = kernel.getId();
-    std::string kernelName = kernel.getName();
-    std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
-
-    KernelRuntimeData kernelData(kernelId, kernelName, source, configuration.getGlobalSize(), configuration.getLocalSize(), kernel.getArgumentIds());
-    KernelRunResult result = computeEngine->runKernel(kernelData, argumentManager->getArguments(kernel.getArgumentIds()), output);
-    return TuningResult(kernelName, configuration, result);
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    durationStatistic = statistic;
 }
 
-TuningResult TuningRunner::runKernelWithManipulator(const Kernel& kernel, TuningManipulator* manipulator, const KernelConfiguration& configuration,
-    const std::vector<ArgumentOutputDescriptor>& output)
+void TuningRunner::setCheckpointFile(const KernelId id, const std::string& filePath)
 {
-    KernelId kernelId = kernel.getId();
-    std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
-    KernelRuntimeData kernelData(kernelId, kernel.getName(), source, configuration.getGlobalSize(), configuration.getLocalSize(),
-        kernel.getArgumentIds());
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
 
-    manipulator->manipulatorInterface = manipulatorInterfaceImplementation.get();
-    manipulatorInterfaceImplementation->addKernel(kernelId, kernelData);
-    manipulatorInterfaceImplementation->setConfiguration(configuration);
-    manipulatorInterfaceImplementation->setKernelArguments(argumentManager->getArguments(kernel.getArgumentIds()));
-    if (manipulator->enableArgumentPreload())
+    if (filePath.empty())
     {
-        manipulatorInterfaceImplementation->uploadBuffers();
+        checkpointFiles.erase(id);
+        return;
     }
+    checkpointFiles[id] = filePath;
+}
 
-    Timer timer;
-    try
+void TuningRunner::setAsynchronousValidation(const bool flag)
+{
+    if (runMode == RunMode::Computation)
     {
-        timer.start();
-        manipulator->launchComputation(kernelId);
-        timer.stop();
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
     }
-    catch (const std::runtime_error&)
+    asynchronousValidation = flag;
+}
+
+void TuningRunner::setProcessIsolation(const bool flag, const double timeout)
+{
+    if (runMode == RunMode::Computation)
     {
-        manipulatorInterfaceImplementation->clearData();
-        manipulator->manipulatorInterface = nullptr;
-        throw;
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    if (flag && !WorkerProcess::isSupported())
+    {
+        throw std::runtime_error("Process isolation is supported only on POSIX platforms");
+    }
+    if (timeout < 0.0)
+    {
+        throw std::runtime_error("Process isolation timeout cannot be negative");
     }
 
-    manipulatorInterfaceImplementation->downloadBuffers(output);
-    KernelRunResult result = manipulatorInterfaceImplementation->getCurrentResult();
-    size_t manipulatorDuration = timer.getElapsedTime();
-    manipulatorDuration -= result.getOverhead();
+    processIsolation = flag;
+    isolationTimeout = timeout;
+}
 
-    manipulatorInterfaceImplementation->clearData();
-    manipulator->manipulatorInterface = nullptr;
+void TuningRunner::setProcessIsolationArguments(const std::vector<std::string>& arguments)
+{
+    isolationArguments = arguments;
+}
 
-    TuningResult tuningResult(kernel.getName(), configuration, result);
-    tuningResult.setManipulatorDuration(manipulatorDuration);
-    return tuningResult;
+void TuningRunner::setParallelEngines(const std::vector<ComputeEngine*>& engines)
+{
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    parallelEngines = engines;
 }
 
-TuningResult TuningRunner::runCompositionWithManipulator(const KernelComposition& composition, TuningManipulator* manipulator,
-    const KernelConfiguration& configuration, const std::vector<ArgumentOutputDescriptor>& output)
+void TuningRunner::setTuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize)
 {
-    manipulator->manipulatorInterface = manipulatorInterfaceImplementation.get();
-    std::vector<KernelArgument*> allArguments = argumentManager->getArguments(composition.getSharedArgumentIds());
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
 
-    for (const auto kernel : composition.getKernels())
+    tuningCoordinator.reset();
+    if (batchSize == 0)
     {
-        KernelId kernelId = kernel->getId();
+        return;
+    }
+
+    tuningCoordinator = std::make_unique<TuningCoordinator>(bindAddress, port, batchSize, logger);
+    logger->log(std::string("Tuning coordinator is listening on ") + bindAddress + ":" + std::to_string(tuningCoordinator->getPort()));
+}
+
+uint16_t TuningRunner::getTuningCoordinatorPort() const
+{
+    if (tuningCoordinator == nullptr)
+    {
+        throw std::runtime_error("Tuning coordinator is not enabled");
+    }
+    return tuningCoordinator->getPort();
+}
+
+void TuningRunner::runTuningWorker(const KernelId id, const std::string& coordinatorHost, const uint16_t port)
+{
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+
+    if (!kernelManager->isKernel(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+
+    const Kernel& kernel = kernelManager->getKernel(id);
+    std::unique_ptr<MessageChannel> channel = MessageChannel::connectTo(coordinatorHost, port);
+    channel->sendMessage(std::string("hello ") + kernel.getName());
+    logger->log(std::string("Connected to tuning coordinator ") + coordinatorHost + ":" + std::to_string(port) + " as worker of kernel <"
+        + kernel.getName() + ">");
+
+    resultValidator->computeReferenceResult(kernel);
+    DeviceInfo deviceInfo = computeEngine->getCurrentDeviceInfo();
+    std::string message;
+
+    // Result of each configuration is sent immediately, so that only unfinished configurations are lost if this worker terminates
+    while (channel->receiveMessage(message) && message != "done")
+    {
+        if (message == "reject")
+        {
+            resultValidator->clearReferenceResults();
+            throw std::runtime_error(std::string("Tuning coordinator does not tune kernel <") + kernel.getName() + ">");
+        }
+
+        std::vector<std::vector<ParameterPair>> batch;
+        try
+        {
+            const std::string batchPrefix("batch ");
+            if (message.compare(0, batchPrefix.size(), batchPrefix) != 0)
+            {
+                throw std::runtime_error(message);
+            }
+
+            const size_t batchSize = std::stoull(message.substr(batchPrefix.size()));
+            for (size_t i = 0; i < batchSize && channel->receiveMessage(message); i++)
+            {
+                batch.push_back(TuningCoordinator::deserializeConfiguration(message));
+            }
+        }
+        catch (const std::exception&)
+        {
+            computeEngine->clearBuffers();
+            resultValidator->clearReferenceResults();
+            throw std::runtime_error(std::string("Malformed message received from tuning coordinator: ") + message);
+        }
+
+        for (const auto& parameterPairs : batch)
+        {
+            // Configuration outside of worker's parameter space is returned as failed, so that coordinator does not give it to others
+            std::unique_ptr<KernelConfiguration> configuration;
+            try
+            {
+                configuration = std::make_unique<KernelConfiguration>(kernelManager->getKernelConfiguration(id, parameterPairs));
+            }
+            catch (const std::runtime_error& error)
+            {
+                logger->log(std::string("Configuration received from coordinator is rejected: ") + error.what());
+                TuningResult result(kernel.getName(), KernelConfiguration(DimensionVector(), DimensionVector(), parameterPairs),
+                    std::string("Failed kernel run: configuration is not valid for worker kernel: ") + error.what());
+                if (!channel->sendMessage(TuningCheckpoint::serializeResult(result)))
+                {
+                    break;
+                }
+                continue;
+            }
+
+            std::stringstream stream;
+            stream << "Launching kernel <" << kernel.getName() << "> with configuration received from coordinator: " << *configuration;
+            logger->log(stream.str());
+
+            TuningResult result = measureKernelConfiguration(kernel, *configuration);
+            result.setDevice(deviceInfo.getId(), deviceInfo.getName());
+            if (!channel->sendMessage(TuningCheckpoint::serializeResult(result)))
+            {
+                break;
+            }
+        }
+    }
+
+    logger->log(std::string("Tuning worker of kernel <") + kernel.getName() + "> finished");
+    computeEngine->clearBuffers();
+    resultValidator->clearReferenceResults();
+}
+
+void TuningRunner::setResultDatabase(const std::string& filePath)
+{
+    resultDatabase.reset();
+    if (!filePath.empty())
+    {
+        resultDatabase = std::make_unique<ResultDatabase>(filePath);
+    }
+}
+
+void TuningRunner::setInputSignature(const KernelId id, const std::string& signature)
+{
+    inputSignatures[id] = signature;
+}
+
+std::string TuningRunner::getInputSignature(const KernelId id) const
+{
+    auto signaturePointer = inputSignatures.find(id);
+    if (signaturePointer == inputSignatures.end())
+    {
+        return std::string();
+    }
+    return signaturePointer->second;
+}
+
+std::vector<ParameterPair> TuningRunner::getStoredBestConfiguration(const KernelId id) const
+{
+    TuningResult bestResult("", KernelConfiguration(DimensionVector(), DimensionVector(), std::vector<ParameterPair>{}));
+    if (resultDatabase == nullptr || !resultDatabase->findBestResult(getResultDatabaseKey(id), bestResult))
+    {
+        throw std::runtime_error(std::string("No tuning results found for kernel with id: ") + std::to_string(id));
+    }
+    return bestResult.getConfiguration().getParameterPairs();
+}
+
+bool TuningRunner::hasResultDatabase() const
+{
+    return resultDatabase != nullptr;
+}
+
+void TuningRunner::setOnlineTuning(const KernelId id, const bool flag, const double explorationProbability, const double maximumSlowdown)
+{
+    if (runMode == RunMode::Tuning)
+    {
+        throw std::runtime_error("Online tuning can be performed only in computation mode");
+    }
+    if (!kernelManager->isKernel(id))
+    {
+        throw std::runtime_error(std::string("Invalid kernel id: ") + std::to_string(id));
+    }
+    if (explorationProbability < 0.0 || explorationProbability > 1.0)
+    {
+        throw std::runtime_error("Exploration probability must be between 0.0 and 1.0");
+    }
+    if (maximumSlowdown < 1.0)
+    {
+        throw std::runtime_error("Maximum slowdown of online tuning must be at least 1.0");
+    }
+
+    onlineTuners.erase(id);
+    onlineTuningSettings.erase(id);
+    if (flag)
+    {
+        onlineTuningSettings.insert(std::make_pair(id, std::make_pair(explorationProbability, maximumSlowdown)));
+    }
+}
+
+void TuningRunner::setTuningPriority(const KernelId id, const double priority)
+{
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    if (priority <= 0.0)
+    {
+        throw std::runtime_error("Tuning priority must be greater than zero");
+    }
+    tuningPriorities[id] = priority;
+}
+
+void TuningRunner::setTuningBudget(const KernelId id, const double tuningTime, const size_t configurationCount)
+{
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    if (tuningTime < 0.0)
+    {
+        throw std::runtime_error("Tuning budget cannot be negative");
+    }
+    tuningBudgets[id] = std::make_pair(tuningTime, configurationCount);
+}
+
+void TuningRunner::setFinalReranking(const size_t candidateCount, const size_t rounds)
+{
+    if (runMode == RunMode::Computation)
+    {
+        throw std::runtime_error("Kernel tuning cannot be performed in computation mode");
+    }
+    if (candidateCount == 1 || candidateCount > 1 && rounds < 2)
+    {
+        throw std::runtime_error("Final reranking requires at least two candidates and two rounds");
+    }
+
+    rerankingCandidates = candidateCount;
+    rerankingRounds = rounds;
+}
+
+bool TuningRunner::isBestResultDistinguishable(const KernelId id) const
+{
+    auto resultPointer = distinguishableResults.find(id);
+    if (resultPointer == distinguishableResults.end())
+    {
+        throw std::runtime_error(std::string("No final reranking was performed for kernel with id: ") + std::to_string(id));
+    }
+    return resultPointer->second;
+}
+
+std::string TuningRunner::getStopReason(const KernelId id) const
+{
+    auto reasonPointer = stopReasons.find(id);
+    if (reasonPointer == stopReasons.end())
+    {
+        throw std::runtime_error(std::string("No tuning results found for kernel with id: ") + std::to_string(id));
+    }
+    return reasonPointer->second;
+}
+
+void TuningRunner::setValidationMethod(const ValidationMethod& method, const double toleranceThreshold)
+{
+    resultValidator->setValidationMethod(method);
+    resultValidator->setToleranceThreshold(toleranceThreshold);
+}
+
+void TuningRunner::setValidationRange(const ArgumentId id, const size_t range)
+{
+    resultValidator->setValidationRange(id, range);
+}
+
+void TuningRunner::setValidationBackend(const ArgumentId id, const ValidationBackend& backend)
+{
+    resultValidator->setValidationBackend(id, backend);
+}
+
+void TuningRunner::setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
+    const std::vector<ArgumentId>& validatedArgumentIds)
+{
+    resultValidator->setReferenceKernel(id, referenceId, referenceConfiguration, validatedArgumentIds);
+}
+
+void TuningRunner::setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass,
+    const std::vector<ArgumentId>& validatedArgumentIds)
+{
+    resultValidator->setReferenceClass(id, std::move(referenceClass), validatedArgumentIds);
+}
+
+void TuningRunner::setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath)
+{
+    resultValidator->setReferenceFile(id, argumentId, filePath);
+}
+
+void TuningRunner::setReferenceCache(const std::string& directoryPath)
+{
+    resultValidator->setReferenceCache(directoryPath);
+}
+
+void TuningRunner::setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator)
+{
+    if (tuningManipulators.find(id) != tuningManipulators.end())
+    {
+        tuningManipulators.erase(id);
+    }
+    tuningManipulators.insert(std::make_pair(id, std::move(manipulator)));
+}
+
+TuningResult TuningRunner::runKernelSimple(const Kernel& kernel, const KernelConfiguration& configuration,
+    const std::vector<ArgumentOutputDescriptor>& output, ComputeEngine& engine)
+{
+    KernelId kernelId = kernel.getId();
+    std::string kernelName = kernel.getName();
+    std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
+
+    KernelRuntimeData kernelData(kernelId, kernelName, source, configuration.getGlobalSize(), configuration.getLocalSize(), kernel.getArgumentIds());
+    KernelRunResult result = engine.runKernel(kernelData, argumentManager->getArguments(kernel.getArgumentIds()), output);
+
+    return TuningResult(kernelName, configuration, result);
+}
+
+TuningResult TuningRunner::runKernelWithManipulator(const Kernel& kernel, TuningManipulator* manipulator, const KernelConfiguration& configuration,
+    const std::vector<ArgumentOutputDescriptor>& output)
+{
+    KernelId kernelId = kernel.getId();
+    std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
+    KernelRuntimeData kernelData(kernelId, kernel.getName(), source, configuration.getGlobalSize(), configuration.getLocalSize(),
+        kernel.getArgumentIds());
+
+    manipulator->manipulatorInterface = manipulatorInterfaceImplementation.get();
+    manipulatorInterfaceImplementation->addKernel(kernelId, kernelData);
+    manipulatorInterfaceImplementation->setConfiguration(configuration);
+    manipulatorInterfaceImplementation->setKernelArguments(argumentManager->getArguments(kernel.getArgumentIds()));
+    if (manipulator->enableArgumentPreload())
+    {
+        manipulatorInterfaceImplementation->uploadBuffers();
+    }
+
+    Timer timer;
+    try
+    {
+        timer.start();
+        manipulator->launchComputation(kernelId);
+        timer.stop();
+    }
+    catch (const std::runtime_error&)
+    {
+        manipulatorInterfaceImplementation->clearData();
+        manipulator->manipulatorInterface = nullptr;
+        throw;
+    }
+
+    manipulatorInterfaceImplementation->downloadBuffers(output);
+    KernelRunResult result = manipulatorInterfaceImplementation->getCurrentResult();
+    size_t manipulatorDuration = timer.getElapsedTime();
+    manipulatorDuration -= result.getOverhead() + result.getCompilationDuration();
+
+    manipulatorInterfaceImplementation->clearData();
+    manipulator->manipulatorInterface = nullptr;
+
+    TuningResult tuningResult(kernel.getName(), configuration, result);
+    tuningResult.setManipulatorDuration(manipulatorDuration);
+    return tuningResult;
+}
+
+TuningResult TuningRunner::runCompositionWithManipulator(const KernelComposition& composition, TuningManipulator* manipulator,
+    const KernelConfiguration& configuration, const std::vector<ArgumentOutputDescriptor>& output)
+{
+    manipulator->manipulatorInterface = manipulatorInterfaceImplementation.get();
+    std::vector<KernelArgument*> allArguments = argumentManager->getArguments(composition.getSharedArgumentIds());
+
+    for (const auto kernel : composition.getKernels())
+    {
+        KernelId kernelId = kernel->getId();
         std::vector<ArgumentId> argumentIds = composition.getKernelArgumentIds(kernelId);
         std::string source = kernelManager->getKernelSourceWithDefines(kernelId, configuration);
 
-        KernelRuntimeData kernelData(kernelId, kernel->getName(), source, configuration.getCompositionKernelGlobalSize(kernelId),
-            configuration.getCompositionKernelLocalSize(kernelId), argumentIds);
-        manipulatorInterfaceImplementation->addKernel(kernelId, kernelData);
+        KernelRuntimeData kernelData(kernelId, kernel->getName(), source, configuration.getCompositionKernelGlobalSize(kernelId),
+            configuration.getCompositionKernelLocalSize(kernelId), argumentIds);
+        manipulatorInterfaceImplementation->addKernel(kernelId, kernelData);
+
+        std::vector<KernelArgument*> newArguments = argumentManager->getArguments(argumentIds);
+        for (const auto newArgument : newArguments)
+        {
+            if (!elementExists(newArgument, allArguments))
+            {
+                allArguments.push_back(newArgument);
+            }
+        }
+    }
+
+    manipulatorInterfaceImplementation->setConfiguration(configuration);
+    manipulatorInterfaceImplementation->setKernelArguments(allArguments);
+    if (manipulator->enableArgumentPreload())
+    {
+        manipulatorInterfaceImplementation->uploadBuffers();
+    }
+
+    Timer timer;
+    try
+    {
+        timer.start();
+        manipulator->launchComputation(composition.getId());
+        timer.stop();
+    }
+    catch (const std::runtime_error&)
+    {
+        manipulatorInterfaceImplementation->clearData();
+        manipulator->manipulatorInterface = nullptr;
+        throw;
+    }
+
+    manipulatorInterfaceImplementation->downloadBuffers(output);
+    KernelRunResult result = manipulatorInterfaceImplementation->getCurrentResult();
+    size_t manipulatorDuration = timer.getElapsedTime();
+    manipulatorDuration -= result.getOverhead() + result.getCompilationDuration();
+
+    manipulatorInterfaceImplementation->clearData();
+    manipulator->manipulatorInterface = nullptr;
+
+    TuningResult tuningResult(composition.getName(), configuration, result);
+    tuningResult.setManipulatorDuration(manipulatorDuration);
+    return tuningResult;
+}
+
+void TuningRunner::runKernelOnline(const Kernel& kernel, const KernelConfiguration& defaultConfiguration,
+    const std::vector<ArgumentOutputDescriptor>& output)
+{
+    OnlineTuner& onlineTuner = getOnlineTuner(kernel);
+    KernelConfiguration configuration = defaultConfiguration;
+
+    // Output of untested configuration is returned only after it is validated, so exploration requires reference
+    if (resultValidator->hasReference(kernel.getId()) && isExplorationSafe(kernel) && onlineTuner.getExploredConfiguration(configuration))
+    {
+        std::stringstream stream;
+        stream << "Exploring configuration of kernel <" << kernel.getName() << ">: " << configuration;
+        logger->log(stream.str());
+
+        // Whole exploring call is timed, time spent outside of kernel run is charged to exploration
+        Timer callTimer;
+        callTimer.start();
+
+        // Production runs use different input data, so reference result cannot be reused
+        resultValidator->clearReferenceResults();
+        resultValidator->computeReferenceResult(kernel);
+
+        TuningResult result(kernel.getName(), configuration);
+        Timer timer;
+        timer.start();
+        try
+        {
+            result = runKernelConfiguration(kernel, configuration);
+        }
+        catch (const std::runtime_error& error)
+        {
+            logger->log(std::string("Kernel run failed, reason: ") + error.what() + "\n");
+            result = TuningResult(kernel.getName(), configuration, std::string("Failed kernel run: ") + error.what());
+        }
+        timer.stop();
+
+        if (result.isValid() && !validateResult(kernel, result, *computeEngine))
+        {
+            result.setValid(false);
+            result.setStatusMessage("Results differ");
+        }
+        if (result.isValid())
+        {
+            downloadOutput(output);
+        }
+
+        computeEngine->clearBuffers();
+        resultValidator->clearReferenceResults();
+        if (resultDatabase != nullptr)
+        {
+            evaluateObjective(kernel.getId(), result);
+            resultDatabase->addResult(getResultDatabaseKey(kernel.getId()), result);
+        }
+        callTimer.stop();
+
+        // Duration of failed run is not measured by compute engine, but time spent on it still slows down production run
+        const uint64_t duration = result.getKernelDuration() == UINT64_MAX ? timer.getElapsedTime() : result.getTotalDuration();
+        onlineTuner.addResult(configuration, duration, result.isValid(), true);
+        onlineTuner.addExplorationCost(callTimer.getElapsedTime() - timer.getElapsedTime());
+        if (result.isValid())
+        {
+            return;
+        }
+        logger->log("Explored configuration is not valid, kernel is run again with validated configuration");
+    }
+
+    if (!onlineTuner.getExploitedConfiguration(configuration))
+    {
+        configuration = defaultConfiguration;
+    }
+
+    std::stringstream stream;
+    stream << "Running kernel <" << kernel.getName() << "> with configuration: " << configuration;
+    logger->log(stream.str());
+
+    try
+    {
+        TuningResult result(kernel.getName(), configuration);
+        if (kernel.hasTuningManipulator())
+        {
+            auto manipulatorPointer = tuningManipulators.find(kernel.getId());
+            result = runKernelWithManipulator(kernel, manipulatorPointer->second.get(), configuration, output);
+        }
+        else
+        {
+            result = runKernelSimple(kernel, configuration, output, *computeEngine);
+        }
+
+        // Exploited configuration was either validated or provided by application, which is trusted to produce correct output
+        onlineTuner.addResult(configuration, result.getTotalDuration(), true, false);
+    }
+    catch (const std::runtime_error& error)
+    {
+        logger->log(std::string("Kernel run failed, reason: ") + error.what() + "\n");
+    }
+
+    computeEngine->clearBuffers();
+}
+
+OnlineTuner& TuningRunner::getOnlineTuner(const Kernel& kernel)
+{
+    const KernelId id = kernel.getId();
+    auto tunerPointer = onlineTuners.find(id);
+    if (tunerPointer != onlineTuners.end())
+    {
+        return *tunerPointer->second;
+    }
+
+    // Tuner is created on the first run, so that results database and input signature may be specified after online tuning is enabled
+    const std::pair<double, double>& settings = onlineTuningSettings.find(id)->second;
+    unsigned int randomSeed = fixedSearchSeed ? static_cast<unsigned int>(std::mt19937(searchSeed)()) : std::random_device()();
+    std::vector<KernelConfiguration> configurations = kernelManager->getKernelConfigurations(id, computeEngine->getCurrentDeviceInfo());
+    auto onlineTuner = std::make_unique<OnlineTuner>(configurations, settings.first, settings.second, randomSeed);
+
+    if (resultDatabase != nullptr)
+    {
+        const std::string databaseKey = getResultDatabaseKey(id);
+        for (const auto& configuration : configurations)
+        {
+            TuningResult result(kernel.getName(), configuration);
+            if (resultDatabase->findResult(databaseKey, configuration, result))
+            {
+                onlineTuner->addStoredResult(configuration, result.getTotalDuration(), result.isValid());
+            }
+        }
+        logger->log(std::string("Online tuning of kernel <") + kernel.getName() + "> starts with "
+            + std::to_string(onlineTuner->getValidatedConfigurationsCount()) + " validated configurations from results database");
+    }
+
+    OnlineTuner& result = *onlineTuner;
+    onlineTuners.insert(std::make_pair(id, std::move(onlineTuner)));
+    return result;
+}
+
+bool TuningRunner::isExplorationSafe(const Kernel& kernel) const
+{
+    // Kernel writes zero-copy buffers directly into application memory in computation mode, so invalid output could not be discarded
+    for (const auto argumentId : kernel.getArgumentIds())
+    {
+        const KernelArgument& argument = argumentManager->getArgument(argumentId);
+        if (argument.getMemoryLocation() == ArgumentMemoryLocation::HostZeroCopy && argument.getAccessType() != ArgumentAccessType::ReadOnly)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TuningRunner::downloadOutput(const std::vector<ArgumentOutputDescriptor>& output)
+{
+    for (const auto& descriptor : output)
+    {
+        if (descriptor.getOutputSizeInBytes() == 0)
+        {
+            computeEngine->downloadArgument(descriptor.getArgumentId(), descriptor.getOutputDestination());
+        }
+        else
+        {
+            computeEngine->downloadArgument(descriptor.getArgumentId(), descriptor.getOutputDestination(), descriptor.getOutputSizeInBytes());
+        }
+    }
+}
+
+TuningResult TuningRunner::runKernelConfiguration(const Kernel& kernel, const KernelConfiguration& configuration)
+{
+    if (kernel.hasTuningManipulator())
+    {
+        auto manipulatorPointer = tuningManipulators.find(kernel.getId());
+        return runKernelWithManipulator(kernel, manipulatorPointer->second.get(), configuration, std::vector<ArgumentOutputDescriptor>{});
+    }
+    return runKernelSimple(kernel, configuration, std::vector<ArgumentOutputDescriptor>{}, *computeEngine);
+}
+
+void TuningRunner::resetKernelBuffers(const Kernel& kernel)
+{
+    computeEngine->clearBuffers(ArgumentAccessType::ReadWrite);
+    if (kernel.hasTuningManipulator())
+    {
+        computeEngine->clearBuffers(ArgumentAccessType::ReadOnly);
+    }
+}
+
+TuningResult TuningRunner::measureKernelConfiguration(const Kernel& kernel, const KernelConfiguration& configuration)
+{
+    return measureKernelConfiguration(kernel, configuration, nullptr);
+}
+
+TuningResult TuningRunner::measureKernelConfiguration(const Kernel& kernel, const KernelConfiguration& configuration,
+    std::vector<KernelArgument>* validatedOutput)
+{
+    TuningResult result(kernel.getName(), configuration);
+    try
+    {
+        result = runRepeatedly([this, &kernel, &configuration]() { return runKernelConfiguration(kernel, configuration); },
+            [this, &kernel]() { resetKernelBuffers(kernel); });
+    }
+    catch (const std::runtime_error& error)
+    {
+        logger->log(std::string("Kernel run failed, reason: ") + error.what() + "\n");
+        result = TuningResult(kernel.getName(), configuration, std::string("Failed kernel run: ") + error.what());
+    }
+
+    // Deferred validation only needs snapshot of output, buffers are cleared before it is compared
+    if (result.isValid() && validatedOutput != nullptr)
+    {
+        *validatedOutput = resultValidator->downloadValidatedArguments(kernel, *computeEngine);
+    }
+    else if (result.isValid() && !validateResult(kernel, result, *computeEngine))
+    {
+        result.setValid(false);
+        result.setStatusMessage("Results differ");
+    }
+
+    computeEngine->clearBuffers(ArgumentAccessType::ReadWrite);
+    computeEngine->clearBuffers(ArgumentAccessType::WriteOnly);
+    if (kernel.hasTuningManipulator())
+    {
+        computeEngine->clearBuffers(ArgumentAccessType::ReadOnly);
+    }
+    return result;
+}
+
+void TuningRunner::startValidation(const Kernel& kernel, const size_t resultIndex, const KernelConfiguration& configuration,
+    std::vector<KernelArgument>&& validatedOutput, std::deque<PendingValidation>& validations)
+{
+    // Comparison only reads reference results, which stay unchanged until all pending validations are completed
+    auto outcome = std::async(std::launch::async, [this, &kernel, configuration, output = std::move(validatedOutput)]()
+    {
+        return resultValidator->validateDownloadedArguments(kernel, configuration, output);
+    });
+    validations.push_back(PendingValidation{resultIndex, std::move(outcome)});
+}
+
+void TuningRunner::completeValidations(const Kernel& kernel, Searcher& searcher, TuningCheckpoint& checkpoint, const std::string& databaseKey,
+    const size_t maximumPendingCount, std::deque<PendingValidation>& validations, std::vector<TuningResult>& results)
+{
+    auto validationPointer = validations.begin();
+    while (validationPointer != validations.end())
+    {
+        // Oldest validations are waited for when too many of them are pending
+        const bool wait = validations.size() > maximumPendingCount;
+        if (!wait && validationPointer->outcome.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        {
+            ++validationPointer;
+            continue;
+        }
+
+        ResultValidator::ValidationOutcome outcome{false, 0.0, std::vector<std::string>{}};
+        try
+        {
+            outcome = validationPointer->outcome.get();
+        }
+        catch (const std::exception& error)
+        {
+            outcome.messages.push_back(std::string("Result validation failed, reason: ") + error.what());
+        }
+
+        TuningResult& result = results.at(validationPointer->resultIndex);
+        if (!applyValidationOutcome(result, outcome))
+        {
+            std::stringstream stream;
+            stream << "Result of kernel <" << kernel.getName() << "> with configuration: " << result.getConfiguration()
+                << " was invalidated after tuning continued";
+            logger->log(stream.str());
+            result.setValid(false);
+            result.setStatusMessage("Results differ");
+            searcher.invalidateResult(result);
+        }
+        stopCondition.updateStatus(result.isValid(), result.getTotalDuration());
+        storeResult(checkpoint, databaseKey, result);
+        validationPointer = validations.erase(validationPointer);
+    }
+}
+
+TuningResult TuningRunner::runRepeatedly(const std::function<TuningResult()>& run, const std::function<void()>& resetBuffers)
+{
+    uint64_t compilationDuration = 0;
+    for (size_t i = 0; i < warmUpRuns; i++)
+    {
+        compilationDuration += run().getCompilationDuration();
+        resetBuffers();
+    }
 
-        std::vector<KernelArgument*> newArguments = argumentManager->getArguments(argumentIds);
-        for (const auto newArgument : newArguments)
+    // Buffers modified by previous run are restored before each repetition, so that output of the last repetition can be validated
+    TuningResult result = run();
+    if (!result.isValid())
+    {
+        return result;
+    }
+
+    std::vector<uint64_t> kernelDurations{result.getKernelDuration()};
+    std::vector<uint64_t> manipulatorDurations{result.getManipulatorDuration()};
+    compilationDuration += result.getCompilationDuration();
+
+    for (size_t i = 1; i < repetitions; i++)
+    {
+        resetBuffers();
+        TuningResult repetitionResult = run();
+        kernelDurations.push_back(repetitionResult.getKernelDuration());
+        manipulatorDurations.push_back(repetitionResult.getManipulatorDuration());
+        compilationDuration += repetitionResult.getCompilationDuration();
+    }
+
+    result.setKernelDurationSamples(kernelDurations, durationStatistic);
+    result.setManipulatorDuration(getStatistic(manipulatorDurations, durationStatistic));
+    result.setCompilationDuration(compilationDuration);
+    return result;
+}
+
+std::string TuningRunner::getWorkerTaskName(const std::string& taskType, const std::string& name)
+{
+    // Tuning calls are numbered, so that worker serves the same call as the tuning process even if the kernel is tuned repeatedly
+    // with different inputs
+    const std::string task = taskType + " " + name;
+    return task + " #" + std::to_string(tuningCallCounts[task]++);
+}
+
+TuningResult TuningRunner::runIsolated(WorkerProcess& worker, const std::string& taskType, const KernelConfiguration& configuration,
+    const std::string& kernelName)
+{
+    std::string output;
+    std::string failureReason;
+    if (!worker.execute(taskType + " " + TuningCoordinator::serializeConfiguration(configuration), isolationTimeout, output, failureReason))
+    {
+        logger->log(std::string("Kernel run failed, reason: ") + failureReason + "\n");
+        return TuningResult(kernelName, configuration, std::string("Failed kernel run: ") + failureReason);
+    }
+
+    // Output of worker is not trusted, eg. kernel may corrupt memory of the worker before it writes the result
+    try
+    {
+        TuningResult result = TuningCheckpoint::deserializeResult(output, kernelName);
+        result.setConfiguration(configuration);
+        return result;
+    }
+    catch (const std::exception&)
+    {
+        worker.terminate();
+        logger->log("Kernel run failed, reason: worker process returned malformed result\n");
+        return TuningResult(kernelName, configuration, "Failed kernel run: worker process returned malformed result");
+    }
+}
+
+void TuningRunner::serveIsolatedRuns(const std::string& kernelName, const std::vector<KernelConfiguration>& configurations,
+    const std::function<TuningResult(const KernelConfiguration&)>& measure, const std::function<TuningResult(const KernelConfiguration&)>& run,
+    const std::function<void()>& resetBuffers)
+{
+    logger->log(std::string("Running configurations of kernel <") + kernelName + "> as isolated worker process");
+
+    // Task consists of task type ("measure" or "run" for final reranking) and serialized configuration
+    WorkerProcess::serve([&kernelName, &configurations, &measure, &run, &resetBuffers](const std::string& task)
+    {
+        const size_t separator = std::min(task.find(' '), task.size());
+        const std::vector<ParameterPair> parameterPairs = TuningCoordinator::deserializeConfiguration(
+            task.substr(std::min(separator + 1, task.size())));
+        auto configurationPointer = std::find_if(configurations.cbegin(), configurations.cend(),
+            [&parameterPairs](const KernelConfiguration& configuration)
         {
-            if (!elementExists(newArgument, allArguments))
+            return configuration.getParameterPairs() == parameterPairs;
+        });
+
+        if (configurationPointer == configurations.cend())
+        {
+            return TuningCheckpoint::serializeResult(TuningResult(kernelName, KernelConfiguration(DimensionVector(), DimensionVector(),
+                parameterPairs), "Failed kernel run: configuration is not part of configuration space of worker process"));
+        }
+        if (task.compare(0, separator, "run") == 0)
+        {
+            resetBuffers();
+            return TuningCheckpoint::serializeResult(run(*configurationPointer));
+        }
+        return TuningCheckpoint::serializeResult(measure(*configurationPointer));
+    });
+}
+
+void TuningRunner::tuneKernelInParallel(const KernelId id, const Kernel& kernel, Searcher& searcher, TuningCheckpoint& checkpoint,
+    const std::string& databaseKey, const size_t configurationsCount, std::vector<TuningResult>& results)
+{
+    std::vector<ComputeEngine*> engines{computeEngine};
+    engines.insert(engines.end(), parallelEngines.cbegin(), parallelEngines.cend());
+
+    std::vector<DeviceInfo> devices;
+    for (const auto engine : engines)
+    {
+        devices.push_back(engine->getCurrentDeviceInfo());
+        if (devices.back().getName() != devices.front().getName())
+        {
+            logger->log(std::string("Warning: parallel tuning devices differ (") + devices.front().getName() + ", " + devices.back().getName()
+                + "), durations of configurations measured on different devices are not comparable");
+        }
+    }
+    logger->log(std::string("Tuning kernel <") + kernel.getName() + "> on " + std::to_string(engines.size()) + " devices in parallel");
+
+    // Worker threads only run the kernel on their device, searcher, validation, logging and checkpoint are handled by this thread
+    std::mutex completionMutex;
+    std::condition_variable completionCondition;
+    std::deque<size_t> completedDevices;
+    std::vector<std::string> failures(engines.size());
+    std::vector<std::future<TuningResult>> runs(engines.size());
+    std::vector<bool> busyDevices(engines.size(), false);
+    size_t busyCount = 0;
+    size_t launchedCount = 0;
+    bool stopped = false;
+
+    auto processResult = [this, &searcher, &results, &stopped](const TuningResult& result)
+    {
+        results.push_back(result);
+        searcher.processBatchResult(result);
+        stopCondition.updateStatus(result.isValid(), result.getTotalDuration());
+        stopped |= stopCondition.isSatisfied();
+    };
+
+    while (true)
+    {
+        size_t device = 0;
+        while (!stopped && launchedCount < configurationsCount && device < engines.size())
+        {
+            if (busyDevices.at(device))
             {
-                allArguments.push_back(newArgument);
+                device++;
+                continue;
+            }
+
+            std::vector<KernelConfiguration> batch = searcher.getNextConfigurationBatch(1);
+            if (batch.empty())
+            {
+                break;
+            }
+
+            const KernelConfiguration configuration = batch.at(0);
+            launchedCount++;
+            TuningResult restoredResult(kernel.getName(), configuration);
+
+            const std::string storeName = findStoredResult(checkpoint, databaseKey, configuration, restoredResult);
+            if (!storeName.empty())
+            {
+                std::stringstream stream;
+                stream << "Restoring result of kernel <" << kernel.getName() << "> with configuration (" << launchedCount << " / "
+                    << configurationsCount << ") from " << storeName << ": " << configuration;
+                logger->log(stream.str());
+                processResult(restoredResult);
+                continue;
             }
+
+            std::stringstream stream;
+            stream << "Launching kernel <" << kernel.getName() << "> on device " << devices.at(device).getId() << " with configuration ("
+                << launchedCount << " / " << configurationsCount << "): " << configuration;
+            logger->log(stream.str());
+
+            ComputeEngine* engine = engines.at(device);
+            busyDevices.at(device) = true;
+            busyCount++;
+            runs.at(device) = std::async(std::launch::async, [this, &kernel, &completionMutex, &completionCondition, &completedDevices, &failures,
+                engine, device, configuration]()
+            {
+                TuningResult result(kernel.getName(), configuration);
+                try
+                {
+                    result = runRepeatedly([this, &kernel, engine, &configuration]()
+                    {
+                        return runKernelSimple(kernel, configuration, std::vector<ArgumentOutputDescriptor>{}, *engine);
+                    },
+                    [engine]() { engine->clearBuffers(ArgumentAccessType::ReadWrite); });
+                }
+                catch (const std::exception& error)
+                {
+                    failures.at(device) = error.what();
+                    result = TuningResult(kernel.getName(), configuration, std::string("Failed kernel run: ") + error.what());
+                }
+
+                std::lock_guard<std::mutex> lock(completionMutex);
+                completedDevices.push_back(device);
+                completionCondition.notify_one();
+                return result;
+            });
+            device++;
+        }
+
+        if (busyCount == 0)
+        {
+            break;
         }
+
+        std::unique_lock<std::mutex> lock(completionMutex);
+        completionCondition.wait(lock, [&completedDevices]() { return !completedDevices.empty(); });
+        const size_t completedDevice = completedDevices.front();
+        completedDevices.pop_front();
+        lock.unlock();
+
+        TuningResult result = runs.at(completedDevice).get();
+        busyDevices.at(completedDevice) = false;
+        busyCount--;
+
+        if (!failures.at(completedDevice).empty())
+        {
+            logger->log(std::string("Kernel run failed, reason: ") + failures.at(completedDevice) + "\n");
+            failures.at(completedDevice).clear();
+        }
+        ComputeEngine* engine = engines.at(completedDevice);
+        if (result.isValid() && !validateResult(kernel, result, *engine))
+        {
+            result.setValid(false);
+            result.setStatusMessage("Results differ");
+        }
+        engine->clearBuffers(ArgumentAccessType::ReadWrite);
+        engine->clearBuffers(ArgumentAccessType::WriteOnly);
+
+        result.setDevice(devices.at(completedDevice).getId(), devices.at(completedDevice).getName());
+        evaluateObjective(id, result);
+        storeResult(checkpoint, databaseKey, result);
+        processResult(result);
     }
 
-    manipulatorInterfaceImplementation->setConfiguration(configuration);
-    manipulatorInterfaceImplementation->setKernelArguments(allArguments);
-    if (manipulator->enableArgumentPreload())
+    for (const auto engine : parallelEngines)
     {
-        manipulatorInterfaceImplementation->uploadBuffers();
+        engine->clearBuffers();
     }
+}
 
-    Timer timer;
-    try
+bool TuningRunner::tuneNextBatchConfiguration(BatchTuningState& state)
+{
+    const Kernel& kernel = *state.kernel;
+    const KernelId id = kernel.getId();
+    const size_t index = state.results.size();
+    KernelConfiguration currentConfiguration = state.searcher->getNextConfiguration();
+    TuningResult result(kernel.getName(), currentConfiguration);
+
+    const std::string storeName = findStoredResult(state.checkpoint, state.databaseKey, currentConfiguration, result);
+    if (!storeName.empty())
     {
+        std::stringstream stream;
+        stream << "Restoring result of kernel <" << kernel.getName() << "> with configuration (" << index + 1 << " / "
+            << state.configurationsCount << ") from " << storeName << ": " << currentConfiguration;
+        logger->log(stream.str());
+    }
+    else
+    {
+        std::stringstream stream;
+        stream << "Launching kernel <" << kernel.getName() << "> with configuration (" << index + 1 << " / " << state.configurationsCount
+            << "): " << currentConfiguration;
+        logger->log(stream.str());
+
+        Timer timer;
         timer.start();
-        manipulator->launchComputation(composition.getId());
+        result = measureKernelConfiguration(kernel, currentConfiguration);
         timer.stop();
+
+        // Device time of valid run is charged, failed run is charged by the time it took
+        DeviceInfo deviceInfo = computeEngine->getCurrentDeviceInfo();
+        state.spentTime += result.getKernelDuration() == UINT64_MAX ? timer.getElapsedTime()
+            : result.getTotalDuration() + result.getCompilationDuration();
+        result.setDevice(deviceInfo.getId(), deviceInfo.getName());
+        evaluateObjective(id, result);
+        storeResult(state.checkpoint, state.databaseKey, result);
     }
-    catch (const std::runtime_error&)
+
+    state.results.push_back(result);
+    state.searcher->calculateNextConfiguration(result);
+    state.stopCondition.updateStatus(result.isValid(), result.getTotalDuration());
+
+    auto budgetPointer = tuningBudgets.find(id);
+    const bool timeExhausted = budgetPointer != tuningBudgets.end() && budgetPointer->second.first > 0.0
+        && static_cast<double>(state.spentTime) >= budgetPointer->second.first * 1'000'000'000.0;
+    const bool countExhausted = budgetPointer != tuningBudgets.end() && budgetPointer->second.second > 0
+        && state.results.size() >= budgetPointer->second.second;
+
+    if (timeExhausted || countExhausted)
     {
-        manipulatorInterfaceImplementation->clearData();
-        manipulator->manipulatorInterface = nullptr;
-        throw;
+        stopReasons[id] = std::string("Tuning budget of the kernel was exhausted");
+        return true;
+    }
+    if (state.stopCondition.isSatisfied() || state.results.size() >= state.configurationsCount)
+    {
+        stopReasons[id] = state.stopCondition.getStatusString();
+        return true;
     }
+    return false;
+}
 
-    manipulatorInterfaceImplementation->downloadBuffers(output);
-    KernelRunResult result = manipulatorInterfaceImplementation->getCurrentResult();
-    size_t manipulatorDuration = timer.getElapsedTime();
-    manipulatorDuration -= result.getOverhead();
+void TuningRunner::tuneKernelDistributed(const KernelId id, const Kernel& kernel, Searcher& searcher, TuningCheckpoint& checkpoint,
+    const std::string& databaseKey, const size_t configurationsCount, std::vector<TuningResult>& results)
+{
+    size_t proposedCount = 0;
+    bool stopped = false;
 
-    manipulatorInterfaceImplementation->clearData();
-    manipulator->manipulatorInterface = nullptr;
+    auto completeResult = [this, &searcher, &results, &stopped](const TuningResult& result)
+    {
+        results.push_back(result);
+        searcher.processBatchResult(result);
+        stopCondition.updateStatus(result.isValid(), result.getTotalDuration());
+        stopped |= stopCondition.isSatisfied();
+    };
+
+    auto getBatch = [this, &kernel, &searcher, &checkpoint, &databaseKey, configurationsCount, &proposedCount, &stopped, &completeResult](
+        const size_t maximumCount)
+    {
+        std::vector<KernelConfiguration> batch;
+        while (!stopped && proposedCount < configurationsCount && batch.size() < maximumCount)
+        {
+            std::vector<KernelConfiguration> nextBatch = searcher.getNextConfigurationBatch(std::min(maximumCount - batch.size(),
+                configurationsCount - proposedCount));
+            if (nextBatch.empty())
+            {
+                break;
+            }
 
-    TuningResult tuningResult(composition.getName(), configuration, result);
-    tuningResult.setManipulatorDuration(manipulatorDuration);
-    return tuningResult;
+            for (const auto& configuration : nextBatch)
+            {
+                proposedCount++;
+                TuningResult restoredResult(kernel.getName(), configuration);
+                std::stringstream stream;
+
+                const std::string storeName = findStoredResult(checkpoint, databaseKey, configuration, restoredResult);
+                if (!storeName.empty())
+                {
+                    stream << "Restoring result of kernel <" << kernel.getName() << "> with configuration (" << proposedCount << " / "
+                        << configurationsCount << ") from " << storeName << ": " << configuration;
+                    logger->log(stream.str());
+                    completeResult(restoredResult);
+                    continue;
+                }
+
+                stream << "Distributing kernel <" << kernel.getName() << "> configuration (" << proposedCount << " / " << configurationsCount
+                    << ") to workers: " << configuration;
+                logger->log(stream.str());
+                batch.push_back(configuration);
+            }
+        }
+        return batch;
+    };
+
+    auto processResult = [this, id, &kernel, &checkpoint, &databaseKey, &completeResult](const TuningResult& receivedResult)
+    {
+        TuningResult result = receivedResult;
+        if (!result.isValid())
+        {
+            logger->log(std::string("Configuration of kernel <") + kernel.getName() + "> failed on worker, reason: "
+                + result.getStatusMessage());
+        }
+        evaluateObjective(id, result);
+        storeResult(checkpoint, databaseKey, result);
+        completeResult(result);
+    };
+
+    tuningCoordinator->coordinate(kernel.getName(), getBatch, processResult);
+}
+
+std::string TuningRunner::getResultDatabaseKey(const KernelId id) const
+{
+    if (resultDatabase == nullptr)
+    {
+        return std::string();
+    }
+
+    // Parameter space is identified by kernel sizes and parameter values, constraints cannot be compared and are not part of the key
+    std::string source;
+    std::stringstream parameterSpace;
+    std::vector<KernelParameter> parameters;
+    if (kernelManager->isComposition(id))
+    {
+        const KernelComposition& composition = kernelManager->getKernelComposition(id);
+        for (const auto kernel : composition.getKernels())
+        {
+            source += kernel->getSource();
+            parameterSpace << kernel->getName() << " " << kernel->getGlobalSize() << " " << kernel->getLocalSize() << ";";
+        }
+        parameters = composition.getParameters();
+    }
+    else
+    {
+        const Kernel& kernel = kernelManager->getKernel(id);
+        source = kernel.getSource();
+        parameterSpace << kernel.getName() << " " << kernel.getGlobalSize() << " " << kernel.getLocalSize() << ";";
+        parameters = kernel.getParameters();
+    }
+
+    for (const auto& parameter : parameters)
+    {
+        parameterSpace << parameter.getName() << ":";
+        for (const auto value : parameter.getValues())
+        {
+            parameterSpace << value << ",";
+        }
+        parameterSpace << ";";
+    }
+
+    auto signaturePointer = inputSignatures.find(id);
+    const std::string inputSignature = signaturePointer == inputSignatures.end() ? std::string() : signaturePointer->second;
+    return ResultDatabase::getKey(source, parameterSpace.str(), computeEngine->getCurrentDeviceInfo(), inputSignature);
+}
+
+std::string TuningRunner::findStoredResult(const TuningCheckpoint& checkpoint, const std::string& databaseKey,
+    const KernelConfiguration& configuration, TuningResult& result) const
+{
+    if (checkpoint.restoreResult(configuration, result))
+    {
+        return std::string("checkpoint");
+    }
+    if (resultDatabase != nullptr && resultDatabase->findResult(databaseKey, configuration, result))
+    {
+        return std::string("results database");
+    }
+    return std::string();
+}
+
+void TuningRunner::storeResult(TuningCheckpoint& checkpoint, const std::string& databaseKey, const TuningResult& result)
+{
+    checkpoint.appendResult(result);
+    if (resultDatabase != nullptr)
+    {
+        resultDatabase->addResult(databaseKey, result);
+    }
+}
+
+unsigned int TuningRunner::openCheckpoint(TuningCheckpoint& checkpoint, const KernelId id, const std::string& kernelName, const bool resume)
+{
+    // Fixed seed is scrambled, since searcher engines produce poorly distributed initial values for small seeds
+    unsigned int randomSeed = fixedSearchSeed ? static_cast<unsigned int>(std::mt19937(searchSeed)()) : std::random_device()();
+
+    auto filePointer = checkpointFiles.find(id);
+    if (resume)
+    {
+        if (filePointer == checkpointFiles.end())
+        {
+            throw std::runtime_error(std::string("No checkpoint file specified for kernel with id: ") + std::to_string(id));
+        }
+
+        // Searcher created with recorded seed proposes the same configurations again, their results are restored without running them
+        checkpoint.load(filePointer->second, kernelName);
+        randomSeed = checkpoint.getSearchSeed();
+        logger->log(std::string("Resuming tuning of kernel <") + kernelName + "> with " + std::to_string(checkpoint.getRecordedResultCount())
+            + " results recorded in checkpoint file: " + filePointer->second);
+    }
+    else if (filePointer != checkpointFiles.end())
+    {
+        checkpoint.create(filePointer->second, kernelName, randomSeed);
+    }
+
+    return randomSeed;
+}
+
+void TuningRunner::rerankResults(const KernelId id, const std::string& kernelName, std::vector<TuningResult>& results,
+    const std::function<TuningResult(const KernelConfiguration&)>& run, const std::function<void()>& resetBuffers)
+{
+    std::vector<size_t> candidates;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        if (results.at(i).isValid())
+        {
+            candidates.push_back(i);
+        }
+    }
+
+    if (rerankingCandidates < 2 || candidates.size() < 2)
+    {
+        return;
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [&results](const size_t first, const size_t second)
+    {
+        return results.at(first).getObjectiveValue() < results.at(second).getObjectiveValue();
+    });
+    candidates.resize(std::min(candidates.size(), rerankingCandidates));
+    logger->log(std::string("Reranking ") + std::to_string(candidates.size()) + " best configurations of kernel <" + kernelName + "> in "
+        + std::to_string(rerankingRounds) + " rounds");
+
+    // Candidates are measured in interleaved order, rotated each round, so that slow drift of device clocks and temperature affects
+    // all of them equally
+    std::vector<std::vector<uint64_t>> kernelDurations(candidates.size());
+    std::vector<std::vector<uint64_t>> manipulatorDurations(candidates.size());
+    for (size_t round = 0; round < rerankingRounds; round++)
+    {
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            const size_t candidate = (i + round) % candidates.size();
+            try
+            {
+                resetBuffers();
+                TuningResult result = run(results.at(candidates.at(candidate)).getConfiguration());
+                if (result.isValid())
+                {
+                    kernelDurations.at(candidate).push_back(result.getKernelDuration());
+                    manipulatorDurations.at(candidate).push_back(result.getManipulatorDuration());
+                }
+            }
+            catch (const std::runtime_error& error)
+            {
+                logger->log(std::string("Kernel run failed during reranking, reason: ") + error.what() + "\n");
+            }
+        }
+    }
+    computeEngine->clearBuffers();
+
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        if (kernelDurations.at(i).empty())
+        {
+            continue;
+        }
+
+        TuningResult& result = results.at(candidates.at(i));
+        result.setKernelDurationSamples(kernelDurations.at(i), durationStatistic);
+        result.setManipulatorDuration(getStatistic(manipulatorDurations.at(i), durationStatistic));
+        evaluateObjective(id, result);
+    }
+
+    std::vector<size_t> order(candidates.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&results, &candidates, &kernelDurations](const size_t first, const size_t second)
+    {
+        // Candidates which failed during reranking are placed last
+        if (kernelDurations.at(first).empty() != kernelDurations.at(second).empty())
+        {
+            return kernelDurations.at(second).empty();
+        }
+        return results.at(candidates.at(first)).getObjectiveValue() < results.at(candidates.at(second)).getObjectiveValue();
+    });
+
+    const double pValue = getMannWhitneyPValue(kernelDurations.at(order.at(0)), kernelDurations.at(order.at(1)));
+    const bool distinguishable = pValue < rerankingSignificanceLevel;
+    distinguishableResults[id] = distinguishable;
+
+    std::stringstream stream;
+    stream << "Best configuration of kernel <" << kernelName << "> after reranking is " << (distinguishable ? "" : "not ")
+        << "statistically distinguishable from the second best configuration (p-value " << pValue << "): "
+        << results.at(candidates.at(order.at(0))).getConfiguration();
+    logger->log(stream.str());
 }
 
-std::unique_ptr<Searcher> TuningRunner::getSearcher(const SearchMethod& method, const std::vector<double>& arguments,
-    const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters) const
+std::unique_ptr<Searcher> TuningRunner::getSearcher(const KernelId id, const SearchMethod& method, const std::vector<double>& arguments,
+    const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters, const unsigned int randomSeed) const
 {
     std::unique_ptr<Searcher> searcher;
 
@@ -420,14 +1945,54 @@ std::unique_ptr<Searcher> TuningRunner::getSearcher(const SearchMethod& method,
         searcher = std::make_unique<FullSearcher>(configurations);
         break;
     case SearchMethod::RandomSearch:
-        searcher = std::make_unique<RandomSearcher>(configurations, arguments.at(0));
+        searcher = std::make_unique<RandomSearcher>(configurations, arguments.at(0), randomSeed);
         break;
     case SearchMethod::PSO:
         searcher = std::make_unique<PSOSearcher>(configurations, parameters, arguments.at(0), static_cast<size_t>(arguments.at(1)), arguments.at(2),
-            arguments.at(3), arguments.at(4));
+            arguments.at(3), arguments.at(4), randomSeed);
         break;
     case SearchMethod::Annealing:
-        searcher = std::make_unique<AnnealingSearcher>(configurations, arguments.at(0), arguments.at(1));
+        searcher = std::make_unique<AnnealingSearcher>(configurations, arguments.at(0), arguments.at(1), randomSeed);
+        break;
+    case SearchMethod::TransferLearning:
+    {
+        auto resultsPointer = priorResults.find(id);
+        if (resultsPointer == priorResults.end())
+        {
+            throw std::runtime_error(std::string("Transfer learning search requires prior results for kernel with id: ") + std::to_string(id));
+        }
+        searcher = std::make_unique<TransferSearcher>(configurations, resultsPointer->second, arguments.at(0),
+            static_cast<size_t>(arguments.at(1)), randomSeed);
+        break;
+    }
+    case SearchMethod::PatternSearch:
+        searcher = std::make_unique<PatternSearcher>(configurations, parameters, arguments.at(0), randomSeed);
+        break;
+    case SearchMethod::Portfolio:
+    {
+        std::vector<std::unique_ptr<Searcher>> searchers;
+        searchers.push_back(std::make_unique<RandomSearcher>(configurations, 1.0, randomSeed + 1));
+        searchers.push_back(std::make_unique<AnnealingSearcher>(configurations, arguments.at(0), 4.0, randomSeed + 2));
+        searchers.push_back(std::make_unique<PSOSearcher>(configurations, parameters, arguments.at(0), 8, 0.4, 0.4, 0.1, randomSeed + 3));
+        searchers.push_back(std::make_unique<PatternSearcher>(configurations, parameters, 1.0, randomSeed + 4));
+
+        auto resultsPointer = priorResults.find(id);
+        if (resultsPointer != priorResults.end())
+        {
+            searchers.push_back(std::make_unique<TransferSearcher>(configurations, resultsPointer->second, 1.0, 5, randomSeed + 5));
+        }
+        searcher = std::make_unique<PortfolioSearcher>(configurations, std::move(searchers), arguments.at(0), randomSeed);
+        break;
+    }
+    case SearchMethod::Pareto:
+        searcher = std::make_unique<ParetoSearcher>(configurations, arguments.at(0), randomSeed);
+        break;
+    case SearchMethod::CostAware:
+        searcher = std::make_unique<CostAwareSearcher>(configurations, arguments.at(0), arguments.at(1), randomSeed,
+            [this, id](const KernelConfiguration& configuration) { return isConfigurationCached(id, configuration); });
+        break;
+    case SearchMethod::ProfileGuided:
+        searcher = std::make_unique<ProfileGuidedSearcher>(configurations, parameters, arguments.at(0), randomSeed);
         break;
     default:
         throw std::runtime_error("Specified searcher is not supported");
@@ -436,21 +2001,83 @@ std::unique_ptr<Searcher> TuningRunner::getSearcher(const SearchMethod& method,
     return searcher;
 }
 
-bool TuningRunner::validateResult(const Kernel& kernel, const TuningResult& result)
+Searcher* TuningRunner::getCustomSearcher(const KernelId id) const
 {
-    if (runMode == RunMode::Computation)
+    auto searcherPointer = customSearchers.find(id);
+    if (searcherPointer == customSearchers.end())
+    {
+        return nullptr;
+    }
+    return searcherPointer->second.get();
+}
+
+bool TuningRunner::isConfigurationCached(const KernelId id, const KernelConfiguration& configuration) const
+{
+    if (!kernelManager->isComposition(id))
+    {
+        return computeEngine->isProgramCached(kernelManager->getKernelSourceWithDefines(id, configuration));
+    }
+
+    for (const auto kernel : kernelManager->getKernelComposition(id).getKernels())
+    {
+        if (!computeEngine->isProgramCached(kernelManager->getKernelSourceWithDefines(kernel->getId(), configuration)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void TuningRunner::evaluateObjective(const KernelId id, TuningResult& result) const
+{
+    auto objectivePointer = objectives.find(id);
+    if (!result.isValid() || objectivePointer == objectives.end())
+    {
+        return;
+    }
+
+    try
+    {
+        result.setObjectiveValue(objectivePointer->second(result));
+    }
+    catch (const std::runtime_error& error)
     {
-        throw std::runtime_error("Validation cannot be performed in computation mode");
+        logger->log(std::string("Objective evaluation failed, reason: ") + error.what() + "\n");
+        result.setValid(false);
+        result.setStatusMessage(std::string("Failed objective evaluation: ") + error.what());
     }
+}
 
+bool TuningRunner::validateResult(const Kernel& kernel, TuningResult& result, ComputeEngine& resultEngine)
+{
     if (!result.isValid())
     {
         return false;
     }
 
-    bool resultIsCorrect = resultValidator->validateArgumentsWithClass(kernel, result.getConfiguration());
-    resultIsCorrect &= resultValidator->validateArgumentsWithKernel(kernel, result.getConfiguration());
+    resultValidator->resetMaximumError();
+    bool resultIsCorrect = resultValidator->validateArgumentsWithClass(kernel, result.getConfiguration(), resultEngine);
+    resultIsCorrect &= resultValidator->validateArgumentsWithKernel(kernel, result.getConfiguration(), resultEngine);
+    resultIsCorrect &= resultValidator->validateArgumentsWithFile(kernel, result.getConfiguration(), resultEngine);
+    result.setMaximumError(resultValidator->getMaximumError());
+    logValidationResult(result, resultIsCorrect);
+    return resultIsCorrect;
+}
+
+bool TuningRunner::applyValidationOutcome(TuningResult& result, const ResultValidator::ValidationOutcome& outcome)
+{
+    for (const auto& message : outcome.messages)
+    {
+        logger->log(message);
+    }
+
+    result.setMaximumError(outcome.maximumError);
+    logValidationResult(result, outcome.valid);
+    return outcome.valid;
+}
 
+void TuningRunner::logValidationResult(const TuningResult& result, const bool resultIsCorrect) const
+{
     if (resultIsCorrect)
     {
         logger->log(std::string("Kernel run completed successfully in ") + std::to_string((result.getTotalDuration()) / 1'000'000)
@@ -460,8 +2087,13 @@ bool TuningRunner::validateResult(const Kernel& kernel, const TuningResult& resu
     {
         logger->log("Kernel run completed successfully, but results differ\n");
     }
+}
 
-    return resultIsCorrect;
+void TuningRunner::logTuningStop(const KernelId id, const std::string& kernelName)
+{
+    std::string reason = stopCondition.getStatusString();
+    stopReasons[id] = reason;
+    logger->log(std::string("Tuning of kernel <") + kernelName + "> stopped, reason: " + reason);
 }
 
 std::string TuningRunner::getSearchMethodName(const SearchMethod& method) const
@@ -476,6 +2108,18 @@ std::string TuningRunner::getSearchMethodName(const SearchMethod& method) const
         return std::string("PSO");
     case SearchMethod::Annealing:
         return std::string("Annealing");
+    case SearchMethod::TransferLearning:
+        return std::string("TransferLearning");
+    case SearchMethod::PatternSearch:
+        return std::string("PatternSearch");
+    case SearchMethod::Portfolio:
+        return std::string("Portfolio");
+    case SearchMethod::Pareto:
+        return std::string("Pareto");
+    case SearchMethod::CostAware:
+        return std::string("CostAware");
+    case SearchMethod::ProfileGuided:
+        return std::string("ProfileGuided");
     default:
         return std::string("Unknown search method");
     }
@@ -1,15 +1,26 @@
 #pragma once
 
+#include <deque>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 #include "manipulator_interface_implementation.h"
+#include "online_tuner.h"
+#include "result_database.h"
 #include "result_validator.h"
-#include "searcher/searcher.h"
+#include "stop_condition.h"
+#include "tuning_checkpoint.h"
+#include "tuning_coordinator.h"
+#include "worker_process.h"
+#include "api/searcher.h"
 #include "api/tuning_manipulator.h"
 #include "compute_engine/compute_engine.h"
 #include "dto/tuning_result.h"
+#include "enum/duration_statistic.h"
 #include "enum/search_method.h"
 #include "kernel/kernel_manager.h"
 #include "kernel_argument/argument_manager.h"
@@ -26,19 +37,75 @@ public:
         const RunMode& runMode);
 
     // Core methods
-    std::vector<TuningResult> tuneKernel(const KernelId id);
-    std::vector<TuningResult> tuneKernelComposition(const KernelId id);
+    std::vector<TuningResult> tuneKernel(const KernelId id, const bool resume = false);
+    std::vector<TuningResult> tuneKernelComposition(const KernelId id, const bool resume = false);
+    std::vector<std::vector<TuningResult>> tuneKernels(const std::vector<KernelId>& ids);
     void runKernel(const KernelId id, const std::vector<ParameterPair>& configuration, const std::vector<ArgumentOutputDescriptor>& output);
     void runComposition(const KernelId id, const std::vector<ParameterPair>& configuration, const std::vector<ArgumentOutputDescriptor>& output);
     void setSearchMethod(const SearchMethod& method, const std::vector<double>& arguments);
+    void setSearchSeed(const unsigned int seed);
+    void setSearcher(const KernelId id, std::unique_ptr<Searcher> searcher);
+    void setObjective(const KernelId id, const std::function<double(const TuningResult&)>& objective);
+    void setStopCondition(const StopCriterion& criterion, const double value);
+    void clearStopConditions();
+    void setPriorResults(const KernelId id, const std::vector<TuningResult>& results);
+    void setMeasurementRepetitions(const size_t warmUpRuns, const size_t repetitions);
+    void setDurationStatistic(const DurationStatistic& statistic);
+    void setCheckpointFile(const KernelId id, const std::string& filePath);
+    void setProcessIsolation(const bool flag, const double timeout);
+    void setProcessIsolationArguments(const std::vector<std::string>& arguments);
+    void setAsynchronousValidation(const bool flag);
+    void setParallelEngines(const std::vector<ComputeEngine*>& engines);
+    void setTuningCoordinator(const std::string& bindAddress, const uint16_t port, const size_t batchSize);
+    uint16_t getTuningCoordinatorPort() const;
+    void runTuningWorker(const KernelId id, const std::string& coordinatorHost, const uint16_t port);
+    void setResultDatabase(const std::string& filePath);
+    void setInputSignature(const KernelId id, const std::string& signature);
+    std::string getInputSignature(const KernelId id) const;
+    std::vector<ParameterPair> getStoredBestConfiguration(const KernelId id) const;
+    bool hasResultDatabase() const;
+    void setOnlineTuning(const KernelId id, const bool flag, const double explorationProbability, const double maximumSlowdown);
+    void setTuningPriority(const KernelId id, const double priority);
+    void setTuningBudget(const KernelId id, const double tuningTime, const size_t configurationCount);
+    void setFinalReranking(const size_t candidateCount, const size_t rounds);
+    bool isBestResultDistinguishable(const KernelId id) const;
+    std::string getStopReason(const KernelId id) const;
     void setValidationMethod(const ValidationMethod& method, const double toleranceThreshold);
     void setValidationRange(const ArgumentId id, const size_t range);
+    void setValidationBackend(const ArgumentId id, const ValidationBackend& backend);
     void setReferenceKernel(const KernelId id, const KernelId referenceId, const std::vector<ParameterPair>& referenceConfiguration,
         const std::vector<ArgumentId>& validatedArgumentIds);
     void setReferenceClass(const KernelId id, std::unique_ptr<ReferenceClass> referenceClass, const std::vector<ArgumentId>& validatedArgumentIds);
+    void setReferenceFile(const KernelId id, const ArgumentId argumentId, const std::string& filePath);
+    void setReferenceCache(const std::string& directoryPath);
     void setTuningManipulator(const KernelId id, std::unique_ptr<TuningManipulator> manipulator);
 
 private:
+    static constexpr double rerankingSignificanceLevel = 0.05;
+
+    // Progress of a kernel which is tuned together with other kernels
+    struct BatchTuningState
+    {
+        const Kernel* kernel;
+        std::unique_ptr<Searcher> defaultSearcher;
+        Searcher* searcher;
+        TuningCheckpoint checkpoint;
+        std::string databaseKey;
+        size_t configurationsCount;
+        StopCondition stopCondition;
+        double priority;
+        uint64_t spentTime;
+        bool finished;
+        std::vector<TuningResult> results;
+    };
+
+    // Comparison of configuration output with reference which runs on host thread while tuning continues
+    struct PendingValidation
+    {
+        size_t resultIndex;
+        std::future<ResultValidator::ValidationOutcome> outcome;
+    };
+
     // Attributes
     ArgumentManager* argumentManager;
     KernelManager* kernelManager;
@@ -49,18 +116,85 @@ private:
     std::unique_ptr<ManipulatorInterfaceImplementation> manipulatorInterfaceImplementation;
     SearchMethod searchMethod;
     std::vector<double> searchArguments;
+    bool fixedSearchSeed;
+    unsigned int searchSeed;
+    std::map<KernelId, std::unique_ptr<Searcher>> customSearchers;
+    std::map<KernelId, std::function<double(const TuningResult&)>> objectives;
+    StopCondition stopCondition;
+    std::map<KernelId, std::string> stopReasons;
+    std::map<KernelId, std::vector<TuningResult>> priorResults;
+    size_t warmUpRuns;
+    size_t repetitions;
+    DurationStatistic durationStatistic;
+    size_t rerankingCandidates;
+    size_t rerankingRounds;
+    std::map<KernelId, bool> distinguishableResults;
+    std::map<KernelId, std::string> checkpointFiles;
+    bool processIsolation;
+    double isolationTimeout;
+    std::vector<std::string> isolationArguments;
+    std::map<std::string, size_t> tuningCallCounts;
+    bool asynchronousValidation;
+    std::vector<ComputeEngine*> parallelEngines;
+    std::unique_ptr<TuningCoordinator> tuningCoordinator;
+    std::unique_ptr<ResultDatabase> resultDatabase;
+    std::map<KernelId, std::string> inputSignatures;
+    std::map<KernelId, std::pair<double, double>> onlineTuningSettings;
+    std::map<KernelId, std::unique_ptr<OnlineTuner>> onlineTuners;
+    std::map<KernelId, double> tuningPriorities;
+    std::map<KernelId, std::pair<double, size_t>> tuningBudgets;
     RunMode runMode;
 
     // Helper methods
     TuningResult runKernelSimple(const Kernel& kernel, const KernelConfiguration& configuration,
-        const std::vector<ArgumentOutputDescriptor>& output);
+        const std::vector<ArgumentOutputDescriptor>& output, ComputeEngine& engine);
     TuningResult runKernelWithManipulator(const Kernel& kernel, TuningManipulator* manipulator, const KernelConfiguration& configuration,
         const std::vector<ArgumentOutputDescriptor>& output);
     TuningResult runCompositionWithManipulator(const KernelComposition& composition, TuningManipulator* manipulator,
         const KernelConfiguration& configuration, const std::vector<ArgumentOutputDescriptor>& output);
-    std::unique_ptr<Searcher> getSearcher(const SearchMethod& method, const std::vector<double>& arguments,
-        const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters) const;
-    bool validateResult(const Kernel& kernel, const TuningResult& result);
+    std::unique_ptr<Searcher> getSearcher(const KernelId id, const SearchMethod& method, const std::vector<double>& arguments,
+        const std::vector<KernelConfiguration>& configurations, const std::vector<KernelParameter>& parameters,
+        const unsigned int randomSeed) const;
+    void runKernelOnline(const Kernel& kernel, const KernelConfiguration& defaultConfiguration,
+        const std::vector<ArgumentOutputDescriptor>& output);
+    OnlineTuner& getOnlineTuner(const Kernel& kernel);
+    bool isExplorationSafe(const Kernel& kernel) const;
+    void downloadOutput(const std::vector<ArgumentOutputDescriptor>& output);
+    TuningResult runKernelConfiguration(const Kernel& kernel, const KernelConfiguration& configuration);
+    void resetKernelBuffers(const Kernel& kernel);
+    TuningResult measureKernelConfiguration(const Kernel& kernel, const KernelConfiguration& configuration);
+    TuningResult measureKernelConfiguration(const Kernel& kernel, const KernelConfiguration& configuration,
+        std::vector<KernelArgument>* validatedOutput);
+    void startValidation(const Kernel& kernel, const size_t resultIndex, const KernelConfiguration& configuration,
+        std::vector<KernelArgument>&& validatedOutput, std::deque<PendingValidation>& validations);
+    void completeValidations(const Kernel& kernel, Searcher& searcher, TuningCheckpoint& checkpoint, const std::string& databaseKey,
+        const size_t maximumPendingCount, std::deque<PendingValidation>& validations, std::vector<TuningResult>& results);
+    TuningResult runRepeatedly(const std::function<TuningResult()>& run, const std::function<void()>& resetBuffers);
+    std::string getWorkerTaskName(const std::string& taskType, const std::string& name);
+    TuningResult runIsolated(WorkerProcess& worker, const std::string& taskType, const KernelConfiguration& configuration,
+        const std::string& kernelName);
+    void serveIsolatedRuns(const std::string& kernelName, const std::vector<KernelConfiguration>& configurations,
+        const std::function<TuningResult(const KernelConfiguration&)>& measure,
+        const std::function<TuningResult(const KernelConfiguration&)>& run, const std::function<void()>& resetBuffers);
+    void tuneKernelInParallel(const KernelId id, const Kernel& kernel, Searcher& searcher, TuningCheckpoint& checkpoint,
+        const std::string& databaseKey, const size_t configurationsCount, std::vector<TuningResult>& results);
+    bool tuneNextBatchConfiguration(BatchTuningState& state);
+    void tuneKernelDistributed(const KernelId id, const Kernel& kernel, Searcher& searcher, TuningCheckpoint& checkpoint,
+        const std::string& databaseKey, const size_t configurationsCount, std::vector<TuningResult>& results);
+    std::string getResultDatabaseKey(const KernelId id) const;
+    std::string findStoredResult(const TuningCheckpoint& checkpoint, const std::string& databaseKey, const KernelConfiguration& configuration,
+        TuningResult& result) const;
+    void storeResult(TuningCheckpoint& checkpoint, const std::string& databaseKey, const TuningResult& result);
+    unsigned int openCheckpoint(TuningCheckpoint& checkpoint, const KernelId id, const std::string& kernelName, const bool resume);
+    void rerankResults(const KernelId id, const std::string& kernelName, std::vector<TuningResult>& results,
+        const std::function<TuningResult(const KernelConfiguration&)>& run, const std::function<void()>& resetBuffers);
+    Searcher* getCustomSearcher(const KernelId id) const;
+    bool validateResult(const Kernel& kernel, TuningResult& result, ComputeEngine& resultEngine);
+    bool applyValidationOutcome(TuningResult& result, const ResultValidator::ValidationOutcome& outcome);
+    void logValidationResult(const TuningResult& result, const bool resultIsCorrect) const;
+    bool isConfigurationCached(const KernelId id, const KernelConfiguration& configuration) const;
+    void evaluateObjective(const KernelId id, TuningResult& result) const;
+    void logTuningStop(const KernelId id, const std::string& kernelName);
     std::string getSearchMethodName(const SearchMethod& method) const;
     Kernel compositionToKernel(const KernelComposition& composition) const;
 };
@@ -0,0 +1,450 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include "worker_process.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <climits>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#define KTT_WORKER_PROCESS_SUPPORT
+#endif
+
+#if defined(__APPLE__)
+#include <crt_externs.h>
+#include <mach-o/dyld.h>
+#endif
+
+#ifdef KTT_WORKER_PROCESS_SUPPORT
+extern char** environ;
+#endif
+
+#if defined(KTT_WORKER_PROCESS_SUPPORT) && !defined(MSG_NOSIGNAL)
+#define MSG_NOSIGNAL 0
+#endif
+
+namespace ktt
+{
+
+#ifdef KTT_WORKER_PROCESS_SUPPORT
+
+// Environment variables which make the executed tuning program act as worker
+static const char* const workerTaskVariable = "KTT_WORKER_TASK";
+static const char* const workerDescriptorVariable = "KTT_WORKER_DESCRIPTOR";
+
+static bool sendAll(const int descriptor, const void* data, const size_t size)
+{
+    const char* bytes = static_cast<const char*>(data);
+    size_t sent = 0;
+
+    while (sent < size)
+    {
+        // Writing into socket of terminated worker must not raise SIGPIPE in the tuning process
+        ssize_t count = send(descriptor, bytes + sent, size - sent, MSG_NOSIGNAL);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        sent += static_cast<size_t>(count);
+    }
+
+    return true;
+}
+
+static bool receiveLine(const int descriptor, std::string& buffer, std::string& line)
+{
+    size_t lineEnd = buffer.find('\n');
+    while (lineEnd == std::string::npos)
+    {
+        char chunk[4096];
+        ssize_t count = recv(descriptor, chunk, sizeof(chunk), 0);
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            return false;
+        }
+        buffer.append(chunk, static_cast<size_t>(count));
+        lineEnd = buffer.find('\n');
+    }
+
+    line = buffer.substr(0, lineEnd);
+    buffer.erase(0, lineEnd + 1);
+    return true;
+}
+
+WorkerProcess::WorkerProcess(const std::string& taskName, const std::vector<std::string>& arguments) :
+    taskName(taskName),
+    arguments(arguments),
+    processId(-1),
+    descriptor(-1)
+{}
+
+WorkerProcess::~WorkerProcess()
+{
+    stop();
+}
+
+bool WorkerProcess::isSupported()
+{
+    return true;
+}
+
+bool WorkerProcess::execute(const std::string& task, const double timeout, std::string& output, std::string& failureReason)
+{
+    if (processId < 0)
+    {
+        start();
+    }
+
+    const std::string message = task + '\n';
+    if (!sendAll(descriptor, message.data(), message.size()))
+    {
+        // Worker terminated while it was idle, task is given to a new worker
+        waitForExit();
+        start();
+
+        if (!sendAll(descriptor, message.data(), message.size()))
+        {
+            failureReason = waitForExit();
+            return false;
+        }
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::duration<double>(timeout);
+    std::string buffer;
+
+    while (true)
+    {
+        int waitTime = -1;
+        if (timeout > 0.0)
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            waitTime = static_cast<int>(std::max(static_cast<long long>(0), static_cast<long long>(remaining.count())));
+        }
+
+        pollfd pollDescriptor;
+        pollDescriptor.fd = descriptor;
+        pollDescriptor.events = POLLIN;
+        pollDescriptor.revents = 0;
+
+        int status = poll(&pollDescriptor, 1, waitTime);
+        if (status < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (status == 0)
+        {
+            terminate();
+            failureReason = std::string("Worker process exceeded time limit of ") + std::to_string(timeout) + " seconds and was killed";
+            return false;
+        }
+
+        char chunk[4096];
+        ssize_t count = status > 0 ? recv(descriptor, chunk, sizeof(chunk), 0) : -1;
+        if (count < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (count <= 0)
+        {
+            failureReason = waitForExit();
+            return false;
+        }
+
+        buffer.append(chunk, static_cast<size_t>(count));
+        size_t lineEnd = buffer.find('\n');
+        if (lineEnd != std::string::npos)
+        {
+            output = buffer.substr(0, lineEnd);
+            return true;
+        }
+    }
+}
+
+void WorkerProcess::stop()
+{
+    if (processId < 0)
+    {
+        return;
+    }
+
+    // Worker exits after its socket is closed
+    close(descriptor);
+    descriptor = -1;
+    waitpid(static_cast<pid_t>(processId), nullptr, 0);
+    processId = -1;
+}
+
+bool WorkerProcess::isWorker()
+{
+    return std::getenv(workerTaskVariable) != nullptr && std::getenv(workerDescriptorVariable) != nullptr;
+}
+
+bool WorkerProcess::isWorker(const std::string& taskName)
+{
+    return isWorker() && taskName == std::getenv(workerTaskVariable);
+}
+
+void WorkerProcess::serve(const std::function<std::string(const std::string&)>& task)
+{
+    const int descriptor = std::atoi(std::getenv(workerDescriptorVariable));
+    std::string buffer;
+    std::string message;
+
+    // Worker never returns into the tuning program, it exits once the tuning process closes its socket
+    while (receiveLine(descriptor, buffer, message))
+    {
+        std::string result;
+        try
+        {
+            result = task(message);
+        }
+        catch (...)
+        {
+            _exit(2);
+        }
+
+        result += '\n';
+        if (!sendAll(descriptor, result.data(), result.size()))
+        {
+            _exit(3);
+        }
+    }
+    _exit(0);
+}
+
+void WorkerProcess::start()
+{
+    // Everything used by the child is prepared before fork, only async-signal-safe calls are allowed between fork and exec
+    const std::string executablePath = getExecutablePath();
+    std::vector<std::string> workerArguments{executablePath};
+    const std::vector<std::string> programArguments = arguments.empty() ? getProcessArguments() : arguments;
+    workerArguments.insert(workerArguments.end(), programArguments.cbegin(), programArguments.cend());
+
+    int descriptors[2];
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors) != 0)
+    {
+        throw std::runtime_error(std::string("Unable to create socket for worker process: ") + std::strerror(errno));
+    }
+    fcntl(descriptors[0], F_SETFD, FD_CLOEXEC);
+
+#ifdef SO_NOSIGPIPE
+    int enabled = 1;
+    setsockopt(descriptors[0], SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+    setsockopt(descriptors[1], SOL_SOCKET, SO_NOSIGPIPE, &enabled, sizeof(enabled));
+#endif
+
+    std::vector<std::string> environment;
+    for (char** variable = environ; *variable != nullptr; variable++)
+    {
+        const std::string entry(*variable);
+        if (entry.compare(0, std::strlen(workerTaskVariable) + 1, std::string(workerTaskVariable) + "=") != 0
+            && entry.compare(0, std::strlen(workerDescriptorVariable) + 1, std::string(workerDescriptorVariable) + "=") != 0)
+        {
+            environment.push_back(entry);
+        }
+    }
+    environment.push_back(std::string(workerTaskVariable) + "=" + taskName);
+    environment.push_back(std::string(workerDescriptorVariable) + "=" + std::to_string(descriptors[1]));
+
+    std::vector<char*> argumentPointers;
+    for (auto& argument : workerArguments)
+    {
+        argumentPointers.push_back(&argument[0]);
+    }
+    argumentPointers.push_back(nullptr);
+    std::vector<char*> environmentPointers;
+    for (auto& entry : environment)
+    {
+        environmentPointers.push_back(&entry[0]);
+    }
+    environmentPointers.push_back(nullptr);
+
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        close(descriptors[0]);
+        close(descriptors[1]);
+        throw std::runtime_error(std::string("Unable to start worker process: ") + std::strerror(errno));
+    }
+
+    if (pid == 0)
+    {
+        execve(executablePath.c_str(), argumentPointers.data(), environmentPointers.data());
+        _exit(127);
+    }
+
+    close(descriptors[1]);
+    descriptor = descriptors[0];
+    processId = static_cast<int>(pid);
+}
+
+void WorkerProcess::terminate()
+{
+    if (processId < 0)
+    {
+        return;
+    }
+
+    ::kill(static_cast<pid_t>(processId), SIGKILL);
+    waitForExit();
+}
+
+std::string WorkerProcess::waitForExit()
+{
+    close(descriptor);
+    descriptor = -1;
+
+    int status = 0;
+    pid_t result;
+    do
+    {
+        result = waitpid(static_cast<pid_t>(processId), &status, 0);
+    }
+    while (result < 0 && errno == EINTR);
+    processId = -1;
+
+    if (result > 0 && WIFSIGNALED(status))
+    {
+        return std::string("Worker process was terminated by signal ") + std::to_string(WTERMSIG(status)) + " (" + strsignal(WTERMSIG(status))
+            + ")";
+    }
+    if (result > 0 && WIFEXITED(status))
+    {
+        return std::string("Worker process exited with code ") + std::to_string(WEXITSTATUS(status));
+    }
+    return std::string("Worker process terminated unexpectedly");
+}
+
+std::string WorkerProcess::getExecutablePath()
+{
+#if defined(__APPLE__)
+    uint32_t size = 0;
+    _NSGetExecutablePath(nullptr, &size);
+    std::string path(size, '\0');
+    if (_NSGetExecutablePath(&path[0], &size) == 0)
+    {
+        return std::string(path.c_str());
+    }
+#else
+    char path[PATH_MAX];
+    const ssize_t length = readlink("/proc/self/exe", path, sizeof(path) - 1);
+    if (length > 0)
+    {
+        return std::string(path, static_cast<size_t>(length));
+    }
+#endif
+    throw std::runtime_error("Unable to determine executable of tuning program for worker process");
+}
+
+std::vector<std::string> WorkerProcess::getProcessArguments()
+{
+    std::vector<std::string> result;
+#if defined(__APPLE__)
+    char** arguments = *_NSGetArgv();
+    const int count = *_NSGetArgc();
+    for (int i = 1; i < count; i++)
+    {
+        result.push_back(arguments[i]);
+    }
+#else
+    std::ifstream file("/proc/self/cmdline", std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error("Unable to determine arguments of tuning program for worker process");
+    }
+
+    std::string argument;
+    bool first = true;
+    while (std::getline(file, argument, '\0'))
+    {
+        if (!first)
+        {
+            result.push_back(argument);
+        }
+        first = false;
+    }
+#endif
+    return result;
+}
+
+#else
+
+WorkerProcess::WorkerProcess(const std::string& taskName, const std::vector<std::string>& arguments) :
+    taskName(taskName),
+    arguments(arguments),
+    processId(-1),
+    descriptor(-1)
+{}
+
+WorkerProcess::~WorkerProcess()
+{}
+
+bool WorkerProcess::isSupported()
+{
+    return false;
+}
+
+bool WorkerProcess::execute(const std::string&, const double, std::string&, std::string&)
+{
+    throw std::runtime_error("Process isolation is supported only on POSIX platforms");
+}
+
+void WorkerProcess::stop()
+{}
+
+bool WorkerProcess::isWorker()
+{
+    return false;
+}
+
+bool WorkerProcess::isWorker(const std::string&)
+{
+    return false;
+}
+
+void WorkerProcess::serve(const std::function<std::string(const std::string&)>&)
+{
+    throw std::runtime_error("Process isolation is supported only on POSIX platforms");
+}
+
+void WorkerProcess::start()
+{}
+
+void WorkerProcess::terminate()
+{}
+
+std::string WorkerProcess::waitForExit()
+{
+    return std::string();
+}
+
+std::string WorkerProcess::getExecutablePath()
+{
+    return std::string();
+}
+
+std::vector<std::string> WorkerProcess::getProcessArguments()
+{
+    return std::vector<std::string>{};
+}
+
+#endif // KTT_WORKER_PROCESS_SUPPORT
+
+} // namespace ktt
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace ktt
+{
+
+// Separate process which executes tasks on behalf of the tuner, so that crash or hang during kernel run does not terminate the tuning
+// process. Worker is started by executing the tuning program again, so it initializes its own compute API context instead of inheriting
+// one which is not usable after fork. Program running as worker serves tasks once it reaches the tuning call with matching task name,
+// it keeps its own state (eg. compiled programs) between tasks. Every start replays the tuning program up to that call, so worker which
+// crashed or exceeded time limit is killed and started again only before the next task. Available only on POSIX platforms.
+class WorkerProcess
+{
+public:
+    // Constructor and destructor, empty arguments mean arguments of the tuning process
+    explicit WorkerProcess(const std::string& taskName, const std::vector<std::string>& arguments);
+    ~WorkerProcess();
+    WorkerProcess(const WorkerProcess&) = delete;
+    WorkerProcess& operator=(const WorkerProcess&) = delete;
+
+    // Core methods
+    static bool isSupported();
+    // Returns false and sets failure reason if worker crashed or did not finish the task within timeout (in seconds, zero means no limit)
+    bool execute(const std::string& task, const double timeout, std::string& output, std::string& failureReason);
+    void stop();
+    // Kills worker whose state cannot be trusted, new worker is started before the next task
+    void terminate();
+
+    // Worker side, serving never returns and the program exits after the tuning process closes connection
+    static bool isWorker();
+    static bool isWorker(const std::string& taskName);
+    static void serve(const std::function<std::string(const std::string&)>& task);
+
+private:
+    // Attributes
+    std::string taskName;
+    std::vector<std::string> arguments;
+    int processId;
+    int descriptor;
+
+    // Helper methods
+    void start();
+    std::string waitForExit();
+    static std::string getExecutablePath();
+    static std::vector<std::string> getProcessArguments();
+};
+
+} // namespace ktt
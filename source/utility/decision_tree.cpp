@@ -0,0 +1,214 @@
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+#include "decision_tree.h"
+
+namespace ktt
+{
+
+static const std::string treeHeader("KTT decision tree");
+
+DecisionTree::DecisionTree() :
+    featureCount(0)
+{}
+
+void DecisionTree::addEntry(const std::vector<size_t>& inputFeatures, const std::vector<ParameterPair>& configuration)
+{
+    if (!entries.empty() && inputFeatures.size() != featureCount)
+    {
+        throw std::runtime_error("Number of input features must be the same for all decision tree entries");
+    }
+
+    featureCount = inputFeatures.size();
+    entries[inputFeatures] = configuration;
+    build();
+}
+
+std::vector<ParameterPair> DecisionTree::getConfiguration(const std::vector<size_t>& inputFeatures) const
+{
+    if (nodes.empty())
+    {
+        throw std::runtime_error("Decision tree contains no entries");
+    }
+    if (inputFeatures.size() != featureCount)
+    {
+        throw std::runtime_error(std::string("Decision tree expects ") + std::to_string(featureCount) + " input features, "
+            + std::to_string(inputFeatures.size()) + " were given");
+    }
+
+    size_t index = 0;
+    while (!nodes.at(index).leaf)
+    {
+        const Node& node = nodes.at(index);
+        index = static_cast<double>(inputFeatures.at(node.feature)) < node.threshold ? node.left : node.right;
+    }
+    return nodes.at(index).configuration;
+}
+
+void DecisionTree::save(const std::string& filePath) const
+{
+    std::ofstream file(filePath);
+    if (!file.is_open())
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+
+    // Entries are stored instead of nodes, tree is built again when it is loaded
+    file << treeHeader << std::endl;
+    for (const auto& entry : entries)
+    {
+        for (size_t i = 0; i < entry.first.size(); i++)
+        {
+            file << (i == 0 ? "" : ",") << entry.first.at(i);
+        }
+        file << ";";
+        for (size_t i = 0; i < entry.second.size(); i++)
+        {
+            file << (i == 0 ? "" : ",") << std::get<0>(entry.second.at(i)) << "," << std::get<1>(entry.second.at(i));
+        }
+        file << std::endl;
+    }
+}
+
+DecisionTree DecisionTree::load(const std::string& filePath)
+{
+    std::ifstream file(filePath);
+    if (!file.is_open())
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+
+    std::string line;
+    if (!std::getline(file, line) || line != treeHeader)
+    {
+        throw std::runtime_error(std::string("File is not a KTT decision tree: ") + filePath);
+    }
+
+    DecisionTree tree;
+    while (std::getline(file, line))
+    {
+        const size_t separator = line.find(';');
+        if (separator == std::string::npos)
+        {
+            throw std::runtime_error(std::string("Malformed decision tree entry: ") + line);
+        }
+
+        std::vector<size_t> inputFeatures;
+        std::stringstream featureStream(line.substr(0, separator));
+        std::string value;
+        while (std::getline(featureStream, value, ','))
+        {
+            inputFeatures.push_back(std::stoull(value));
+        }
+
+        std::vector<ParameterPair> configuration;
+        std::stringstream configurationStream(line.substr(separator + 1));
+        std::string name;
+        while (std::getline(configurationStream, name, ','))
+        {
+            if (!std::getline(configurationStream, value, ','))
+            {
+                throw std::runtime_error(std::string("Malformed decision tree entry: ") + line);
+            }
+            configuration.push_back(ParameterPair(name, std::stoull(value)));
+        }
+
+        tree.addEntry(inputFeatures, configuration);
+    }
+
+    return tree;
+}
+
+size_t DecisionTree::getEntryCount() const
+{
+    return entries.size();
+}
+
+size_t DecisionTree::getNodeCount() const
+{
+    return nodes.size();
+}
+
+void DecisionTree::build()
+{
+    std::vector<const Entry*> samples;
+    for (const auto& entry : entries)
+    {
+        samples.push_back(&entry);
+    }
+
+    nodes.clear();
+    buildNode(samples, 0, samples.size());
+}
+
+size_t DecisionTree::buildNode(std::vector<const Entry*>& samples, const size_t begin, const size_t end)
+{
+    const size_t index = nodes.size();
+    nodes.push_back(Node{true, 0, 0.0, 0, 0, samples.at(begin)->second});
+
+    size_t feature = 0;
+    size_t largestRange = 0;
+    for (size_t i = 0; i < featureCount; i++)
+    {
+        auto bounds = std::minmax_element(samples.begin() + begin, samples.begin() + end, [i](const Entry* first, const Entry* second)
+        {
+            return first->first.at(i) < second->first.at(i);
+        });
+        const size_t range = (*bounds.second)->first.at(i) - (*bounds.first)->first.at(i);
+        if (range > largestRange)
+        {
+            feature = i;
+            largestRange = range;
+        }
+    }
+
+    // Entries have unique features, so range is zero only for single entry
+    if (largestRange == 0)
+    {
+        return index;
+    }
+
+    std::sort(samples.begin() + begin, samples.begin() + end, [feature](const Entry* first, const Entry* second)
+    {
+        return first->first.at(feature) < second->first.at(feature);
+    });
+
+    // Split closest to median which separates different feature values is used
+    const size_t middle = begin + (end - begin) / 2;
+    size_t split = middle;
+    for (size_t offset = 0; offset < end - begin; offset++)
+    {
+        if (middle + offset < end && samples.at(middle + offset - 1)->first.at(feature) != samples.at(middle + offset)->first.at(feature))
+        {
+            split = middle + offset;
+            break;
+        }
+        if (middle - begin > offset && samples.at(middle - offset - 1)->first.at(feature) != samples.at(middle - offset)->first.at(feature))
+        {
+            split = middle - offset;
+            break;
+        }
+    }
+
+    const size_t left = buildNode(samples, begin, split);
+    const size_t right = buildNode(samples, split, end);
+    Node& node = nodes.at(index);
+
+    if (nodes.at(left).leaf && nodes.at(right).leaf && nodes.at(left).configuration == nodes.at(right).configuration)
+    {
+        node.configuration = nodes.at(left).configuration;
+        nodes.resize(index + 1);
+        return index;
+    }
+
+    node.leaf = false;
+    node.feature = feature;
+    const double lowerValue = static_cast<double>(samples.at(split - 1)->first.at(feature));
+    node.threshold = (lowerValue + static_cast<double>(samples.at(split)->first.at(feature))) / 2.0;
+    node.left = left;
+    node.right = right;
+    return index;
+}
+
+} // namespace ktt
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+#include "ktt_types.h"
+
+namespace ktt
+{
+
+// Maps input features (eg. problem sizes) to best configuration found by tuning with these inputs. Tree is built from tuned inputs
+// by splitting them at median of the feature with the largest range, so that lookup takes logarithmic time. Input which was not
+// tuned is assigned configuration of a close tuned input. Subtrees which lead to the same configuration are merged.
+class DecisionTree
+{
+public:
+    // Constructor
+    DecisionTree();
+
+    // Core methods
+    void addEntry(const std::vector<size_t>& inputFeatures, const std::vector<ParameterPair>& configuration);
+    std::vector<ParameterPair> getConfiguration(const std::vector<size_t>& inputFeatures) const;
+    void save(const std::string& filePath) const;
+    static DecisionTree load(const std::string& filePath);
+
+    // Getters
+    size_t getEntryCount() const;
+    size_t getNodeCount() const;
+
+private:
+    using Entry = std::pair<const std::vector<size_t>, std::vector<ParameterPair>>;
+
+    struct Node
+    {
+        bool leaf;
+        size_t feature;
+        double threshold;
+        size_t left;
+        size_t right;
+        std::vector<ParameterPair> configuration;
+    };
+
+    // Attributes
+    std::map<std::vector<size_t>, std::vector<ParameterPair>> entries;
+    std::vector<Node> nodes;
+    size_t featureCount;
+
+    // Helper methods
+    void build();
+    size_t buildNode(std::vector<const Entry*>& samples, const size_t begin, const size_t end);
+};
+
+} // namespace ktt
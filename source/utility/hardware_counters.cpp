@@ -0,0 +1,176 @@
+#include "hardware_counters.h"
+
+#ifdef __linux__
+#include <cstring>
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // __linux__
+
+namespace ktt
+{
+
+#ifdef __linux__
+
+static const uint64_t counterConfigs[] =
+{
+    PERF_COUNT_HW_INSTRUCTIONS,
+    PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_CACHE_REFERENCES,
+    PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+    PERF_COUNT_HW_BRANCH_MISSES
+};
+
+static int openCounter(const uint64_t config, const pid_t threadId)
+{
+    perf_event_attr attributes;
+    std::memset(&attributes, 0, sizeof(perf_event_attr));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(perf_event_attr);
+    attributes.config = config;
+    attributes.disabled = 1;
+    attributes.inherit = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+    return static_cast<int>(syscall(__NR_perf_event_open, &attributes, threadId, -1, -1, 0));
+}
+
+static std::vector<pid_t> getThreadIds()
+{
+    std::vector<pid_t> result;
+    DIR* directory = opendir("/proc/self/task");
+    if (directory == nullptr)
+    {
+        return result;
+    }
+
+    while (dirent* entry = readdir(directory))
+    {
+        if (entry->d_name[0] != '.')
+        {
+            result.push_back(static_cast<pid_t>(std::stol(std::string(entry->d_name))));
+        }
+    }
+
+    closedir(directory);
+    return result;
+}
+
+HardwareCounters::HardwareCounters() :
+    supported(false)
+{
+    int descriptor = openCounter(PERF_COUNT_HW_INSTRUCTIONS, 0);
+    if (descriptor >= 0)
+    {
+        supported = true;
+        close(descriptor);
+    }
+}
+
+void HardwareCounters::start()
+{
+    closeDescriptors();
+    values.clear();
+
+    if (!supported)
+    {
+        return;
+    }
+
+    for (const auto threadId : getThreadIds())
+    {
+        for (size_t i = 0; i < getCounterNames().size(); i++)
+        {
+            int descriptor = openCounter(counterConfigs[i], threadId);
+            if (descriptor >= 0)
+            {
+                descriptors.push_back(std::make_pair(i, descriptor));
+            }
+        }
+    }
+
+    for (const auto& descriptor : descriptors)
+    {
+        ioctl(descriptor.second, PERF_EVENT_IOC_RESET, 0);
+        ioctl(descriptor.second, PERF_EVENT_IOC_ENABLE, 0);
+    }
+}
+
+void HardwareCounters::stop()
+{
+    for (const auto& descriptor : descriptors)
+    {
+        ioctl(descriptor.second, PERF_EVENT_IOC_DISABLE, 0);
+    }
+
+    for (const auto& descriptor : descriptors)
+    {
+        // Counter value, time enabled and time running, value is scaled when counters were multiplexed
+        uint64_t data[3];
+        if (read(descriptor.second, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data)) || data[2] == 0)
+        {
+            continue;
+        }
+
+        double scaledValue = static_cast<double>(data[0]) * static_cast<double>(data[1]) / static_cast<double>(data[2]);
+        values[getCounterNames().at(descriptor.first)] += static_cast<uint64_t>(scaledValue);
+    }
+
+    closeDescriptors();
+}
+
+void HardwareCounters::closeDescriptors()
+{
+    for (const auto& descriptor : descriptors)
+    {
+        close(descriptor.second);
+    }
+    descriptors.clear();
+}
+
+#else
+
+HardwareCounters::HardwareCounters() :
+    supported(false)
+{}
+
+void HardwareCounters::start()
+{
+    values.clear();
+}
+
+void HardwareCounters::stop()
+{}
+
+void HardwareCounters::closeDescriptors()
+{}
+
+#endif // __linux__
+
+HardwareCounters::~HardwareCounters()
+{
+    closeDescriptors();
+}
+
+bool HardwareCounters::isSupported() const
+{
+    return supported;
+}
+
+std::map<std::string, uint64_t> HardwareCounters::getValues() const
+{
+    return values;
+}
+
+const std::vector<std::string>& HardwareCounters::getCounterNames()
+{
+    static const std::vector<std::string> names{"Instructions", "Cycles", "Cache references", "Cache misses", "Branches", "Branch misses"};
+    return names;
+}
+
+} // namespace ktt
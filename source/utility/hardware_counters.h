@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ktt
+{
+
+// Reads CPU hardware performance counters of all threads of the current process, which makes it possible to profile kernels run by CPU
+// compute API runtimes in their worker threads. Threads are enumerated when counting starts. Counters are available only on Linux.
+class HardwareCounters
+{
+public:
+    HardwareCounters();
+    ~HardwareCounters();
+    HardwareCounters(const HardwareCounters&) = delete;
+    HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+    bool isSupported() const;
+    void start();
+    void stop();
+    std::map<std::string, uint64_t> getValues() const;
+
+    static const std::vector<std::string>& getCounterNames();
+
+private:
+    bool supported;
+    std::vector<std::pair<size_t, int>> descriptors;
+    std::map<std::string, uint64_t> values;
+
+    void closeDescriptors();
+};
+
+} // namespace ktt
@@ -1,3 +1,7 @@
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
 #include "ktt_utility.h"
 
 namespace ktt
@@ -26,4 +30,170 @@ std::vector<size_t> roundUpGlobalSize(const std::vector<size_t>& globalSize, con
     return result;
 }
 
+uint64_t getMinimum(const std::vector<uint64_t>& samples)
+{
+    if (samples.empty())
+    {
+        return 0;
+    }
+    return *std::min_element(samples.begin(), samples.end());
+}
+
+uint64_t getMedian(const std::vector<uint64_t>& samples)
+{
+    if (samples.empty())
+    {
+        return 0;
+    }
+
+    std::vector<uint64_t> sortedSamples = samples;
+    std::sort(sortedSamples.begin(), sortedSamples.end());
+    const size_t middle = sortedSamples.size() / 2;
+
+    if (sortedSamples.size() % 2 == 0)
+    {
+        return sortedSamples.at(middle - 1) + (sortedSamples.at(middle) - sortedSamples.at(middle - 1)) / 2;
+    }
+    return sortedSamples.at(middle);
+}
+
+double getMean(const std::vector<uint64_t>& samples)
+{
+    if (samples.empty())
+    {
+        return 0.0;
+    }
+
+    double sum = 0.0;
+    for (const auto sample : samples)
+    {
+        sum += static_cast<double>(sample);
+    }
+    return sum / static_cast<double>(samples.size());
+}
+
+double getStandardDeviation(const std::vector<uint64_t>& samples)
+{
+    if (samples.size() < 2)
+    {
+        return 0.0;
+    }
+
+    const double mean = getMean(samples);
+    double squareSum = 0.0;
+    for (const auto sample : samples)
+    {
+        squareSum += (static_cast<double>(sample) - mean) * (static_cast<double>(sample) - mean);
+    }
+
+    // Sample standard deviation
+    return std::sqrt(squareSum / static_cast<double>(samples.size() - 1));
+}
+
+uint64_t getStatistic(const std::vector<uint64_t>& samples, const DurationStatistic& statistic)
+{
+    switch (statistic)
+    {
+    case DurationStatistic::Minimum:
+        return getMinimum(samples);
+    case DurationStatistic::Median:
+        return getMedian(samples);
+    case DurationStatistic::Mean:
+        return static_cast<uint64_t>(std::llround(getMean(samples)));
+    default:
+        throw std::runtime_error("Unknown duration statistic");
+    }
+}
+
+// Two-sided p-value of Mann-Whitney U test with normal approximation, which does not assume normally distributed samples
+double getMannWhitneyPValue(const std::vector<uint64_t>& first, const std::vector<uint64_t>& second)
+{
+    if (first.empty() || second.empty())
+    {
+        return 1.0;
+    }
+
+    std::vector<std::pair<uint64_t, bool>> samples;
+    for (const auto sample : first)
+    {
+        samples.push_back(std::make_pair(sample, true));
+    }
+    for (const auto sample : second)
+    {
+        samples.push_back(std::make_pair(sample, false));
+    }
+    std::sort(samples.begin(), samples.end());
+
+    // Tied samples receive average of their ranks
+    const double count = static_cast<double>(samples.size());
+    double firstRankSum = 0.0;
+    double tieCorrection = 0.0;
+    for (size_t i = 0; i < samples.size();)
+    {
+        size_t j = i;
+        while (j < samples.size() && samples.at(j).first == samples.at(i).first)
+        {
+            j++;
+        }
+
+        const double rank = static_cast<double>(i + j + 1) / 2.0;
+        const double tieCount = static_cast<double>(j - i);
+        tieCorrection += tieCount * tieCount * tieCount - tieCount;
+        for (size_t k = i; k < j; k++)
+        {
+            if (samples.at(k).second)
+            {
+                firstRankSum += rank;
+            }
+        }
+        i = j;
+    }
+
+    const double firstCount = static_cast<double>(first.size());
+    const double secondCount = static_cast<double>(second.size());
+    const double u = firstRankSum - firstCount * (firstCount + 1.0) / 2.0;
+    const double mean = firstCount * secondCount / 2.0;
+    const double variance = firstCount * secondCount / 12.0 * (count + 1.0 - tieCorrection / (count * (count - 1.0)));
+    if (variance <= 0.0)
+    {
+        return 1.0;
+    }
+
+    const double z = std::max(0.0, std::fabs(u - mean) - 0.5) / std::sqrt(variance);
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+uint64_t getHash(const void* data, const size_t dataSize)
+{
+    // 64-bit FNV-1a, hash is stored in files, so it has to be identical across platforms and program runs
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (size_t i = 0; i < dataSize; i++)
+    {
+        hash ^= static_cast<uint64_t>(bytes[i]);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+uint64_t getHash(const std::string& data)
+{
+    return getHash(data.data(), data.size());
+}
+
+std::string hashToString(const uint64_t hash)
+{
+    static const char digits[] = "0123456789abcdef";
+    std::string result(16, '0');
+
+    for (size_t i = 0; i < 16; i++)
+    {
+        result.at(15 - i) = digits[(hash >> (4 * i)) & 0xF];
+    }
+
+    return result;
+}
+
 } // namespace ktt
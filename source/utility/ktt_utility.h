@@ -1,14 +1,26 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <set>
+#include <string>
 #include <vector>
+#include "enum/duration_statistic.h"
 
 namespace ktt
 {
 
 size_t roundUp(const size_t number, const size_t multiple);
 std::vector<size_t> roundUpGlobalSize(const std::vector<size_t>& globalSize, const std::vector<size_t>& localSize);
+uint64_t getMinimum(const std::vector<uint64_t>& samples);
+uint64_t getMedian(const std::vector<uint64_t>& samples);
+double getMean(const std::vector<uint64_t>& samples);
+double getStandardDeviation(const std::vector<uint64_t>& samples);
+uint64_t getStatistic(const std::vector<uint64_t>& samples, const DurationStatistic& statistic);
+double getMannWhitneyPValue(const std::vector<uint64_t>& first, const std::vector<uint64_t>& second);
+uint64_t getHash(const void* data, const size_t dataSize);
+uint64_t getHash(const std::string& data);
+std::string hashToString(const uint64_t hash);
 
 template <typename T> bool elementExists(const T& element, const std::vector<T>& vector)
 {
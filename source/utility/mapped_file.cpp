@@ -0,0 +1,82 @@
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include "mapped_file.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define KTT_MAPPED_FILE_SUPPORT
+#endif
+
+namespace ktt
+{
+
+MappedFile::MappedFile(const std::string& filePath) :
+    data(nullptr),
+    size(0),
+    mapped(false)
+{
+#ifdef KTT_MAPPED_FILE_SUPPORT
+    int descriptor = open(filePath.c_str(), O_RDONLY);
+    if (descriptor < 0)
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+
+    struct stat status;
+    if (fstat(descriptor, &status) != 0)
+    {
+        close(descriptor);
+        throw std::runtime_error(std::string("Unable to read size of file: ") + filePath);
+    }
+    size = static_cast<size_t>(status.st_size);
+
+    // Empty file cannot be mapped
+    if (size > 0)
+    {
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+        if (address == MAP_FAILED)
+        {
+            close(descriptor);
+            throw std::runtime_error(std::string("Unable to map file: ") + filePath);
+        }
+        data = address;
+        mapped = true;
+    }
+    close(descriptor);
+#else
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open())
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+    buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data = buffer.data();
+    size = buffer.size();
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#ifdef KTT_MAPPED_FILE_SUPPORT
+    if (mapped)
+    {
+        munmap(const_cast<void*>(data), size);
+    }
+#endif
+}
+
+const void* MappedFile::getData() const
+{
+    return data;
+}
+
+size_t MappedFile::getSize() const
+{
+    return size;
+}
+
+} // namespace ktt
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ktt
+{
+
+// Read-only view of file contents. File is memory-mapped on POSIX platforms, so that only pages which are accessed are loaded,
+// elsewhere its contents are read into memory.
+class MappedFile
+{
+public:
+    // Constructor and destructor
+    explicit MappedFile(const std::string& filePath);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Getters
+    const void* getData() const;
+    size_t getSize() const;
+
+private:
+    // Attributes
+    const void* data;
+    size_t size;
+    bool mapped;
+    std::vector<char> buffer;
+};
+
+} // namespace ktt
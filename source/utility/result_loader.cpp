@@ -0,0 +1,165 @@
+#include <fstream>
+#include <stdexcept>
+#include "result_loader.h"
+
+namespace ktt
+{
+
+std::vector<TuningResult> ResultLoader::loadResults(const std::string& filePath, const std::string& kernelName)
+{
+    std::ifstream file(filePath);
+
+    if (!file.is_open())
+    {
+        throw std::runtime_error(std::string("Unable to open file: ") + filePath);
+    }
+
+    std::string line;
+    if (!std::getline(file, line))
+    {
+        throw std::runtime_error(std::string("Result file is empty: ") + filePath);
+    }
+
+    // Header, parameter columns follow after the last local size column
+    std::vector<std::string> header = splitLine(line);
+    size_t totalDurationColumn = header.size();
+    size_t kernelDurationColumn = header.size();
+    size_t firstParameterColumn = header.size();
+    size_t objectiveColumn = header.size();
+    size_t compilationDurationColumn = header.size();
+    size_t maximumErrorColumn = header.size();
+    size_t workGroupMemoryColumn = header.size();
+
+    for (size_t i = 0; i < header.size(); i++)
+    {
+        if (header.at(i).find("Total duration") == 0)
+        {
+            totalDurationColumn = i;
+        }
+        else if (header.at(i).find("Kernel duration") == 0)
+        {
+            kernelDurationColumn = i;
+        }
+        else if (header.at(i).find("Compilation duration") == 0)
+        {
+            compilationDurationColumn = i;
+        }
+        else if (header.at(i) == "Objective")
+        {
+            objectiveColumn = i;
+        }
+        else if (header.at(i).find("Maximum error") == 0)
+        {
+            maximumErrorColumn = i;
+        }
+        else if (header.at(i).find("Work-group memory") == 0)
+        {
+            workGroupMemoryColumn = i;
+        }
+        else if (header.at(i).find("Local size") == 0)
+        {
+            firstParameterColumn = i + 1;
+        }
+    }
+
+    if (header.at(0) != "Kernel name" || kernelDurationColumn == header.size() || firstParameterColumn > header.size())
+    {
+        throw std::runtime_error(std::string("Result file is not in KTT CSV format: ") + filePath);
+    }
+
+    // Values, valid results end with an empty line
+    std::vector<TuningResult> results;
+    while (std::getline(file, line) && !line.empty() && line != "\r")
+    {
+        std::vector<std::string> values = splitLine(line);
+        if (values.size() != header.size() || values.at(0) != kernelName)
+        {
+            continue;
+        }
+
+        std::vector<ParameterPair> parameterPairs;
+        for (size_t i = firstParameterColumn; i < header.size(); i++)
+        {
+            parameterPairs.push_back(ParameterPair(header.at(i), std::stoull(values.at(i))));
+        }
+
+        TuningResult result(kernelName, KernelConfiguration(DimensionVector(), DimensionVector(), parameterPairs));
+        uint64_t kernelDuration = std::stoull(values.at(kernelDurationColumn)) * getTimeMultiplier(header.at(kernelDurationColumn));
+        result.setKernelDuration(kernelDuration);
+
+        if (totalDurationColumn != header.size())
+        {
+            uint64_t totalDuration = std::stoull(values.at(totalDurationColumn)) * getTimeMultiplier(header.at(totalDurationColumn));
+            result.setManipulatorDuration(totalDuration > kernelDuration ? totalDuration - kernelDuration : 0);
+        }
+
+        if (compilationDurationColumn != header.size())
+        {
+            result.setCompilationDuration(std::stoull(values.at(compilationDurationColumn))
+                * getTimeMultiplier(header.at(compilationDurationColumn)));
+        }
+        if (objectiveColumn != header.size())
+        {
+            result.setObjectiveValue(std::stod(values.at(objectiveColumn)));
+        }
+        if (maximumErrorColumn != header.size())
+        {
+            result.setMaximumError(std::stod(values.at(maximumErrorColumn)));
+        }
+        if (workGroupMemoryColumn != header.size())
+        {
+            result.setWorkGroupMemory(std::stoull(values.at(workGroupMemoryColumn)));
+        }
+
+        result.setValid(true);
+        results.push_back(result);
+    }
+
+    return results;
+}
+
+std::vector<std::string> ResultLoader::splitLine(const std::string& line)
+{
+    std::vector<std::string> result;
+    std::string current;
+
+    for (const auto character : line)
+    {
+        if (character == ',')
+        {
+            result.push_back(current);
+            current.clear();
+        }
+        else if (character != '\r')
+        {
+            current += character;
+        }
+    }
+    result.push_back(current);
+
+    return result;
+}
+
+uint64_t ResultLoader::getTimeMultiplier(const std::string& columnName)
+{
+    if (columnName.find("(ns)") != std::string::npos)
+    {
+        return 1;
+    }
+    else if (columnName.find("(us)") != std::string::npos)
+    {
+        return 1'000;
+    }
+    else if (columnName.find("(ms)") != std::string::npos)
+    {
+        return 1'000'000;
+    }
+    else if (columnName.find("(s)") != std::string::npos)
+    {
+        return 1'000'000'000;
+    }
+
+    throw std::runtime_error(std::string("Unknown time unit in result file column: ") + columnName);
+}
+
+} // namespace ktt
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include "dto/tuning_result.h"
+
+namespace ktt
+{
+
+class ResultLoader
+{
+public:
+    static std::vector<TuningResult> loadResults(const std::string& filePath, const std::string& kernelName);
+
+private:
+    static std::vector<std::string> splitLine(const std::string& line);
+    static uint64_t getTimeMultiplier(const std::string& columnName);
+};
+
+} // namespace ktt
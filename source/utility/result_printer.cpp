@@ -63,6 +63,11 @@ std::vector<ParameterPair> ResultPrinter::getBestConfiguration(const KernelId id
     return bestResult.getConfiguration().getParameterPairs();
 }
 
+bool ResultPrinter::hasResult(const KernelId id) const
+{
+    return kernelResults.find(id) != kernelResults.end();
+}
+
 void ResultPrinter::printVerbose(const std::vector<TuningResult>& results, std::ostream& outputTarget) const
 {
     for (const auto& result : results)
@@ -74,11 +79,41 @@ void ResultPrinter::printVerbose(const std::vector<TuningResult>& results, std::
 
         outputTarget << "Result for kernel <" << result.getKernelName() << ">, configuration: " << std::endl;
         printConfigurationVerbose(outputTarget, result.getConfiguration());
+        if (!result.getDeviceName().empty())
+        {
+            outputTarget << "Device: " << result.getDeviceName() << " (index " << result.getDeviceId() << ")" << std::endl;
+        }
         outputTarget << "Kernel duration: " << convertTime(result.getKernelDuration(), timeUnit) << getTimeUnitTag(timeUnit) << std::endl;
+        if (result.getKernelDurationSamples().size() > 1)
+        {
+            outputTarget << "Kernel duration statistics (" << result.getKernelDurationSamples().size() << " runs): minimum "
+                << convertTime(result.getMinimumKernelDuration(), timeUnit) << getTimeUnitTag(timeUnit) << ", median "
+                << convertTime(result.getMedianKernelDuration(), timeUnit) << getTimeUnitTag(timeUnit) << ", mean "
+                << convertTime(static_cast<uint64_t>(result.getMeanKernelDuration()), timeUnit) << getTimeUnitTag(timeUnit) << ", standard deviation "
+                << convertTime(static_cast<uint64_t>(result.getKernelDurationDeviation()), timeUnit) << getTimeUnitTag(timeUnit) << std::endl;
+        }
         if (result.getManipulatorDuration() != 0)
         {
             outputTarget << "Total duration: " << convertTime(result.getTotalDuration(), timeUnit) << getTimeUnitTag(timeUnit) << std::endl;
         }
+        if (result.hasCustomObjective())
+        {
+            outputTarget << "Objective value: " << result.getObjectiveValue() << std::endl;
+        }
+        outputTarget << "Compilation duration: " << convertTime(result.getCompilationDuration(), timeUnit) << getTimeUnitTag(timeUnit)
+            << std::endl;
+        if (result.getMaximumError() != 0.0)
+        {
+            outputTarget << "Maximum error: " << result.getMaximumError() << std::endl;
+        }
+        if (result.getWorkGroupMemory() != 0)
+        {
+            outputTarget << "Work-group memory: " << result.getWorkGroupMemory() << "B" << std::endl;
+        }
+        for (const auto& counter : result.getHardwareCounters())
+        {
+            outputTarget << counter.first << ": " << counter.second << std::endl;
+        }
         outputTarget << std::endl;
     }
 
@@ -93,6 +128,10 @@ void ResultPrinter::printVerbose(const std::vector<TuningResult>& results, std::
         {
             outputTarget << "Total duration: " << convertTime(bestResult.getTotalDuration(), timeUnit) << getTimeUnitTag(timeUnit) << std::endl;
         }
+        if (bestResult.hasCustomObjective())
+        {
+            outputTarget << "Objective value: " << bestResult.getObjectiveValue() << std::endl;
+        }
         outputTarget << std::endl;
     }
     else
@@ -100,6 +139,22 @@ void ResultPrinter::printVerbose(const std::vector<TuningResult>& results, std::
         outputTarget << "No best result found" << std::endl;
     }
 
+    std::vector<TuningResult> paretoResults = getParetoResults(results);
+    if (paretoResults.size() > 1)
+    {
+        outputTarget << "Pareto optimal results for kernel <" << bestResult.getKernelName() << ">: " << std::endl;
+        for (const auto& result : paretoResults)
+        {
+            outputTarget << "Configuration: ";
+            printConfigurationVerbose(outputTarget, result.getConfiguration());
+            outputTarget << "Kernel duration: " << convertTime(result.getKernelDuration(), timeUnit) << getTimeUnitTag(timeUnit)
+                << ", total duration: " << convertTime(result.getTotalDuration(), timeUnit) << getTimeUnitTag(timeUnit)
+                << ", maximum error: " << result.getMaximumError() << ", work-group memory: " << result.getWorkGroupMemory() << "B"
+                << std::endl;
+        }
+        outputTarget << std::endl;
+    }
+
     if (printInvalidResult)
     {
         for (const auto& result : results)
@@ -127,6 +182,38 @@ void ResultPrinter::printCsv(const std::vector<TuningResult>& results, std::ostr
     }
     outputTarget << "Kernel duration (" << getTimeUnitTag(timeUnit) << ")";
 
+    bool customObjective = std::any_of(results.cbegin(), results.cend(), [](const TuningResult& result)
+    {
+        return result.hasCustomObjective();
+    });
+    if (customObjective)
+    {
+        outputTarget << ",Objective";
+    }
+    outputTarget << ",Compilation duration (" << getTimeUnitTag(timeUnit) << ")";
+
+    // Quality objectives are printed only if some result reports them, Pareto optimality is then evaluated with regards to them
+    bool maximumError = std::any_of(results.cbegin(), results.cend(), [](const TuningResult& result)
+    {
+        return result.isValid() && result.getMaximumError() != 0.0;
+    });
+    bool workGroupMemory = std::any_of(results.cbegin(), results.cend(), [](const TuningResult& result)
+    {
+        return result.isValid() && result.getWorkGroupMemory() != 0;
+    });
+    if (maximumError)
+    {
+        outputTarget << ",Maximum error";
+    }
+    if (workGroupMemory)
+    {
+        outputTarget << ",Work-group memory (B)";
+    }
+    if (maximumError || workGroupMemory)
+    {
+        outputTarget << ",Pareto optimal";
+    }
+
     size_t kernelCount = results.at(0).getConfiguration().getGlobalSizes().size();
     if (kernelCount == 1)
     {
@@ -170,6 +257,27 @@ void ResultPrinter::printCsv(const std::vector<TuningResult>& results, std::ostr
             outputTarget << convertTime(result.getTotalDuration(), timeUnit) << ",";
         }
         outputTarget << convertTime(result.getKernelDuration(), timeUnit) << ",";
+        if (customObjective)
+        {
+            outputTarget << result.getObjectiveValue() << ",";
+        }
+        outputTarget << convertTime(result.getCompilationDuration(), timeUnit) << ",";
+        if (maximumError)
+        {
+            outputTarget << result.getMaximumError() << ",";
+        }
+        if (workGroupMemory)
+        {
+            outputTarget << result.getWorkGroupMemory() << ",";
+        }
+        if (maximumError || workGroupMemory)
+        {
+            bool paretoOptimal = std::none_of(results.cbegin(), results.cend(), [&result](const TuningResult& other)
+            {
+                return other.dominates(result);
+            });
+            outputTarget << (paretoOptimal ? 1 : 0) << ",";
+        }
         printConfigurationCsv(outputTarget, result.getConfiguration());
     }
 
@@ -311,7 +419,7 @@ TuningResult ResultPrinter::getBestResult(const std::vector<TuningResult>& resul
 
     for (const auto& result : results)
     {
-        if (result.getTotalDuration() < bestResult.getTotalDuration())
+        if (result.isValid() && (!bestResult.isValid() || result.getObjectiveValue() < bestResult.getObjectiveValue()))
         {
             bestResult = result;
         }
@@ -320,6 +428,31 @@ TuningResult ResultPrinter::getBestResult(const std::vector<TuningResult>& resul
     return bestResult;
 }
 
+std::vector<TuningResult> ResultPrinter::getParetoResults(const std::vector<TuningResult>& results) const
+{
+    std::vector<TuningResult> paretoResults;
+
+    for (const auto& result : results)
+    {
+        if (!result.isValid())
+        {
+            continue;
+        }
+
+        bool dominated = std::any_of(results.cbegin(), results.cend(), [&result](const TuningResult& other)
+        {
+            return other.dominates(result);
+        });
+
+        if (!dominated)
+        {
+            paretoResults.push_back(result);
+        }
+    }
+
+    return paretoResults;
+}
+
 uint64_t ResultPrinter::convertTime(const uint64_t timeInNanoseconds, const TimeUnit& targetUnit)
 {
     switch (targetUnit)
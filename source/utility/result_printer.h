@@ -20,6 +20,7 @@ public:
     void setTimeUnit(const TimeUnit& unit);
     void setInvalidResultPrinting(const TunerFlag flag);
     std::vector<ParameterPair> getBestConfiguration(const KernelId id) const;
+    bool hasResult(const KernelId id) const;
 
 private:
     std::map<KernelId, std::vector<TuningResult>> kernelResults;
@@ -31,6 +32,7 @@ private:
     void printConfigurationVerbose(std::ostream& outputTarget, const KernelConfiguration& configuration) const;
     void printConfigurationCsv(std::ostream& outputTarget, const KernelConfiguration& configuration) const;
     TuningResult getBestResult(const std::vector<TuningResult>& results) const;
+    std::vector<TuningResult> getParetoResults(const std::vector<TuningResult>& results) const;
     static uint64_t convertTime(const uint64_t timeInNanoseconds, const TimeUnit& targetUnit);
     static std::string getTimeUnitTag(const TimeUnit& unit);
 };
@@ -0,0 +1,61 @@
+#include <cstdio>
+#include "catch.hpp"
+#include "utility/decision_tree.h"
+
+TEST_CASE("Decision tree construction and lookup", "Component: DecisionTree")
+{
+    std::vector<ktt::ParameterPair> small{ktt::ParameterPair("work_group_size", 64)};
+    std::vector<ktt::ParameterPair> large{ktt::ParameterPair("work_group_size", 256)};
+    ktt::DecisionTree tree;
+    REQUIRE_THROWS(tree.getConfiguration(std::vector<size_t>{1}));
+
+    tree.addEntry(std::vector<size_t>{1024}, small);
+    tree.addEntry(std::vector<size_t>{4096}, small);
+    tree.addEntry(std::vector<size_t>{16384}, large);
+    tree.addEntry(std::vector<size_t>{65536}, large);
+
+    SECTION("Tuned and close inputs get configuration of tuned input")
+    {
+        REQUIRE(tree.getConfiguration(std::vector<size_t>{1024}) == small);
+        REQUIRE(tree.getConfiguration(std::vector<size_t>{65536}) == large);
+        REQUIRE(tree.getConfiguration(std::vector<size_t>{100}) == small);
+        REQUIRE(tree.getConfiguration(std::vector<size_t>{20000}) == large);
+        REQUIRE_THROWS(tree.getConfiguration(std::vector<size_t>{1024, 1}));
+    }
+
+    SECTION("Subtrees with the same configuration are merged")
+    {
+        REQUIRE(tree.getEntryCount() == 4);
+        REQUIRE(tree.getNodeCount() == 3);
+        REQUIRE_THROWS(tree.addEntry(std::vector<size_t>{1024, 1}, small));
+    }
+
+    SECTION("Tree is restored from file")
+    {
+        tree.addEntry(std::vector<size_t>{2048}, large);
+        tree.save("decision_tree_test.txt");
+        ktt::DecisionTree loadedTree = ktt::DecisionTree::load("decision_tree_test.txt");
+        std::remove("decision_tree_test.txt");
+
+        REQUIRE(loadedTree.getEntryCount() == 5);
+        REQUIRE(loadedTree.getNodeCount() == tree.getNodeCount());
+        for (const size_t size : std::vector<size_t>{1, 1024, 1500, 2048, 3000, 4096, 10000, 65536})
+        {
+            REQUIRE(loadedTree.getConfiguration(std::vector<size_t>{size}) == tree.getConfiguration(std::vector<size_t>{size}));
+        }
+        REQUIRE(loadedTree.getConfiguration(std::vector<size_t>{2048}) == large);
+    }
+
+    SECTION("Feature with the largest range is split first")
+    {
+        ktt::DecisionTree planeTree;
+        planeTree.addEntry(std::vector<size_t>{1, 100}, small);
+        planeTree.addEntry(std::vector<size_t>{2, 100}, small);
+        planeTree.addEntry(std::vector<size_t>{1, 1000}, large);
+        planeTree.addEntry(std::vector<size_t>{2, 1000}, large);
+
+        REQUIRE(planeTree.getNodeCount() == 3);
+        REQUIRE(planeTree.getConfiguration(std::vector<size_t>{5, 200}) == small);
+        REQUIRE(planeTree.getConfiguration(std::vector<size_t>{0, 900}) == large);
+    }
+}
@@ -32,9 +32,9 @@ TEST_CASE("Kernel handling operations", "Component: KernelManager")
     SECTION("Parameter with same name cannot be added twice")
     {
         manager.addParameter(id, "param", std::vector<size_t>{1, 2, 3}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Add,
-            ktt::Dimension::X);
+            ktt::Dimension::X, ktt::ParameterType::Ordinal);
         REQUIRE_THROWS_AS(manager.addParameter(id, "param", std::vector<size_t>{3}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Add,
-            ktt::Dimension::X), std::runtime_error);
+            ktt::Dimension::X, ktt::ParameterType::Ordinal), std::runtime_error);
     }
 }
 
@@ -43,9 +43,9 @@ TEST_CASE("Kernel configuration retrieval", "Component: KernelManager")
     ktt::KernelManager manager;
     ktt::KernelId id = manager.addKernelFromFile("../tests/test_kernel.cl", "testKernel", ktt::DimensionVector(1024), ktt::DimensionVector(16, 16));
     manager.addParameter(id, "param_one", std::vector<size_t>{1, 2, 3}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Add,
-        ktt::Dimension::X);
+        ktt::Dimension::X, ktt::ParameterType::Ordinal);
     manager.addParameter(id, "param_two", std::vector<size_t>{5, 10}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Add,
-        ktt::Dimension::X);
+        ktt::Dimension::X, ktt::ParameterType::Ordinal);
 
     SECTION("Kernel source with defines is returned correctly")
     {
@@ -0,0 +1,71 @@
+#include "catch.hpp"
+#include "tuning_runner/online_tuner.h"
+
+TEST_CASE("Online tuning policy", "Component: OnlineTuner")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t i = 1; i <= 3; i++)
+    {
+        configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{
+            ktt::ParameterPair("param", i)});
+    }
+    ktt::KernelConfiguration configuration(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{});
+
+    SECTION("Fastest validated configuration is exploited")
+    {
+        ktt::OnlineTuner tuner(configurations, 0.0, 1.0, 0);
+        REQUIRE_FALSE(tuner.getExploitedConfiguration(configuration));
+
+        tuner.addStoredResult(configurations.at(0), 300, true);
+        tuner.addStoredResult(configurations.at(1), 100, true);
+        tuner.addStoredResult(configurations.at(2), 50, false);
+        REQUIRE(tuner.getValidatedConfigurationsCount() == 2);
+        REQUIRE(tuner.getUntestedConfigurationsCount() == 0);
+        REQUIRE(tuner.getExploitedConfiguration(configuration));
+        REQUIRE(configuration.getParameterPairs() == configurations.at(1).getParameterPairs());
+
+        tuner.addResult(configurations.at(1), 700, true, false);
+        REQUIRE(tuner.getExploitedConfiguration(configuration));
+        REQUIRE(configuration.getParameterPairs() == configurations.at(0).getParameterPairs());
+    }
+
+    SECTION("Exploration is suspended while slowdown exceeds maximum")
+    {
+        ktt::OnlineTuner tuner(configurations, 1.0, 1.5, 0);
+        tuner.addResult(configurations.at(0), 100, true, false);
+
+        REQUIRE(tuner.getExploredConfiguration(configuration));
+        REQUIRE(configuration.getParameterPairs() != configurations.at(0).getParameterPairs());
+        tuner.addResult(configuration, 300, true, true);
+        REQUIRE(tuner.getSlowdown() == Approx(2.0));
+        REQUIRE_FALSE(tuner.getExploredConfiguration(configuration));
+
+        for (size_t i = 0; i < 3; i++)
+        {
+            REQUIRE(tuner.getExploitedConfiguration(configuration));
+            tuner.addResult(configuration, 100, true, false);
+        }
+        REQUIRE(tuner.getSlowdown() < 1.5);
+        REQUIRE(tuner.getExploredConfiguration(configuration));
+        REQUIRE(tuner.getUntestedConfigurationsCount() == 0);
+    }
+
+    SECTION("Time spent on validation of explored configuration is charged to exploration")
+    {
+        ktt::OnlineTuner tuner(configurations, 1.0, 1.5, 0);
+        tuner.addResult(configurations.at(0), 100, true, false);
+
+        REQUIRE(tuner.getExploredConfiguration(configuration));
+        tuner.addResult(configuration, 100, true, true);
+        REQUIRE(tuner.getSlowdown() == Approx(1.0));
+        tuner.addExplorationCost(200);
+        REQUIRE(tuner.getSlowdown() == Approx(2.0));
+        REQUIRE_FALSE(tuner.getExploredConfiguration(configuration));
+    }
+
+    SECTION("Invalid policy settings are rejected")
+    {
+        REQUIRE_THROWS(ktt::OnlineTuner(configurations, 1.5, 1.0, 0));
+        REQUIRE_THROWS(ktt::OnlineTuner(configurations, 0.5, 0.9, 0));
+    }
+}
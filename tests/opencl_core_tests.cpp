@@ -1,6 +1,10 @@
+#include <cstdint>
+#include <utility>
+#include <vector>
 #include "catch.hpp"
 #include "compute_engine/opencl/opencl_core.h"
 #include "kernel_argument/kernel_argument.h"
+#include "tuning_runner/device_comparator.h"
 
 std::string programSource(std::string("")
     + "__kernel void testKernel(float number, __global float* a, __global float* b, __global float* result)\n"
@@ -60,3 +64,63 @@ TEST_CASE("Working with OpenCL buffer", "Component: OpenclCore")
         }
     }
 }
+
+// Result differs from reference in two elements, by 2 at index 17 and by 1 at index 900
+template <typename T>
+static ktt::ComparisonSummary compareOnDevice(ktt::OpenclCore& core, const ktt::ArgumentDataType dataType)
+{
+    std::vector<T> result;
+    std::vector<T> reference;
+    for (size_t i = 0; i < 1000; i++)
+    {
+        result.push_back(static_cast<T>(static_cast<float>(i % 100)));
+        reference.push_back(static_cast<T>(static_cast<float>(i % 100)));
+    }
+    result.at(17) = static_cast<T>(static_cast<float>(19));
+    result.at(900) = static_cast<T>(static_cast<float>(1));
+
+    auto resultArgument = ktt::KernelArgument(0, result.data(), result.size(), dataType, ktt::ArgumentMemoryLocation::Device,
+        ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentUploadType::Vector);
+    auto referenceArgument = ktt::KernelArgument(1, reference.data(), reference.size(), dataType, ktt::ArgumentMemoryLocation::Device,
+        ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentUploadType::Vector);
+    core.uploadArgument(resultArgument);
+    core.uploadArgument(referenceArgument);
+
+    ktt::ComparisonSummary summary = ktt::DeviceComparator::compare(core, 0, resultArgument, referenceArgument, result.size(), 0.5);
+    core.clearBuffer(0);
+    core.clearBuffer(1);
+    return summary;
+}
+
+TEST_CASE("Running comparison kernels on device", "Component: DeviceComparator")
+{
+    ktt::OpenclCore core(0, 0, ktt::RunMode::Tuning);
+    std::vector<std::pair<ktt::ArgumentDataType, ktt::ComparisonSummary>> summaries{
+        {ktt::ArgumentDataType::Char, compareOnDevice<int8_t>(core, ktt::ArgumentDataType::Char)},
+        {ktt::ArgumentDataType::UnsignedChar, compareOnDevice<uint8_t>(core, ktt::ArgumentDataType::UnsignedChar)},
+        {ktt::ArgumentDataType::Short, compareOnDevice<int16_t>(core, ktt::ArgumentDataType::Short)},
+        {ktt::ArgumentDataType::UnsignedShort, compareOnDevice<uint16_t>(core, ktt::ArgumentDataType::UnsignedShort)},
+        {ktt::ArgumentDataType::Int, compareOnDevice<int32_t>(core, ktt::ArgumentDataType::Int)},
+        {ktt::ArgumentDataType::UnsignedInt, compareOnDevice<uint32_t>(core, ktt::ArgumentDataType::UnsignedInt)},
+        {ktt::ArgumentDataType::Long, compareOnDevice<int64_t>(core, ktt::ArgumentDataType::Long)},
+        {ktt::ArgumentDataType::UnsignedLong, compareOnDevice<uint64_t>(core, ktt::ArgumentDataType::UnsignedLong)},
+        {ktt::ArgumentDataType::Half, compareOnDevice<half_float::half>(core, ktt::ArgumentDataType::Half)},
+        {ktt::ArgumentDataType::Float, compareOnDevice<float>(core, ktt::ArgumentDataType::Float)}
+    };
+
+    // Double precision is optional in OpenCL
+    if (core.getCurrentDeviceInfo().getExtensions().find("cl_khr_fp64") != std::string::npos)
+    {
+        summaries.emplace_back(ktt::ArgumentDataType::Double, compareOnDevice<double>(core, ktt::ArgumentDataType::Double));
+    }
+
+    for (const auto& summary : summaries)
+    {
+        INFO(ktt::DeviceComparator::getKernelName(summary.first));
+        REQUIRE(summary.second.mismatchCount == 2);
+        REQUIRE(summary.second.firstMismatchIndex == 17);
+        REQUIRE(summary.second.maximumAbsoluteError == 2.0);
+        REQUIRE(summary.second.maximumRelativeError == Approx(2.0 / 17.0));
+        REQUIRE(summary.second.absoluteErrorSum == 3.0);
+    }
+}
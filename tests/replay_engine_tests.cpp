@@ -0,0 +1,80 @@
+#include "catch.hpp"
+#include "compute_engine/replay/replay_engine.h"
+#include "kernel/kernel_manager.h"
+#include "kernel_argument/argument_manager.h"
+#include "tuning_runner/tuning_runner.h"
+#include "utility/logger.h"
+
+TEST_CASE("Replaying recorded results", "Component: ReplayEngine")
+{
+    std::vector<ktt::TuningResult> recordedResults;
+    for (size_t i = 1; i <= 3; i++)
+    {
+        for (size_t j = 1; j <= 2; j++)
+        {
+            ktt::KernelConfiguration configuration(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{
+                ktt::ParameterPair("param_one", i), ktt::ParameterPair("param_two", j)});
+            recordedResults.emplace_back("testKernel", configuration, ktt::KernelRunResult(i * 100 + j, 0));
+            recordedResults.back().setCompilationDuration(i * 1000);
+        }
+    }
+    ktt::ReplayEngine engine(recordedResults);
+
+    SECTION("Recorded configurations are provided")
+    {
+        REQUIRE(engine.getParameterNames() == std::vector<std::string>({"param_one", "param_two"}));
+        REQUIRE(engine.getRecordedConfigurations().size() == 6);
+        REQUIRE(engine.getRecordedDuration(std::vector<size_t>{3, 1}) == 301);
+        REQUIRE(engine.getBestRecordedDuration() == 101);
+        REQUIRE_THROWS(engine.getRecordedDuration(std::vector<size_t>{4, 1}));
+    }
+
+    SECTION("Compilation duration is reported only for uncached programs")
+    {
+        std::string source("#define param_one 2\n#define param_two 1\n");
+        ktt::KernelRuntimeData kernelData(0, "testKernel", source, ktt::DimensionVector(1), ktt::DimensionVector(1),
+            std::vector<ktt::ArgumentId>{});
+        REQUIRE_FALSE(engine.isProgramCached(source));
+
+        ktt::KernelRunResult first = engine.runKernel(kernelData, std::vector<ktt::KernelArgument*>{},
+            std::vector<ktt::ArgumentOutputDescriptor>{});
+        REQUIRE(first.getDuration() == 201);
+        REQUIRE(first.getCompilationDuration() == 2000);
+        REQUIRE(engine.isProgramCached(source));
+
+        ktt::KernelRunResult second = engine.runKernel(kernelData, std::vector<ktt::KernelArgument*>{},
+            std::vector<ktt::ArgumentOutputDescriptor>{});
+        REQUIRE(second.getCompilationDuration() == 0);
+    }
+
+    SECTION("Tuning returns recorded durations")
+    {
+        ktt::KernelManager kernelManager;
+        ktt::ArgumentManager argumentManager(ktt::RunMode::Tuning);
+        ktt::Logger logger;
+        std::ostream nullStream(nullptr);
+        logger.setLoggingTarget(nullStream);
+
+        ktt::KernelId id = kernelManager.addKernel("", "testKernel", ktt::DimensionVector(1), ktt::DimensionVector(1));
+        kernelManager.addParameter(id, "param_one", std::vector<size_t>{1, 2, 3}, ktt::ThreadModifierType::None,
+            ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal);
+        kernelManager.addParameter(id, "param_two", std::vector<size_t>{1, 2, 3}, ktt::ThreadModifierType::None,
+            ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal);
+
+        ktt::TuningRunner tuningRunner(&argumentManager, &kernelManager, &logger, &engine, ktt::RunMode::Tuning);
+        std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+        REQUIRE(results.size() == 9);
+
+        size_t validCount = 0;
+        for (const auto& result : results)
+        {
+            if (result.isValid())
+            {
+                validCount++;
+                std::vector<ktt::ParameterPair> pairs = result.getConfiguration().getParameterPairs();
+                REQUIRE(result.getKernelDuration() == std::get<1>(pairs.at(0)) * 100 + std::get<1>(pairs.at(1)));
+            }
+        }
+        REQUIRE(validCount == 6);
+    }
+}
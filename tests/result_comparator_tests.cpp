@@ -0,0 +1,81 @@
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include "catch.hpp"
+#include "half.hpp"
+#include "tuning_runner/result_comparator.h"
+
+TEST_CASE("Comparison of raw argument data", "Component: ResultComparator")
+{
+    SECTION("Floating point mismatches are summarized")
+    {
+        std::vector<float> reference(1003, 2.0f);
+        std::vector<float> result = reference;
+        result.at(517) = 3.0f;
+        result.at(1001) = 1.5f;
+        result.at(20) = 2.00001f;
+
+        ktt::ComparisonSummary summary = ktt::ResultComparator::compare(result.data(), reference.data(), result.size(),
+            ktt::ArgumentDataType::Float, 1e-4);
+        REQUIRE(summary.mismatchCount == 2);
+        REQUIRE(summary.firstMismatchIndex == 517);
+        REQUIRE(summary.maximumAbsoluteError == Approx(1.0));
+        REQUIRE(summary.maximumRelativeError == Approx(0.5));
+        REQUIRE(summary.absoluteErrorSum == Approx(1.50001));
+
+        result.at(517) = std::numeric_limits<float>::quiet_NaN();
+        summary = ktt::ResultComparator::compare(result.data(), reference.data(), result.size(), ktt::ArgumentDataType::Float, 1e-4);
+        REQUIRE(summary.mismatchCount == 2);
+        REQUIRE(summary.maximumAbsoluteError == Approx(0.5));
+
+        summary = ktt::ResultComparator::compare(result.data(), reference.data(), 500, ktt::ArgumentDataType::Float, 1e-4);
+        REQUIRE(summary.mismatchCount == 0);
+        REQUIRE(summary.firstMismatchIndex == ktt::ResultComparator::noMismatch);
+    }
+
+    SECTION("Half and double data is compared")
+    {
+        std::vector<half_float::half> halfReference(37, half_float::half(1.0f));
+        std::vector<half_float::half> halfResult = halfReference;
+        halfResult.at(33) = half_float::half(1.5f);
+        ktt::ComparisonSummary summary = ktt::ResultComparator::compare(halfResult.data(), halfReference.data(), halfResult.size(),
+            ktt::ArgumentDataType::Half, 0.1);
+        REQUIRE(summary.mismatchCount == 1);
+        REQUIRE(summary.firstMismatchIndex == 33);
+        REQUIRE(summary.maximumAbsoluteError == Approx(0.5));
+
+        std::vector<double> doubleReference{0.0, 1.0, 2.0, 3.0, 4.0, -5.0};
+        std::vector<double> doubleResult{0.5, 1.0, 2.0, 3.0, 4.0, -4.0};
+        summary = ktt::ResultComparator::compare(doubleResult.data(), doubleReference.data(), doubleResult.size(),
+            ktt::ArgumentDataType::Double, 0.6);
+        REQUIRE(summary.mismatchCount == 1);
+        REQUIRE(summary.firstMismatchIndex == 5);
+        REQUIRE(summary.maximumRelativeError == Approx(0.2));
+    }
+
+    SECTION("Integer elements must be equal")
+    {
+        std::vector<int64_t> reference{1, 2, std::numeric_limits<int64_t>::max(), 4};
+        std::vector<int64_t> result{1, 2, std::numeric_limits<int64_t>::max() - 1, 4};
+        ktt::ComparisonSummary summary = ktt::ResultComparator::compare(result.data(), reference.data(), result.size(),
+            ktt::ArgumentDataType::Long, 10.0);
+        REQUIRE(summary.mismatchCount == 1);
+        REQUIRE(summary.firstMismatchIndex == 2);
+        REQUIRE(ktt::ResultComparator::getElement(result.data(), 3, ktt::ArgumentDataType::Long) == 4.0);
+    }
+
+    SECTION("Large data is compared by multiple threads")
+    {
+        std::vector<float> reference(1 << 23, 1.0f);
+        std::vector<float> result = reference;
+        result.at(5'000'001) = 4.0f;
+        result.at(reference.size() - 1) = 0.0f;
+
+        ktt::ComparisonSummary summary = ktt::ResultComparator::compare(result.data(), reference.data(), result.size(),
+            ktt::ArgumentDataType::Float, 1e-4);
+        REQUIRE(summary.mismatchCount == 2);
+        REQUIRE(summary.firstMismatchIndex == 5'000'001);
+        REQUIRE(summary.maximumAbsoluteError == Approx(3.0));
+        REQUIRE(summary.absoluteErrorSum == Approx(4.0));
+    }
+}
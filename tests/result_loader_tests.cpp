@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include "catch.hpp"
+#include "utility/result_loader.h"
+#include "utility/result_printer.h"
+
+TEST_CASE("Loading of results printed in CSV format", "Component: ResultLoader")
+{
+    std::vector<ktt::TuningResult> results;
+    for (size_t i = 1; i <= 3; i++)
+    {
+        ktt::KernelConfiguration configuration(ktt::DimensionVector(1024), ktt::DimensionVector(16), std::vector<ktt::ParameterPair>{
+            ktt::ParameterPair("param_one", i), ktt::ParameterPair("param_two", 2 * i)});
+        ktt::TuningResult result("testKernel", configuration, ktt::KernelRunResult(i * 1'000'000, 0));
+        results.push_back(result);
+    }
+
+    ktt::ResultPrinter printer;
+    printer.setResult(0, results);
+    {
+        std::ofstream outputFile("result_loader_test.csv");
+        printer.printResult(0, outputFile, ktt::PrintFormat::CSV);
+    }
+
+    SECTION("Durations and parameters are restored")
+    {
+        std::vector<ktt::TuningResult> loadedResults = ktt::ResultLoader::loadResults("result_loader_test.csv", "testKernel");
+        REQUIRE(loadedResults.size() == 3);
+        REQUIRE(loadedResults.at(1).isValid());
+        REQUIRE(loadedResults.at(1).getKernelDuration() == 2'000'000);
+
+        std::vector<ktt::ParameterPair> parameterPairs = loadedResults.at(2).getConfiguration().getParameterPairs();
+        REQUIRE(parameterPairs.size() == 2);
+        REQUIRE(std::get<0>(parameterPairs.at(1)) == "param_two");
+        REQUIRE(std::get<1>(parameterPairs.at(1)) == 6);
+    }
+
+    SECTION("Results of other kernels are skipped")
+    {
+        std::vector<ktt::TuningResult> loadedResults = ktt::ResultLoader::loadResults("result_loader_test.csv", "otherKernel");
+        REQUIRE(loadedResults.empty());
+    }
+
+    std::remove("result_loader_test.csv");
+}
+
+TEST_CASE("Quality columns are printed only if reported", "Component: ResultLoader")
+{
+    std::vector<ktt::TuningResult> results;
+    for (size_t i = 1; i <= 2; i++)
+    {
+        ktt::KernelConfiguration configuration(ktt::DimensionVector(1024), ktt::DimensionVector(16), std::vector<ktt::ParameterPair>{
+            ktt::ParameterPair("param_one", i)});
+        results.emplace_back("testKernel", configuration, ktt::KernelRunResult(i * 1'000'000, 0));
+    }
+
+    ktt::ResultPrinter printer;
+    printer.setResult(0, results);
+    std::stringstream plainOutput;
+    printer.printResult(0, plainOutput, ktt::PrintFormat::CSV);
+    REQUIRE(plainOutput.str().find("Maximum error") == std::string::npos);
+    REQUIRE(plainOutput.str().find("Work-group memory") == std::string::npos);
+    REQUIRE(plainOutput.str().find("Pareto optimal") == std::string::npos);
+
+    results.at(0).setWorkGroupMemory(4096);
+    results.at(1).setWorkGroupMemory(2048);
+    printer.setResult(0, results);
+    {
+        std::ofstream outputFile("result_loader_memory_test.csv");
+        printer.printResult(0, outputFile, ktt::PrintFormat::CSV);
+    }
+
+    std::ifstream inputFile("result_loader_memory_test.csv");
+    std::string header;
+    std::getline(inputFile, header);
+    inputFile.close();
+    REQUIRE(header.find("Maximum error") == std::string::npos);
+    REQUIRE(header.find("Work-group memory (B)") != std::string::npos);
+    REQUIRE(header.find("Pareto optimal") != std::string::npos);
+
+    std::vector<ktt::TuningResult> loadedResults = ktt::ResultLoader::loadResults("result_loader_memory_test.csv", "testKernel");
+    REQUIRE(loadedResults.size() == 2);
+    REQUIRE(loadedResults.at(0).getWorkGroupMemory() == 4096);
+    REQUIRE(loadedResults.at(1).getWorkGroupMemory() == 2048);
+
+    std::remove("result_loader_memory_test.csv");
+}
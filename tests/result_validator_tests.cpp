@@ -0,0 +1,390 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+#include "catch.hpp"
+#include "compute_engine/replay/replay_engine.h"
+#include "tuning_runner/device_comparator.h"
+#include "tuning_runner/reference_cache.h"
+#include "tuning_runner/result_validator.h"
+#include "utility/mapped_file.h"
+
+#if defined(_WIN32)
+#include <direct.h>
+#include <io.h>
+#else
+#include <dirent.h>
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+class DoublingReference : public ktt::ReferenceClass
+{
+public:
+    DoublingReference(const std::vector<float>& input, size_t& computationCount) :
+        input(input),
+        computationCount(computationCount)
+    {}
+
+    void computeResult() override
+    {
+        computationCount++;
+        result.clear();
+        for (const auto value : input)
+        {
+            result.push_back(value * 2.0f);
+        }
+    }
+
+    const void* getData(const ktt::ArgumentId) const override
+    {
+        return result.data();
+    }
+
+private:
+    const std::vector<float>& input;
+    size_t& computationCount;
+    std::vector<float> result;
+};
+
+// Emulates generated comparison kernel on host, reference data is uploaded only when it is not present on device yet
+class ComparingEngine : public ktt::ReplayEngine
+{
+public:
+    explicit ComparingEngine(const std::vector<ktt::TuningResult>& recordedResults) :
+        ReplayEngine(recordedResults),
+        comparisonCount(0),
+        comparisonFails(false)
+    {}
+
+    ktt::KernelRunResult runKernel(const ktt::KernelRuntimeData& kernelData, const std::vector<ktt::KernelArgument*>& argumentPointers,
+        const std::vector<ktt::ArgumentOutputDescriptor>& outputDescriptors) override
+    {
+        if (kernelData.getName().find("kttCompare") != 0)
+        {
+            return ReplayEngine::runKernel(kernelData, argumentPointers, outputDescriptors);
+        }
+        if (comparisonFails)
+        {
+            throw std::runtime_error("Comparison kernel compilation failed");
+        }
+
+        comparisonCount++;
+        ktt::KernelArgument& reference = *argumentPointers.at(1);
+        if (uploadedReferenceIds.insert(reference.getId()).second)
+        {
+            uploadArgument(reference);
+        }
+
+        const ktt::KernelArgument result = downloadArgument(argumentPointers.at(0)->getId());
+        const ktt::KernelArgument storedReference = downloadArgument(reference.getId());
+        const uint32_t count = *static_cast<const uint32_t*>(argumentPointers.at(2)->getData());
+        const double tolerance = ktt::ResultComparator::getElement(argumentPointers.at(3)->getData(), 0,
+            argumentPointers.at(3)->getDataType());
+        const ktt::ComparisonSummary summary = ktt::ResultComparator::compare(result.getData(), storedReference.getData(), count,
+            reference.getDataType(), tolerance);
+
+        std::vector<float> errors{static_cast<float>(summary.maximumAbsoluteError), static_cast<float>(summary.maximumRelativeError),
+            static_cast<float>(summary.absoluteErrorSum)};
+        std::vector<uint32_t> deviceSummary{static_cast<uint32_t>(summary.mismatchCount), 0xFFFFFFFF, 0, 0, 0};
+        if (summary.mismatchCount > 0)
+        {
+            deviceSummary.at(1) = static_cast<uint32_t>(summary.firstMismatchIndex);
+        }
+        std::memcpy(&deviceSummary.at(2), errors.data(), errors.size() * sizeof(float));
+        updateArgument(argumentPointers.at(4)->getId(), deviceSummary.data(), deviceSummary.size() * sizeof(uint32_t));
+        return ktt::KernelRunResult(0, 0);
+    }
+
+    size_t comparisonCount;
+    bool comparisonFails;
+    std::set<ktt::ArgumentId> uploadedReferenceIds;
+};
+
+static void writeFile(const std::string& filePath, const void* data, const size_t dataSize)
+{
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    file.write(static_cast<const char*>(data), dataSize);
+}
+
+// Reference cache tests use fresh directory, so that results of earlier test runs are never loaded
+static std::string createTemporaryDirectory()
+{
+#if defined(_WIN32)
+    char path[] = "ktt_reference_cache_XXXXXX";
+    if (_mktemp_s(path, sizeof(path)) != 0 || _mkdir(path) != 0)
+    {
+        throw std::runtime_error("Unable to create temporary directory");
+    }
+    return path;
+#else
+    char path[] = "/tmp/ktt_reference_cache_XXXXXX";
+    if (mkdtemp(path) == nullptr)
+    {
+        throw std::runtime_error("Unable to create temporary directory");
+    }
+    return path;
+#endif
+}
+
+static void removeDirectory(const std::string& directoryPath)
+{
+#if defined(_WIN32)
+    _finddata_t fileData;
+    intptr_t handle = _findfirst((directoryPath + "/*").c_str(), &fileData);
+    if (handle != -1)
+    {
+        do
+        {
+            if ((fileData.attrib & _A_SUBDIR) == 0)
+            {
+                std::remove((directoryPath + "/" + fileData.name).c_str());
+            }
+        }
+        while (_findnext(handle, &fileData) == 0);
+        _findclose(handle);
+    }
+    _rmdir(directoryPath.c_str());
+#else
+    DIR* directory = opendir(directoryPath.c_str());
+    if (directory != nullptr)
+    {
+        while (dirent* entry = readdir(directory))
+        {
+            const std::string name(entry->d_name);
+            if (name != "." && name != "..")
+            {
+                std::remove((directoryPath + "/" + name).c_str());
+            }
+        }
+        closedir(directory);
+    }
+    rmdir(directoryPath.c_str());
+#endif
+}
+
+TEST_CASE("Validation with golden files and cached references", "Component: ResultValidator")
+{
+    ktt::ArgumentManager argumentManager(ktt::RunMode::Tuning);
+    ktt::KernelManager kernelManager;
+    ktt::Logger logger;
+    std::stringstream logStream;
+    logger.setLoggingTarget(logStream);
+    ktt::KernelConfiguration configuration(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{});
+    ktt::ReplayEngine engine(std::vector<ktt::TuningResult>{ktt::TuningResult("testKernel", configuration, ktt::KernelRunResult(100, 0))});
+
+    std::vector<float> input{1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> output{2.0f, 4.0f, 6.0f, 8.0f};
+    ktt::ArgumentId inputId = argumentManager.addArgument(input.data(), input.size(), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentUploadType::Vector);
+    ktt::ArgumentId outputId = argumentManager.addArgument(output.data(), output.size(), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::WriteOnly, ktt::ArgumentUploadType::Vector);
+    ktt::KernelId id = kernelManager.addKernel("", "testKernel", ktt::DimensionVector(1), ktt::DimensionVector(1));
+    kernelManager.setArguments(id, std::vector<ktt::ArgumentId>{inputId, outputId});
+    engine.uploadArgument(argumentManager.getArgument(outputId));
+
+    const ktt::Kernel& kernel = kernelManager.getKernel(id);
+    ktt::ResultValidator validator(&argumentManager, &kernelManager, &logger, &engine);
+
+    SECTION("Output is compared to golden file")
+    {
+        writeFile("golden_file_test.bin", output.data(), output.size() * sizeof(float));
+        validator.setReferenceFile(id, outputId, "golden_file_test.bin");
+        REQUIRE(validator.hasReference(id));
+        validator.computeReferenceResult(kernel);
+        REQUIRE(validator.validateArgumentsWithFile(kernel, configuration));
+
+        std::vector<float> wrongOutput{2.0f, 4.0f, 6.0f, 9.0f};
+        writeFile("golden_file_test.bin", wrongOutput.data(), wrongOutput.size() * sizeof(float));
+        validator.clearReferenceResults();
+        validator.computeReferenceResult(kernel);
+        REQUIRE_FALSE(validator.validateArgumentsWithFile(kernel, configuration));
+
+        writeFile("golden_file_test.bin", output.data(), 5);
+        validator.clearReferenceResults();
+        REQUIRE_THROWS(validator.computeReferenceResult(kernel));
+
+        validator.setReferenceFile(id, inputId, "golden_file_test.bin");
+        validator.clearReferenceResults();
+        REQUIRE_THROWS(validator.computeReferenceResult(kernel));
+
+        validator.setReferenceFile(id, inputId, "");
+        validator.setReferenceFile(id, outputId, "");
+        REQUIRE_FALSE(validator.hasReference(id));
+        std::remove("golden_file_test.bin");
+    }
+
+    SECTION("Reference class result is loaded from cache")
+    {
+        size_t computationCount = 0;
+        const std::string directory = createTemporaryDirectory();
+        REQUIRE_THROWS(validator.setReferenceCache(directory + "/missing"));
+        validator.setReferenceCache(directory);
+        validator.setReferenceClass(id, std::make_unique<DoublingReference>(input, computationCount), std::vector<ktt::ArgumentId>{outputId});
+        validator.computeReferenceResult(kernel);
+        REQUIRE(computationCount == 1);
+        REQUIRE(validator.validateArgumentsWithClass(kernel, configuration));
+
+        validator.clearReferenceResults();
+        validator.computeReferenceResult(kernel);
+        REQUIRE(computationCount == 1);
+        REQUIRE(logStream.str().find("Loaded cached reference class result for kernel: testKernel") != std::string::npos);
+        REQUIRE(validator.validateArgumentsWithClass(kernel, configuration));
+
+        // Result which cannot be stored is still used for validation
+        removeDirectory(directory);
+        validator.clearReferenceResults();
+        validator.computeReferenceResult(kernel);
+        REQUIRE(computationCount == 2);
+        REQUIRE(logStream.str().find("Unable to store reference result in cache") != std::string::npos);
+        REQUIRE(validator.validateArgumentsWithClass(kernel, configuration));
+
+        validator.setReferenceCache("");
+        validator.clearReferenceResults();
+        validator.computeReferenceResult(kernel);
+        REQUIRE(computationCount == 3);
+    }
+}
+
+TEST_CASE("Reference cache storage", "Component: ReferenceCache")
+{
+    ktt::ArgumentManager argumentManager(ktt::RunMode::Tuning);
+    std::vector<int> data{1, 2, 3};
+    ktt::ArgumentId id = argumentManager.addArgument(data.data(), data.size(), ktt::ArgumentDataType::Int,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::ReadWrite, ktt::ArgumentUploadType::Vector);
+    const ktt::KernelArgument& argument = argumentManager.getArgument(id);
+
+    SECTION("Key depends on reference and input contents")
+    {
+        const std::string key = ktt::ReferenceCache::getKey("reference", std::vector<const ktt::KernelArgument*>{&argument},
+            std::vector<ktt::ArgumentId>{id});
+        REQUIRE(key == ktt::ReferenceCache::getKey("reference", std::vector<const ktt::KernelArgument*>{&argument},
+            std::vector<ktt::ArgumentId>{id}));
+        REQUIRE(key != ktt::ReferenceCache::getKey("other reference", std::vector<const ktt::KernelArgument*>{&argument},
+            std::vector<ktt::ArgumentId>{id}));
+
+        std::vector<int> otherData{1, 2, 4};
+        argumentManager.updateArgument(id, otherData.data(), otherData.size());
+        REQUIRE(key != ktt::ReferenceCache::getKey("reference", std::vector<const ktt::KernelArgument*>{&argument},
+            std::vector<ktt::ArgumentId>{id}));
+    }
+
+    SECTION("Stored results are loaded")
+    {
+        const std::string directory = createTemporaryDirectory();
+        ktt::ReferenceCache cache(directory);
+        std::vector<ktt::KernelArgument> result;
+        REQUIRE_FALSE(cache.load("reference_cache_test", std::vector<ktt::ArgumentId>{id}, argumentManager, result));
+
+        cache.store("reference_cache_test", std::vector<ktt::KernelArgument>{argument});
+        REQUIRE(cache.load("reference_cache_test", std::vector<ktt::ArgumentId>{id}, argumentManager, result));
+        REQUIRE(result.size() == 1);
+        REQUIRE(result.at(0).getDataInt() == data);
+        REQUIRE_FALSE(cache.load("reference_cache_test", std::vector<ktt::ArgumentId>{id, id}, argumentManager, result));
+
+        ktt::MappedFile file(cache.getFilePath("reference_cache_test"));
+        REQUIRE(file.getSize() == 8 + 8 + 4 * 8 + 16);
+        removeDirectory(directory);
+    }
+
+    SECTION("Files inconsistent with argument are cache misses")
+    {
+        const std::string directory = createTemporaryDirectory();
+        ktt::ReferenceCache cache(directory);
+        std::vector<ktt::KernelArgument> result;
+
+        // Header fields of the argument follow magic and argument count: id, data type, number of elements and size in bytes
+        const uint64_t floatType = static_cast<uint64_t>(ktt::ArgumentDataType::Float);
+        for (const auto& field : std::vector<std::pair<std::streamoff, uint64_t>>{{24, 99}, {24, floatType}, {32, 1'000'000'000},
+            {40, 1'000'000'000}})
+        {
+            cache.store("reference_cache_test", std::vector<ktt::KernelArgument>{argument});
+            {
+                std::fstream file(cache.getFilePath("reference_cache_test"), std::ios::in | std::ios::out | std::ios::binary);
+                file.seekp(field.first);
+                file.write(reinterpret_cast<const char*>(&field.second), sizeof(uint64_t));
+            }
+            REQUIRE_FALSE(cache.load("reference_cache_test", std::vector<ktt::ArgumentId>{id}, argumentManager, result));
+        }
+
+        REQUIRE(result.empty());
+        removeDirectory(directory);
+    }
+}
+
+TEST_CASE("Validation on device with downloaded summary", "Component: ResultValidator")
+{
+    ktt::ArgumentManager argumentManager(ktt::RunMode::Tuning);
+    ktt::KernelManager kernelManager;
+    ktt::Logger logger;
+    std::stringstream logStream;
+    logger.setLoggingTarget(logStream);
+    ktt::KernelConfiguration configuration(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{});
+    ComparingEngine engine(std::vector<ktt::TuningResult>{ktt::TuningResult("testKernel", configuration, ktt::KernelRunResult(100, 0))});
+
+    std::vector<float> output{2.0f, 4.0f, 6.0f, 8.0f};
+    ktt::ArgumentId outputId = argumentManager.addArgument(output.data(), output.size(), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::WriteOnly, ktt::ArgumentUploadType::Vector);
+    ktt::KernelId id = kernelManager.addKernel("", "testKernel", ktt::DimensionVector(1), ktt::DimensionVector(1));
+    kernelManager.setArguments(id, std::vector<ktt::ArgumentId>{outputId});
+    engine.uploadArgument(argumentManager.getArgument(outputId));
+
+    const ktt::Kernel& kernel = kernelManager.getKernel(id);
+    ktt::ResultValidator validator(&argumentManager, &kernelManager, &logger, &engine);
+    writeFile("device_validation_test.bin", output.data(), output.size() * sizeof(float));
+    validator.setReferenceFile(id, outputId, "device_validation_test.bin");
+    validator.setValidationBackend(outputId, ktt::ValidationBackend::Device);
+    REQUIRE(validator.getValidationBackend(outputId) == ktt::ValidationBackend::Device);
+    validator.computeReferenceResult(kernel);
+
+    SECTION("Reference stays on device between validations")
+    {
+        REQUIRE(validator.validateArgumentsWithFile(kernel, configuration));
+        REQUIRE(validator.validateArgumentsWithFile(kernel, configuration));
+        REQUIRE(engine.comparisonCount == 2);
+        REQUIRE(engine.uploadedReferenceIds.size() == 1);
+
+        std::vector<float> wrongOutput{2.0f, 4.5f, 6.0f, 9.0f};
+        engine.updateArgument(outputId, wrongOutput.data(), wrongOutput.size() * sizeof(float));
+        REQUIRE_FALSE(validator.validateArgumentsWithFile(kernel, configuration));
+        REQUIRE(validator.getMaximumError() == 1.0);
+        REQUIRE(logStream.str().find("index: 1, reference value: 4, mismatched elements: 2") != std::string::npos);
+
+        const ktt::ArgumentId referenceId = *engine.uploadedReferenceIds.cbegin();
+        REQUIRE(referenceId == ktt::DeviceComparator::firstReferenceArgumentId);
+        REQUIRE_NOTHROW(engine.downloadArgument(referenceId));
+        REQUIRE_THROWS(engine.downloadArgument(ktt::DeviceComparator::summaryArgumentId));
+        validator.clearReferenceResults();
+        REQUIRE_THROWS(engine.downloadArgument(referenceId));
+    }
+
+    SECTION("Argument is validated on host when device comparison fails")
+    {
+        engine.comparisonFails = true;
+        REQUIRE(validator.validateArgumentsWithFile(kernel, configuration));
+        REQUIRE(logStream.str().find("argument is validated on host instead") != std::string::npos);
+
+        validator.setValidationBackend(outputId, ktt::ValidationBackend::Host);
+        engine.comparisonFails = false;
+        REQUIRE(validator.validateArgumentsWithFile(kernel, configuration));
+        REQUIRE(engine.comparisonCount == 0);
+    }
+
+    std::remove("device_validation_test.bin");
+}
+
+TEST_CASE("Comparison kernel generation", "Component: DeviceComparator")
+{
+    for (const auto dataType : std::vector<ktt::ArgumentDataType>{ktt::ArgumentDataType::Char, ktt::ArgumentDataType::UnsignedLong,
+        ktt::ArgumentDataType::Half, ktt::ArgumentDataType::Float, ktt::ArgumentDataType::Double})
+    {
+        const std::string source = ktt::DeviceComparator::getKernelSource(dataType);
+        REQUIRE(source.find(std::string("KTT_KERNEL void ") + ktt::DeviceComparator::getKernelName(dataType) + "(") != std::string::npos);
+        REQUIRE(source.find('$') == std::string::npos);
+        REQUIRE((source.find("cl_khr_fp64") != std::string::npos) == (dataType == ktt::ArgumentDataType::Double));
+    }
+}
@@ -0,0 +1,568 @@
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <set>
+#include "catch.hpp"
+#include "tuning_runner/searcher/annealing_searcher.h"
+#include "tuning_runner/searcher/cost_aware_searcher.h"
+#include "tuning_runner/searcher/full_searcher.h"
+#include "tuning_runner/searcher/parameter_effect_model.h"
+#include "tuning_runner/searcher/pareto_searcher.h"
+#include "tuning_runner/searcher/pattern_searcher.h"
+#include "tuning_runner/searcher/portfolio_searcher.h"
+#include "tuning_runner/searcher/profile_guided_searcher.h"
+#include "tuning_runner/searcher/pso_searcher.h"
+#include "tuning_runner/searcher/random_searcher.h"
+#include "tuning_runner/searcher/transfer_searcher.h"
+
+TEST_CASE("Searcher batch protocol", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 4; a++)
+    {
+        for (size_t b = 1; b <= 4; b++)
+        {
+            configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+                std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a), ktt::ParameterPair("b", b)});
+        }
+    }
+    std::vector<ktt::KernelParameter> parameters{
+        ktt::KernelParameter("a", std::vector<size_t>{1, 2, 3, 4}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply,
+            ktt::Dimension::X, ktt::ParameterType::Ordinal),
+        ktt::KernelParameter("b", std::vector<size_t>{1, 2, 3, 4}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply,
+            ktt::Dimension::X, ktt::ParameterType::Ordinal)};
+
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        uint64_t duration = std::get<1>(configuration.getParameterPairs().at(0)) * 10 + std::get<1>(configuration.getParameterPairs().at(1));
+        return ktt::TuningResult("kernel", configuration, ktt::KernelRunResult(duration, 0));
+    };
+
+    SECTION("Full searcher proposes every configuration exactly once")
+    {
+        ktt::FullSearcher searcher(configurations);
+        auto first = searcher.getNextConfigurationBatch(10);
+        auto second = searcher.getNextConfigurationBatch(10);
+        REQUIRE(first.size() == 10);
+        REQUIRE(second.size() == 6);
+        REQUIRE(searcher.getNextConfigurationBatch(10).empty());
+    }
+
+    SECTION("Random searcher batches are limited by fraction")
+    {
+        ktt::RandomSearcher searcher(configurations, 0.5, 1);
+        REQUIRE(searcher.getNextConfigurationBatch(5).size() == 5);
+        REQUIRE(searcher.getNextConfigurationBatch(5).size() == 3);
+    }
+
+    SECTION("PSO searcher proposes one configuration per particle and accepts results out of order")
+    {
+        ktt::PSOSearcher searcher(configurations, parameters, 1.0, 4, 0.4, 0.4, 0.1, 1);
+        auto batch = searcher.getNextConfigurationBatch(10);
+        REQUIRE(batch.size() == 4);
+        REQUIRE(searcher.getNextConfigurationBatch(10).empty());
+
+        searcher.processBatchResult(makeResult(batch.at(2)));
+        searcher.processBatchResult(makeResult(batch.at(0)));
+        REQUIRE(searcher.getNextConfigurationBatch(10).size() == 2);
+    }
+
+    SECTION("Annealing searcher runs parallel chains and accepts results out of order")
+    {
+        ktt::AnnealingSearcher searcher(configurations, 1.0, 4.0, 1);
+        auto batch = searcher.getNextConfigurationBatch(3);
+        REQUIRE(batch.size() == 3);
+        REQUIRE(searcher.getNextConfigurationBatch(3).empty());
+
+        std::reverse(batch.begin(), batch.end());
+        for (const auto& configuration : batch)
+        {
+            searcher.processBatchResult(makeResult(configuration));
+        }
+        REQUIRE(searcher.getNextConfigurationBatch(3).size() == 3);
+    }
+}
+
+TEST_CASE("Portfolio search", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 4; a++)
+    {
+        for (size_t b = 1; b <= 4; b++)
+        {
+            configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+                std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a), ktt::ParameterPair("b", b)});
+        }
+    }
+    std::vector<ktt::KernelParameter> parameters{
+        ktt::KernelParameter("a", std::vector<size_t>{1, 2, 3, 4}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply,
+            ktt::Dimension::X, ktt::ParameterType::Ordinal),
+        ktt::KernelParameter("b", std::vector<size_t>{1, 2, 3, 4}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply,
+            ktt::Dimension::X, ktt::ParameterType::Ordinal)};
+
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        uint64_t duration = std::get<1>(configuration.getParameterPairs().at(0)) * 10 + std::get<1>(configuration.getParameterPairs().at(1));
+        return ktt::TuningResult("kernel", configuration, ktt::KernelRunResult(duration, 0));
+    };
+
+    SECTION("Portfolio searcher never evaluates configuration twice")
+    {
+        std::vector<std::unique_ptr<ktt::Searcher>> searchers;
+        searchers.push_back(std::make_unique<ktt::RandomSearcher>(configurations, 1.0, 1));
+        searchers.push_back(std::make_unique<ktt::AnnealingSearcher>(configurations, 1.0, 4.0, 2));
+        searchers.push_back(std::make_unique<ktt::PSOSearcher>(configurations, parameters, 1.0, 4, 0.4, 0.4, 0.1, 3));
+        ktt::PortfolioSearcher searcher(configurations, std::move(searchers), 1.0, 4);
+        REQUIRE(searcher.getConfigurationsCount() == configurations.size());
+
+        std::set<std::vector<size_t>> evaluated;
+        for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+        {
+            ktt::KernelConfiguration configuration = searcher.getNextConfiguration();
+            evaluated.insert(std::vector<size_t>{std::get<1>(configuration.getParameterPairs().at(0)),
+                std::get<1>(configuration.getParameterPairs().at(1))});
+            searcher.calculateNextConfiguration(makeResult(configuration));
+        }
+        REQUIRE(evaluated.size() == configurations.size());
+    }
+
+    SECTION("Exhausted searcher is replaced by random unexplored configurations")
+    {
+        // Random searcher proposes every configuration once, answers from cache exhaust it before portfolio finishes
+        for (unsigned int seed = 1; seed <= 10; seed++)
+        {
+            std::vector<std::unique_ptr<ktt::Searcher>> searchers;
+            searchers.push_back(std::make_unique<ktt::RandomSearcher>(configurations, 1.0, seed));
+            searchers.push_back(std::make_unique<ktt::RandomSearcher>(configurations, 1.0, seed + 1));
+            ktt::PortfolioSearcher searcher(configurations, std::move(searchers), 1.0, seed);
+
+            std::set<std::vector<size_t>> evaluated;
+            for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+            {
+                ktt::KernelConfiguration configuration = searcher.getNextConfiguration();
+                evaluated.insert(std::vector<size_t>{std::get<1>(configuration.getParameterPairs().at(0)),
+                    std::get<1>(configuration.getParameterPairs().at(1))});
+                searcher.calculateNextConfiguration(makeResult(configuration));
+            }
+            REQUIRE(evaluated.size() == configurations.size());
+        }
+    }
+}
+
+TEST_CASE("Transfer search seeded from prior results", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 8; a++)
+    {
+        configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+            std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a)});
+    }
+
+    auto makeResult = [](const std::vector<ktt::ParameterPair>& parameterPairs, const uint64_t duration)
+    {
+        ktt::KernelConfiguration configuration(ktt::DimensionVector(), ktt::DimensionVector(), parameterPairs);
+        return ktt::TuningResult("kernel", configuration, ktt::KernelRunResult(duration, 0));
+    };
+
+    // Prior results are matched by parameter names, so extra prior parameters are ignored, configurations outside of current space
+    // and results missing current parameters are skipped
+    std::vector<ktt::TuningResult> priorResults{
+        makeResult(std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", 2)}, 200),
+        makeResult(std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", 5)}, 100),
+        makeResult(std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", 3), ktt::ParameterPair("c", 1)}, 150),
+        makeResult(std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", 9)}, 10),
+        makeResult(std::vector<ktt::ParameterPair>{ktt::ParameterPair("b", 1)}, 10)};
+
+    SECTION("Best prior configurations are proposed first")
+    {
+        ktt::TransferSearcher searcher(configurations, priorResults, 1.0, 2, 1);
+        REQUIRE(searcher.getConfigurationsCount() == configurations.size());
+
+        std::vector<size_t> proposed;
+        for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+        {
+            ktt::KernelConfiguration configuration = searcher.getNextConfiguration();
+            const size_t a = std::get<1>(configuration.getParameterPairs().at(0));
+            proposed.push_back(a);
+            searcher.calculateNextConfiguration(makeResult(configuration.getParameterPairs(), 100 + 10 * a));
+        }
+
+        REQUIRE(proposed.at(0) == 5);
+        REQUIRE(proposed.at(1) == 3);
+        std::sort(proposed.begin(), proposed.end());
+        REQUIRE(std::unique(proposed.begin(), proposed.end()) == proposed.end());
+    }
+
+    SECTION("Searcher without matching prior results still explores whole space")
+    {
+        ktt::TransferSearcher searcher(configurations, std::vector<ktt::TuningResult>{priorResults.back()}, 0.5, 4, 1);
+        REQUIRE(searcher.getConfigurationsCount() == 4);
+
+        std::set<size_t> proposed;
+        for (size_t i = 0; i < configurations.size(); i++)
+        {
+            ktt::KernelConfiguration configuration = searcher.getNextConfiguration();
+            proposed.insert(std::get<1>(configuration.getParameterPairs().at(0)));
+            searcher.calculateNextConfiguration(makeResult(configuration.getParameterPairs(), 100));
+        }
+        REQUIRE(proposed.size() == configurations.size());
+    }
+
+    REQUIRE_THROWS(ktt::TransferSearcher(std::vector<ktt::KernelConfiguration>{}, priorResults, 1.0, 2, 1));
+}
+
+TEST_CASE("Pattern search in ordinal parameter space", "Component: Searcher")
+{
+    std::vector<size_t> values{1, 2, 4, 8, 16, 32, 64, 128};
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (const auto a : values)
+    {
+        for (const auto b : values)
+        {
+            // Configuration with maximum value of both parameters is excluded, as if by constraint
+            if (a != 128 || b != 128)
+            {
+                configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+                    std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a), ktt::ParameterPair("b", b)});
+            }
+        }
+    }
+    std::vector<ktt::KernelParameter> parameters{
+        ktt::KernelParameter("a", std::vector<size_t>{128, 64, 32, 16, 8, 4, 2, 1}, ktt::ThreadModifierType::None,
+            ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal),
+        ktt::KernelParameter("b", values, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply, ktt::Dimension::X,
+            ktt::ParameterType::Ordinal)};
+
+    // Smooth landscape with optimum at a = 32, b = 4
+    auto getDuration = [](const ktt::KernelConfiguration& configuration)
+    {
+        size_t a = std::get<1>(configuration.getParameterPairs().at(0));
+        size_t b = std::get<1>(configuration.getParameterPairs().at(1));
+        uint64_t distanceA = a > 32 ? a / 32 : 32 / a;
+        uint64_t distanceB = b > 4 ? b / 4 : 4 / b;
+        return 100 * distanceA + 100 * distanceB;
+    };
+
+    for (unsigned int seed = 0; seed < 10; seed++)
+    {
+        ktt::PatternSearcher searcher(configurations, parameters, 1.0, seed * 1'000'003);
+        uint64_t bestDuration = UINT64_MAX;
+
+        for (size_t i = 0; i < 30; i++)
+        {
+            ktt::KernelConfiguration configuration = searcher.getNextConfiguration();
+            uint64_t duration = getDuration(configuration);
+            bestDuration = std::min(bestDuration, duration);
+            searcher.calculateNextConfiguration(ktt::TuningResult("kernel", configuration, ktt::KernelRunResult(duration, 0)));
+        }
+        REQUIRE(bestDuration == 200);
+    }
+}
+
+TEST_CASE("Pareto search with duration and memory objectives", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 8; a++)
+    {
+        for (size_t b = 1; b <= 8; b++)
+        {
+            configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+                std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a), ktt::ParameterPair("b", b)});
+        }
+    }
+
+    // Larger values of a trade memory for speed, larger values of b are only slower
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        size_t a = std::get<1>(configuration.getParameterPairs().at(0));
+        size_t b = std::get<1>(configuration.getParameterPairs().at(1));
+        ktt::TuningResult result("kernel", configuration, ktt::KernelRunResult(100 - 10 * a + b, 0));
+        result.setWorkGroupMemory(a * 1024);
+        return result;
+    };
+
+    SECTION("Dominance is evaluated over all objectives")
+    {
+        ktt::TuningResult fast = makeResult(configurations.at(7 * 8));
+        ktt::TuningResult small = makeResult(configurations.at(0));
+        ktt::TuningResult slow = makeResult(configurations.at(1));
+        REQUIRE_FALSE(fast.dominates(small));
+        REQUIRE_FALSE(small.dominates(fast));
+        REQUIRE(small.dominates(slow));
+        REQUIRE_FALSE(slow.dominates(slow));
+
+        slow.setValid(false);
+        REQUIRE(slow.dominates(slow) == false);
+        REQUIRE(small.dominates(slow));
+    }
+
+    SECTION("Pareto front contains only non-dominated configurations")
+    {
+        ktt::ParetoSearcher searcher(configurations, 1.0, 5);
+        for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+        {
+            searcher.calculateNextConfiguration(makeResult(searcher.getNextConfiguration()));
+        }
+
+        std::vector<ktt::KernelConfiguration> front = searcher.getParetoFront();
+        REQUIRE(front.size() == 8);
+        for (const auto& configuration : front)
+        {
+            REQUIRE(std::get<1>(configuration.getParameterPairs().at(1)) == 1);
+        }
+    }
+
+    SECTION("Invalidated configuration is removed from Pareto front")
+    {
+        ktt::ParetoSearcher searcher(configurations, 1.0, 5);
+        for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+        {
+            searcher.calculateNextConfiguration(makeResult(searcher.getNextConfiguration()));
+        }
+
+        ktt::TuningResult fastest = makeResult(configurations.at(7 * 8));
+        fastest.setValid(false);
+        searcher.invalidateResult(fastest);
+
+        // Configuration with a = 8, b = 2 was dominated only by the invalidated one
+        std::set<std::pair<size_t, size_t>> front;
+        for (const auto& configuration : searcher.getParetoFront())
+        {
+            front.emplace(std::get<1>(configuration.getParameterPairs().at(0)), std::get<1>(configuration.getParameterPairs().at(1)));
+        }
+        REQUIRE(front.size() == 8);
+        REQUIRE(front.find(std::make_pair(8, 1)) == front.end());
+        REQUIRE(front.find(std::make_pair(8, 2)) != front.end());
+    }
+}
+
+TEST_CASE("Searchers minimize custom objective value", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 8; a++)
+    {
+        configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+            std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a)});
+    }
+    std::vector<ktt::KernelParameter> parameters{ktt::KernelParameter("a", std::vector<size_t>{1, 2, 3, 4, 5, 6, 7, 8},
+        ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal)};
+
+    // Kernel duration favours large values of a, objective (e.g. time including transfers) favours a = 3
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        size_t a = std::get<1>(configuration.getParameterPairs().at(0));
+        ktt::TuningResult result("kernel", configuration, ktt::KernelRunResult(1000 - a, 0));
+        REQUIRE(result.getObjectiveValue() == static_cast<double>(result.getTotalDuration()));
+        result.setObjectiveValue(a >= 3 ? 97.0 + a : 110.0 - a);
+        return result;
+    };
+
+    ktt::PatternSearcher searcher(configurations, parameters, 1.0, 7);
+    size_t bestValue = 0;
+    double bestObjective = 1000.0;
+    for (size_t i = 0; i < 6; i++)
+    {
+        ktt::TuningResult result = makeResult(searcher.getNextConfiguration());
+        if (result.getObjectiveValue() < bestObjective)
+        {
+            bestObjective = result.getObjectiveValue();
+            bestValue = std::get<1>(result.getConfiguration().getParameterPairs().at(0));
+        }
+        searcher.calculateNextConfiguration(result);
+    }
+    REQUIRE(bestValue == 3);
+}
+
+TEST_CASE("Cost-aware search avoids expensive compilation", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 8; a++)
+    {
+        for (size_t b = 1; b <= 8; b++)
+        {
+            configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+                std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a), ktt::ParameterPair("b", b)});
+        }
+    }
+
+    // Durations are equal, compilation duration grows steeply with a (eg. unroll factor)
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        size_t a = std::get<1>(configuration.getParameterPairs().at(0));
+        ktt::KernelRunResult runResult(1000, 0);
+        runResult.increaseCompilationDuration(1'000'000 * a * a * a);
+        return ktt::TuningResult("kernel", configuration, runResult);
+    };
+
+    // Returns sum of a over configurations selected after initial exploration, each configuration is proposed only once
+    auto getSelectedValueSum = [&configurations, &makeResult](const double costWeight)
+    {
+        ktt::CostAwareSearcher searcher(configurations, 0.5, costWeight, 11, [](const ktt::KernelConfiguration&) { return false; });
+        REQUIRE(searcher.getConfigurationsCount() == 32);
+
+        std::set<std::vector<ktt::ParameterPair>> proposed;
+        size_t valueSum = 0;
+        for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+        {
+            ktt::KernelConfiguration configuration = searcher.getNextConfiguration();
+            REQUIRE(proposed.insert(configuration.getParameterPairs()).second);
+            if (i >= 8)
+            {
+                valueSum += std::get<1>(configuration.getParameterPairs().at(0));
+            }
+            searcher.calculateNextConfiguration(makeResult(configuration));
+        }
+        return valueSum;
+    };
+
+    // Random selection would average 4.5, selecting the cheapest unexplored configurations would average 2.0
+    const size_t costAwareSum = getSelectedValueSum(1.0);
+    REQUIRE(costAwareSum < 84);
+    REQUIRE(costAwareSum < getSelectedValueSum(0.0));
+}
+
+TEST_CASE("Profile guided search follows dominant bottleneck", "Component: Searcher")
+{
+    const std::vector<size_t> tiles{1, 2, 4, 8, 16, 32, 64, 128};
+    const std::vector<size_t> vectors{1, 2, 4, 8, 16};
+    const std::vector<size_t> unrolls{1, 2, 4, 8};
+
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (const auto tile : tiles)
+    {
+        for (const auto vector : vectors)
+        {
+            for (const auto unroll : unrolls)
+            {
+                configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{
+                    ktt::ParameterPair("tile", tile), ktt::ParameterPair("vector", vector), ktt::ParameterPair("unroll", unroll)});
+            }
+        }
+    }
+    std::vector<ktt::KernelParameter> parameters{
+        ktt::KernelParameter("tile", tiles, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply, ktt::Dimension::X,
+            ktt::ParameterType::Ordinal),
+        ktt::KernelParameter("vector", vectors, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply, ktt::Dimension::X,
+            ktt::ParameterType::Ordinal),
+        ktt::KernelParameter("unroll", unrolls, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply, ktt::Dimension::X,
+            ktt::ParameterType::Ordinal)};
+
+    // Cache miss rate grows with tile size, branch miss rate decreases with unroll factor, optimum is at tile <= 4, vector = 4, unroll = 8
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        const double tile = static_cast<double>(std::get<1>(configuration.getParameterPairs().at(0)));
+        const size_t vector = std::get<1>(configuration.getParameterPairs().at(1));
+        const double unroll = static_cast<double>(std::get<1>(configuration.getParameterPairs().at(2)));
+        const double cacheMissRate = std::max(0.01, 0.01 * tile / 4.0);
+        const double branchMissRate = 0.08 / unroll;
+        const double duration = 1000.0 * (1.0 + 10.0 * cacheMissRate) * (1.0 + 10.0 * branchMissRate) * (vector == 4 ? 1.0 : 1.2);
+
+        ktt::TuningResult result("kernel", configuration, ktt::KernelRunResult(static_cast<uint64_t>(duration), 0));
+        result.setHardwareCounters(std::map<std::string, uint64_t>{{"Instructions", 1000000}, {"Cycles", 800000},
+            {"Cache references", 100000}, {"Cache misses", static_cast<uint64_t>(100000 * cacheMissRate)}, {"Branches", 100000},
+            {"Branch misses", static_cast<uint64_t>(100000 * branchMissRate)}});
+        return result;
+    };
+
+    const uint64_t optimum = makeResult(configurations.at(11)).getKernelDuration();
+    size_t successCount = 0;
+
+    for (unsigned int seed = 0; seed < 10; seed++)
+    {
+        ktt::ProfileGuidedSearcher searcher(configurations, parameters, 0.2, seed);
+        REQUIRE(searcher.getConfigurationsCount() == 32);
+
+        std::set<std::vector<size_t>> visited;
+        uint64_t bestDuration = std::numeric_limits<uint64_t>::max();
+        for (size_t i = 0; i < searcher.getConfigurationsCount(); i++)
+        {
+            ktt::TuningResult result = makeResult(searcher.getNextConfiguration());
+            bestDuration = std::min(bestDuration, result.getKernelDuration());
+            std::vector<size_t> values;
+            for (const auto& parameterPair : result.getConfiguration().getParameterPairs())
+            {
+                values.push_back(std::get<1>(parameterPair));
+            }
+            visited.insert(values);
+            searcher.calculateNextConfiguration(result);
+        }
+
+        REQUIRE(visited.size() == searcher.getConfigurationsCount());
+        if (bestDuration == optimum)
+        {
+            successCount++;
+        }
+    }
+
+    // Random search finds one of three optimal configurations in 32 evaluations in less than half of the runs
+    REQUIRE(successCount >= 8);
+}
+
+TEST_CASE("Searchers forget invalidated results", "Component: Searcher")
+{
+    std::vector<ktt::KernelConfiguration> configurations;
+    for (size_t a = 1; a <= 4; a++)
+    {
+        for (size_t b = 1; b <= 4; b++)
+        {
+            configurations.emplace_back(ktt::DimensionVector(), ktt::DimensionVector(),
+                std::vector<ktt::ParameterPair>{ktt::ParameterPair("a", a), ktt::ParameterPair("b", b)});
+        }
+    }
+    std::vector<ktt::KernelParameter> parameters{
+        ktt::KernelParameter("a", std::vector<size_t>{1, 2, 3, 4}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply,
+            ktt::Dimension::X, ktt::ParameterType::Ordinal),
+        ktt::KernelParameter("b", std::vector<size_t>{1, 2, 3, 4}, ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply,
+            ktt::Dimension::X, ktt::ParameterType::Ordinal)};
+
+    auto makeResult = [](const ktt::KernelConfiguration& configuration)
+    {
+        uint64_t duration = std::get<1>(configuration.getParameterPairs().at(0)) * 10 + std::get<1>(configuration.getParameterPairs().at(1));
+        return ktt::TuningResult("kernel", configuration, ktt::KernelRunResult(duration, 0));
+    };
+
+    SECTION("Removed measurement no longer affects parameter effect model")
+    {
+        ktt::ParameterEffectModel model(2);
+        model.addMeasurement(std::vector<size_t>{1, 2}, 10.0);
+        model.addMeasurement(std::vector<size_t>{2, 2}, 20.0);
+        const double prediction = model.predict(std::vector<size_t>{1, 1});
+
+        model.addMeasurement(std::vector<size_t>{1, 1}, 1000.0);
+        REQUIRE(model.predict(std::vector<size_t>{1, 1}) > prediction * 2.0);
+        model.removeMeasurement(std::vector<size_t>{1, 1}, 1000.0);
+        REQUIRE(model.predict(std::vector<size_t>{1, 1}) == Approx(prediction));
+    }
+
+    SECTION("Built-in searchers keep searching after results are invalidated")
+    {
+        std::vector<std::unique_ptr<ktt::Searcher>> searchers;
+        searchers.push_back(std::make_unique<ktt::AnnealingSearcher>(configurations, 1.0, 4.0, 1));
+        searchers.push_back(std::make_unique<ktt::PSOSearcher>(configurations, parameters, 1.0, 4, 0.4, 0.4, 0.1, 2));
+        searchers.push_back(std::make_unique<ktt::PatternSearcher>(configurations, parameters, 1.0, 3));
+        searchers.push_back(std::make_unique<ktt::CostAwareSearcher>(configurations, 1.0, 0.5, 4,
+            [](const ktt::KernelConfiguration&) { return false; }));
+        searchers.push_back(std::make_unique<ktt::ProfileGuidedSearcher>(configurations, parameters, 1.0, 5));
+        searchers.push_back(std::make_unique<ktt::TransferSearcher>(configurations, std::vector<ktt::TuningResult>{}, 1.0, 2, 6));
+
+        std::vector<std::unique_ptr<ktt::Searcher>> portfolioSearchers;
+        portfolioSearchers.push_back(std::make_unique<ktt::AnnealingSearcher>(configurations, 1.0, 4.0, 7));
+        portfolioSearchers.push_back(std::make_unique<ktt::PSOSearcher>(configurations, parameters, 1.0, 4, 0.4, 0.4, 0.1, 8));
+        searchers.push_back(std::make_unique<ktt::PortfolioSearcher>(configurations, std::move(portfolioSearchers), 1.0, 9));
+
+        // Fastest configurations fail validation after their results were already given to searcher
+        for (auto& searcher : searchers)
+        {
+            for (size_t i = 0; i < searcher->getConfigurationsCount(); i++)
+            {
+                ktt::TuningResult result = makeResult(searcher->getNextConfiguration());
+                REQUIRE_NOTHROW(searcher->calculateNextConfiguration(result));
+                if (std::get<1>(result.getConfiguration().getParameterPairs().at(0)) == 1)
+                {
+                    result.setValid(false);
+                    REQUIRE_NOTHROW(searcher->invalidateResult(result));
+                }
+            }
+        }
+    }
+}
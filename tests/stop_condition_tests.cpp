@@ -0,0 +1,50 @@
+#include "catch.hpp"
+#include "tuning_runner/stop_condition.h"
+
+TEST_CASE("Stop condition evaluation", "Component: StopCondition")
+{
+    ktt::StopCondition condition;
+    condition.initialize();
+
+    SECTION("Condition without criteria is never satisfied")
+    {
+        condition.updateStatus(false, UINT64_MAX);
+        REQUIRE(!condition.isSatisfied());
+    }
+
+    SECTION("Failed configurations are counted")
+    {
+        condition.setCriterion(ktt::StopCriterion::FailedConfigurations, 2.0);
+        condition.updateStatus(false, UINT64_MAX);
+        condition.updateStatus(true, 100);
+        REQUIRE(!condition.isSatisfied());
+        condition.updateStatus(false, UINT64_MAX);
+        REQUIRE(condition.isSatisfied());
+    }
+
+    SECTION("Improvement resets stagnation counter")
+    {
+        condition.setCriterion(ktt::StopCriterion::ConfigurationsWithoutImprovement, 2.0);
+        condition.updateStatus(true, 100);
+        condition.updateStatus(true, 200);
+        condition.updateStatus(true, 50);
+        condition.updateStatus(true, 60);
+        REQUIRE(!condition.isSatisfied());
+        condition.updateStatus(false, UINT64_MAX);
+        REQUIRE(condition.isSatisfied());
+    }
+
+    SECTION("Target duration is reached only by valid results")
+    {
+        condition.setCriterion(ktt::StopCriterion::TargetDuration, 1000.0);
+        condition.updateStatus(false, 10);
+        REQUIRE(!condition.isSatisfied());
+        condition.updateStatus(true, 1000);
+        REQUIRE(condition.isSatisfied());
+    }
+
+    SECTION("Negative criterion value is rejected")
+    {
+        REQUIRE_THROWS_AS(condition.setCriterion(ktt::StopCriterion::TuningDuration, -1.0), std::runtime_error);
+    }
+}
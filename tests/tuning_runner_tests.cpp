@@ -0,0 +1,853 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+#include "catch.hpp"
+#include "compute_engine/replay/replay_engine.h"
+#include "kernel/kernel_manager.h"
+#include "kernel_argument/argument_manager.h"
+#include "tuning_runner/tuning_coordinator.h"
+#include "tuning_runner/tuning_runner.h"
+#include "utility/ktt_utility.h"
+#include "utility/logger.h"
+#include "utility/result_printer.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+// Recorded results of kernel with param_one in {1, 2, 3} and param_two in {1, 2}, duration of each configuration is
+// param_one * 100 + param_two, compilation duration is param_one * 1000, both multiplied by scale. Configurations with param_two 3
+// are not recorded, so their runs fail.
+static std::vector<ktt::TuningResult> getRecordedResults(const uint64_t durationScale = 1)
+{
+    std::vector<ktt::TuningResult> recordedResults;
+    for (size_t i = 1; i <= 3; i++)
+    {
+        for (size_t j = 1; j <= 2; j++)
+        {
+            ktt::KernelConfiguration configuration(ktt::DimensionVector(), ktt::DimensionVector(), std::vector<ktt::ParameterPair>{
+                ktt::ParameterPair("param_one", i), ktt::ParameterPair("param_two", j)});
+            recordedResults.emplace_back("testKernel", configuration, ktt::KernelRunResult((i * 100 + j) * durationScale, 0));
+            recordedResults.back().setCompilationDuration(i * 1000 * durationScale);
+        }
+    }
+    return recordedResults;
+}
+
+// Managers, logger and replay engine with recorded results shared by tuning runner tests
+class TuningRunnerFixture
+{
+public:
+    explicit TuningRunnerFixture(const ktt::RunMode& runMode = ktt::RunMode::Tuning) :
+        recordedResults(getRecordedResults()),
+        engine(recordedResults),
+        argumentManager(runMode)
+    {
+        logger.setLoggingTarget(logStream);
+    }
+
+    ktt::KernelId addKernel(const std::string& name, const std::vector<size_t>& secondParameterValues)
+    {
+        ktt::KernelId id = kernelManager.addKernel("", name, ktt::DimensionVector(1), ktt::DimensionVector(1));
+        kernelManager.addParameter(id, "param_one", std::vector<size_t>{1, 2, 3}, ktt::ThreadModifierType::None,
+            ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal);
+        kernelManager.addParameter(id, "param_two", secondParameterValues, ktt::ThreadModifierType::None,
+            ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal);
+        return id;
+    }
+
+    static uint64_t getRecordedDuration(const ktt::TuningResult& result)
+    {
+        std::vector<ktt::ParameterPair> pairs = result.getConfiguration().getParameterPairs();
+        return std::get<1>(pairs.at(0)) * 100 + std::get<1>(pairs.at(1));
+    }
+
+    std::vector<ktt::TuningResult> recordedResults;
+    ktt::ReplayEngine engine;
+    ktt::KernelManager kernelManager;
+    ktt::ArgumentManager argumentManager;
+    std::stringstream logStream;
+    ktt::Logger logger;
+};
+
+class FaultyManipulator : public ktt::TuningManipulator
+{
+public:
+    void launchComputation(const ktt::KernelId id) override
+    {
+        std::vector<ktt::ParameterPair> configuration = getCurrentConfiguration();
+        if (std::get<1>(configuration.at(0)) == 2 && std::get<1>(configuration.at(1)) == 1)
+        {
+            std::abort();
+        }
+        if (std::get<1>(configuration.at(0)) == 3 && std::get<1>(configuration.at(1)) == 2)
+        {
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        }
+#if defined(__unix__) || defined(__APPLE__)
+        // Corrupted worker writes garbage into its connection with the tuning process
+        const char* workerDescriptor = std::getenv("KTT_WORKER_DESCRIPTOR");
+        if (std::get<1>(configuration.at(0)) == 1 && std::get<1>(configuration.at(1)) == 2 && workerDescriptor != nullptr)
+        {
+            const std::string garbage("1,garbage\n");
+            if (write(std::atoi(workerDescriptor), garbage.data(), garbage.size()) < 0)
+            {
+                std::abort();
+            }
+        }
+#endif
+        runKernel(id);
+    }
+};
+
+// Input of the tuned kernel, it is set by the test program before each tuning, so that worker process sees the same value
+static size_t isolatedTuningInput = 0;
+
+class InputCrashingManipulator : public ktt::TuningManipulator
+{
+public:
+    void launchComputation(const ktt::KernelId id) override
+    {
+        if (std::get<1>(getCurrentConfiguration().at(0)) == isolatedTuningInput)
+        {
+            std::abort();
+        }
+        runKernel(id);
+    }
+};
+
+class CrashingManipulator : public ktt::TuningManipulator
+{
+public:
+    void launchComputation(const ktt::KernelId) override
+    {
+        std::abort();
+    }
+};
+
+class CountingReference : public ktt::ReferenceClass
+{
+public:
+    explicit CountingReference(size_t& computationCount) :
+        computationCount(computationCount)
+    {}
+
+    void computeResult() override
+    {
+        computationCount++;
+    }
+
+    const void* getData(const ktt::ArgumentId) const override
+    {
+        return nullptr;
+    }
+
+private:
+    size_t& computationCount;
+};
+
+class ConstantReference : public ktt::ReferenceClass
+{
+public:
+    explicit ConstantReference(const std::vector<float>& result) :
+        result(result)
+    {}
+
+    void computeResult() override
+    {}
+
+    const void* getData(const ktt::ArgumentId) const override
+    {
+        return result.data();
+    }
+
+private:
+    std::vector<float> result;
+};
+
+class RecordingSearcher : public ktt::Searcher
+{
+public:
+    RecordingSearcher(size_t& validCount, size_t& invalidatedCount) :
+        index(0),
+        validCount(validCount),
+        invalidatedCount(invalidatedCount)
+    {}
+
+    void initialize(const std::vector<ktt::KernelConfiguration>& configurations, const std::vector<ktt::KernelParameter>&) override
+    {
+        this->configurations = configurations;
+        index = 0;
+    }
+
+    ktt::KernelConfiguration getNextConfiguration() override
+    {
+        return configurations.at(index);
+    }
+
+    void calculateNextConfiguration(const ktt::TuningResult& previousResult) override
+    {
+        validCount += previousResult.isValid() ? 1 : 0;
+        index++;
+    }
+
+    void invalidateResult(const ktt::TuningResult& result) override
+    {
+        REQUIRE_FALSE(result.isValid());
+        invalidatedCount++;
+    }
+
+    size_t getConfigurationsCount() const override
+    {
+        return configurations.size();
+    }
+
+private:
+    std::vector<ktt::KernelConfiguration> configurations;
+    size_t index;
+    size_t& validCount;
+    size_t& invalidatedCount;
+};
+
+TEST_CASE("Configurations are spread across parallel devices", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2, 3});
+
+    ktt::ReplayEngine secondEngine(fixture.recordedResults);
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setParallelEngines(std::vector<ktt::ComputeEngine*>{&secondEngine});
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 9);
+
+    std::set<std::vector<ktt::ParameterPair>> configurations;
+    size_t validCount = 0;
+    size_t secondEngineCount = 0;
+    for (const auto& result : results)
+    {
+        configurations.insert(result.getConfiguration().getParameterPairs());
+        REQUIRE(result.getDeviceName() == "Replay device");
+        if (secondEngine.isProgramCached(fixture.kernelManager.getKernelSourceWithDefines(id, result.getConfiguration())))
+        {
+            secondEngineCount++;
+        }
+        if (result.isValid())
+        {
+            validCount++;
+            REQUIRE(result.getKernelDuration() == TuningRunnerFixture::getRecordedDuration(result));
+        }
+    }
+    REQUIRE(configurations.size() == 9);
+    REQUIRE(validCount == 6);
+    REQUIRE(secondEngineCount > 0);
+    REQUIRE(secondEngineCount < 9);
+}
+
+TEST_CASE("Custom searcher replaces search method", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2, 3});
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    size_t validCount = 0;
+    size_t invalidatedCount = 0;
+    tuningRunner.setSearchMethod(ktt::SearchMethod::RandomSearch, std::vector<double>{0.5});
+    tuningRunner.setSearcher(id, std::make_unique<RecordingSearcher>(validCount, invalidatedCount));
+
+    // Custom searcher proposes configurations in order of generation and receives all results
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    std::vector<ktt::KernelConfiguration> configurations = fixture.kernelManager.getKernelConfigurations(id, fixture.engine.getCurrentDeviceInfo());
+    REQUIRE(results.size() == 9);
+    REQUIRE(validCount == 6);
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        REQUIRE(results.at(i).getConfiguration().getParameterPairs() == configurations.at(i).getParameterPairs());
+    }
+
+    // Search method is used again after custom searcher is removed
+    tuningRunner.setSearcher(id, nullptr);
+    REQUIRE(tuningRunner.tuneKernel(id).size() == 4);
+    REQUIRE(validCount == 6);
+
+    ktt::TuningRunner computationRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Computation);
+    REQUIRE_THROWS(computationRunner.setSearcher(id, std::make_unique<RecordingSearcher>(validCount, invalidatedCount)));
+}
+
+TEST_CASE("Best configuration is selected by custom objective", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2, 3});
+
+    // Objective prefers configurations with larger param_one, even though they are slower
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setObjective(id, [](const ktt::TuningResult& result)
+    {
+        return static_cast<double>(result.getKernelDuration() % 100) - static_cast<double>(result.getKernelDuration() / 100) * 10.0;
+    });
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 9);
+
+    for (const auto& result : results)
+    {
+        if (result.isValid())
+        {
+            std::vector<ktt::ParameterPair> pairs = result.getConfiguration().getParameterPairs();
+            REQUIRE(result.getObjectiveValue() == Approx(std::get<1>(pairs.at(1)) - std::get<1>(pairs.at(0)) * 10.0));
+        }
+    }
+
+    ktt::ResultPrinter resultPrinter;
+    resultPrinter.setResult(id, results);
+    std::vector<ktt::ParameterPair> bestConfiguration = resultPrinter.getBestConfiguration(id);
+    REQUIRE(std::get<1>(bestConfiguration.at(0)) == 3);
+    REQUIRE(std::get<1>(bestConfiguration.at(1)) == 1);
+
+    // Failing objective invalidates the result
+    tuningRunner.setObjective(id, [](const ktt::TuningResult&) -> double { throw std::runtime_error("Objective is not available"); });
+    for (const auto& result : tuningRunner.tuneKernel(id))
+    {
+        REQUIRE_FALSE(result.isValid());
+    }
+}
+
+TEST_CASE("Portfolio search runs to completion", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2, 3});
+
+    // Inner searchers keep proposing configurations after portfolio evaluated them, until they are exhausted
+    for (unsigned int seed = 1; seed <= 20; seed++)
+    {
+        ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+            ktt::RunMode::Tuning);
+        tuningRunner.setSearchSeed(seed);
+        tuningRunner.setSearchMethod(ktt::SearchMethod::Portfolio, std::vector<double>{1.0});
+        std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+        REQUIRE(results.size() == 9);
+
+        std::set<std::vector<ktt::ParameterPair>> configurations;
+        for (const auto& result : results)
+        {
+            configurations.insert(result.getConfiguration().getParameterPairs());
+        }
+        REQUIRE(configurations.size() == 9);
+    }
+}
+
+TEST_CASE("Repeated measurements are summarized", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    REQUIRE_THROWS(tuningRunner.setMeasurementRepetitions(1, 0));
+    tuningRunner.setMeasurementRepetitions(2, 5);
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 6);
+
+    for (const auto& result : results)
+    {
+        REQUIRE(result.isValid());
+        REQUIRE(result.getKernelDurationSamples().size() == 5);
+        REQUIRE(result.getKernelDuration() == result.getKernelDurationSamples().at(0));
+        REQUIRE(result.getKernelDurationDeviation() == 0.0);
+
+        // Program is compiled during the first warm-up run only
+        REQUIRE(result.getCompilationDuration() == std::get<1>(result.getConfiguration().getParameterPairs().at(0)) * 1000);
+    }
+
+    ktt::TuningResult result = results.at(0);
+    result.setKernelDurationSamples(std::vector<uint64_t>{40, 10, 30, 20}, ktt::DurationStatistic::Median);
+    REQUIRE(result.getKernelDuration() == 25);
+    REQUIRE(result.getMinimumKernelDuration() == 10);
+    REQUIRE(result.getMeanKernelDuration() == 25.0);
+    REQUIRE(result.getKernelDurationDeviation() == Approx(12.9099).epsilon(0.001));
+    result.setKernelDurationSamples(std::vector<uint64_t>{40, 10, 30, 20}, ktt::DurationStatistic::Minimum);
+    REQUIRE(result.getKernelDuration() == 10);
+}
+
+TEST_CASE("Work-group memory of configurations is reported", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+
+    std::vector<ktt::TuningResult> recordedResults = getRecordedResults();
+    for (auto& result : recordedResults)
+    {
+        const auto& parameterPairs = result.getConfiguration().getParameterPairs();
+        result.setWorkGroupMemory(std::get<1>(parameterPairs.at(0)) * 1024 + std::get<1>(parameterPairs.at(1)));
+    }
+    ktt::ReplayEngine engine(recordedResults);
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &engine, ktt::RunMode::Tuning);
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 6);
+
+    for (const auto& result : results)
+    {
+        const auto& parameterPairs = result.getConfiguration().getParameterPairs();
+        REQUIRE(result.getWorkGroupMemory() == std::get<1>(parameterPairs.at(0)) * 1024 + std::get<1>(parameterPairs.at(1)));
+    }
+}
+
+TEST_CASE("Best configurations are reranked", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    REQUIRE_THROWS(tuningRunner.setFinalReranking(1, 10));
+    REQUIRE_THROWS(tuningRunner.setFinalReranking(3, 1));
+    tuningRunner.setFinalReranking(3, 10);
+    REQUIRE_THROWS(tuningRunner.isBestResultDistinguishable(id));
+
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    size_t rerankedCount = 0;
+    for (const auto& result : results)
+    {
+        if (result.getKernelDurationSamples().size() == 10)
+        {
+            rerankedCount++;
+            REQUIRE(result.getKernelDuration() <= 201);
+        }
+    }
+    REQUIRE(rerankedCount == 3);
+    REQUIRE(tuningRunner.isBestResultDistinguishable(id));
+
+    REQUIRE(ktt::getMannWhitneyPValue(std::vector<uint64_t>{10, 12, 11, 13}, std::vector<uint64_t>{12, 10, 13, 11}) == Approx(1.0));
+    REQUIRE(ktt::getMannWhitneyPValue(std::vector<uint64_t>{10, 11, 12, 10, 11, 12, 10, 11}, std::vector<uint64_t>{20, 21, 22, 20, 21,
+        22, 20, 21}) < 0.01);
+}
+
+TEST_CASE("Results database skips known configurations", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+    std::ofstream("database_test.txt", std::ios::trunc).close();
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setResultDatabase("database_test.txt");
+    tuningRunner.setInputSignature(id, "size 1");
+    REQUIRE_THROWS(tuningRunner.getStoredBestConfiguration(id));
+    REQUIRE(tuningRunner.tuneKernel(id).size() == 6);
+
+    ktt::ReplayEngine unusedEngine(fixture.recordedResults);
+    ktt::TuningRunner repeatedRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &unusedEngine,
+        ktt::RunMode::Tuning);
+    repeatedRunner.setResultDatabase("database_test.txt");
+    repeatedRunner.setInputSignature(id, "size 1");
+    std::vector<ktt::TuningResult> results = repeatedRunner.tuneKernel(id);
+    REQUIRE(results.size() == 6);
+
+    for (const auto& result : results)
+    {
+        REQUIRE(result.isValid());
+        REQUIRE(result.getKernelDuration() == TuningRunnerFixture::getRecordedDuration(result));
+        REQUIRE_FALSE(unusedEngine.isProgramCached(fixture.kernelManager.getKernelSourceWithDefines(id, result.getConfiguration())));
+    }
+
+    ktt::TuningRunner computationRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Computation);
+    computationRunner.setResultDatabase("database_test.txt");
+    computationRunner.setInputSignature(id, "size 1");
+    std::vector<ktt::ParameterPair> bestConfiguration = computationRunner.getStoredBestConfiguration(id);
+    REQUIRE(std::get<1>(bestConfiguration.at(0)) == 1);
+    REQUIRE(std::get<1>(bestConfiguration.at(1)) == 1);
+
+    computationRunner.setInputSignature(id, "size 2");
+    REQUIRE_THROWS(computationRunner.getStoredBestConfiguration(id));
+    std::remove("database_test.txt");
+}
+
+TEST_CASE("Online tuning explores configurations only with reference", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture(ktt::RunMode::Computation);
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2, 3});
+    std::vector<ktt::ParameterPair> defaultConfiguration{ktt::ParameterPair("param_one", 3), ktt::ParameterPair("param_two", 2)};
+
+    // Reference computation and validation are charged to exploration, recorded durations are long enough to make their cost negligible
+    ktt::ReplayEngine engine(getRecordedResults(1000000));
+
+    ktt::TuningRunner tuningModeRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &engine,
+        ktt::RunMode::Tuning);
+    REQUIRE_THROWS(tuningModeRunner.setOnlineTuning(id, true, 1.0, 2.0));
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &engine,
+        ktt::RunMode::Computation);
+    tuningRunner.setSearchSeed(1);
+    tuningRunner.setOnlineTuning(id, true, 1.0, 100.0);
+    for (size_t i = 0; i < 3; i++)
+    {
+        tuningRunner.runKernel(id, defaultConfiguration, std::vector<ktt::ArgumentOutputDescriptor>{});
+    }
+    REQUIRE(fixture.logStream.str().find("Exploring configuration") == std::string::npos);
+
+    // Configurations with param_two 3 are not recorded, their runs fail and are repeated with validated configuration
+    size_t referenceCount = 0;
+    tuningRunner.setReferenceClass(id, std::make_unique<CountingReference>(referenceCount), std::vector<ktt::ArgumentId>{});
+    for (size_t i = 0; i < 12; i++)
+    {
+        tuningRunner.runKernel(id, defaultConfiguration, std::vector<ktt::ArgumentOutputDescriptor>{});
+    }
+    REQUIRE(referenceCount == 8);
+
+    std::string log = fixture.logStream.str();
+    size_t lastRun = log.rfind("Running kernel <testKernel>");
+    REQUIRE(lastRun != std::string::npos);
+    REQUIRE(log.find("parameters: param_one: 1 param_two: 1 ", lastRun) != std::string::npos);
+}
+
+TEST_CASE("Kernels tuned together share device time by priority", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    std::vector<ktt::KernelId> ids{fixture.addKernel("firstKernel", std::vector<size_t>{1, 2}),
+        fixture.addKernel("secondKernel", std::vector<size_t>{1, 2})};
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    REQUIRE_THROWS(tuningRunner.setTuningPriority(ids.at(1), 0.0));
+    REQUIRE_THROWS(tuningRunner.tuneKernels(std::vector<ktt::KernelId>{ids.at(0), ids.at(0)}));
+    tuningRunner.setTuningBudget(ids.at(0), 0.0, 2);
+    tuningRunner.setTuningPriority(ids.at(1), 2.0);
+
+    std::vector<std::vector<ktt::TuningResult>> results = tuningRunner.tuneKernels(ids);
+    REQUIRE(results.size() == 2);
+    REQUIRE(results.at(0).size() == 2);
+    REQUIRE(results.at(1).size() == 6);
+    REQUIRE(tuningRunner.getStopReason(ids.at(0)) == "Tuning budget of the kernel was exhausted");
+
+    // Kernel with higher priority starts, the other kernel runs before it finishes
+    std::string log = fixture.logStream.str();
+    REQUIRE(log.find("Launching kernel <secondKernel>") < log.find("Launching kernel <firstKernel>"));
+    REQUIRE(log.find("Launching kernel <firstKernel>") < log.rfind("Launching kernel <secondKernel>"));
+}
+
+TEST_CASE("Results are invalidated by asynchronous validation", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+    std::vector<float> output{1.0f, 2.0f};
+    ktt::ArgumentId outputId = fixture.argumentManager.addArgument(output.data(), output.size(), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::WriteOnly, ktt::ArgumentUploadType::Vector);
+    fixture.kernelManager.setArguments(id, std::vector<ktt::ArgumentId>{outputId});
+
+    // Replayed kernel does not write its arguments, buffer with output is kept between runs as read-only buffer
+    ktt::KernelArgument buffer(outputId, output.data(), output.size(), ktt::ArgumentDataType::Float, ktt::ArgumentMemoryLocation::Device,
+        ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentUploadType::Vector);
+    fixture.engine.uploadArgument(buffer);
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    size_t validCount = 0;
+    size_t invalidatedCount = 0;
+    tuningRunner.setSearcher(id, std::make_unique<RecordingSearcher>(validCount, invalidatedCount));
+    tuningRunner.setAsynchronousValidation(true);
+
+    tuningRunner.setReferenceClass(id, std::make_unique<ConstantReference>(output), std::vector<ktt::ArgumentId>{outputId});
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 6);
+    REQUIRE(validCount == 6);
+    REQUIRE(invalidatedCount == 0);
+    for (const auto& result : results)
+    {
+        REQUIRE(result.isValid());
+    }
+
+    fixture.engine.uploadArgument(buffer);
+    tuningRunner.setReferenceClass(id, std::make_unique<ConstantReference>(std::vector<float>{1.0f, 3.0f}),
+        std::vector<ktt::ArgumentId>{outputId});
+    results = tuningRunner.tuneKernel(id);
+    REQUIRE(validCount == 12);
+    REQUIRE(invalidatedCount == 6);
+    for (const auto& result : results)
+    {
+        REQUIRE_FALSE(result.isValid());
+        REQUIRE(result.getStatusMessage() == "Results differ");
+        REQUIRE(result.getMaximumError() == Approx(1.0));
+    }
+    REQUIRE(fixture.logStream.str().find("was invalidated after tuning continued") != std::string::npos);
+
+    ktt::TuningRunner computationRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Computation);
+    REQUIRE_THROWS(computationRunner.setAsynchronousValidation(true));
+}
+
+TEST_CASE("Stop condition waits for asynchronous validation", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+    std::vector<float> output{1.0f, 2.0f};
+    ktt::ArgumentId outputId = fixture.argumentManager.addArgument(output.data(), output.size(), ktt::ArgumentDataType::Float,
+        ktt::ArgumentMemoryLocation::Device, ktt::ArgumentAccessType::WriteOnly, ktt::ArgumentUploadType::Vector);
+    fixture.kernelManager.setArguments(id, std::vector<ktt::ArgumentId>{outputId});
+
+    ktt::KernelArgument buffer(outputId, output.data(), output.size(), ktt::ArgumentDataType::Float, ktt::ArgumentMemoryLocation::Device,
+        ktt::ArgumentAccessType::ReadOnly, ktt::ArgumentUploadType::Vector);
+    fixture.engine.uploadArgument(buffer);
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setAsynchronousValidation(true);
+    tuningRunner.setStopCondition(ktt::StopCriterion::TargetDuration, 1e12);
+
+    // Every configuration reaches target duration, but only validated result may stop tuning
+    tuningRunner.setReferenceClass(id, std::make_unique<ConstantReference>(std::vector<float>{1.0f, 3.0f}),
+        std::vector<ktt::ArgumentId>{outputId});
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 6);
+    for (const auto& result : results)
+    {
+        REQUIRE_FALSE(result.isValid());
+    }
+
+    fixture.engine.uploadArgument(buffer);
+    tuningRunner.setReferenceClass(id, std::make_unique<ConstantReference>(output), std::vector<ktt::ArgumentId>{outputId});
+    results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() < 6);
+    REQUIRE(results.front().isValid());
+}
+
+TEST_CASE("Interrupted tuning is resumed from checkpoint", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2, 3});
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setSearchMethod(ktt::SearchMethod::RandomSearch, std::vector<double>{1.0});
+    tuningRunner.setCheckpointFile(id, "checkpoint_test.txt");
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 9);
+
+    // Simulate interruption during writing of the fifth result
+    std::vector<std::string> lines;
+    {
+        std::ifstream file("checkpoint_test.txt");
+        std::string line;
+        while (std::getline(file, line))
+        {
+            lines.push_back(line);
+        }
+    }
+    REQUIRE(lines.size() == 10);
+    {
+        std::ofstream file("checkpoint_test.txt", std::ios::trunc);
+        for (size_t i = 0; i < 5; i++)
+        {
+            file << lines.at(i) << std::endl;
+        }
+        file << lines.at(5).substr(0, lines.at(5).size() / 2);
+    }
+
+    ktt::TuningRunner resumedRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    resumedRunner.setSearchMethod(ktt::SearchMethod::RandomSearch, std::vector<double>{1.0});
+    REQUIRE_THROWS(resumedRunner.tuneKernel(id, true));
+    resumedRunner.setCheckpointFile(id, "checkpoint_test.txt");
+    std::vector<ktt::TuningResult> resumedResults = resumedRunner.tuneKernel(id, true);
+
+    REQUIRE(resumedResults.size() == 9);
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        REQUIRE(resumedResults.at(i).getConfiguration().getParameterPairs() == results.at(i).getConfiguration().getParameterPairs());
+        REQUIRE(resumedResults.at(i).isValid() == results.at(i).isValid());
+        REQUIRE(resumedResults.at(i).getKernelDuration() == results.at(i).getKernelDuration());
+        REQUIRE(resumedResults.at(i).getStatusMessage().empty() == results.at(i).getStatusMessage().empty());
+    }
+
+    // Recorded results are not measured again
+    REQUIRE(resumedResults.at(0).getCompilationDuration() == results.at(0).getCompilationDuration());
+
+    ktt::TuningCheckpoint checkpoint;
+    checkpoint.load("checkpoint_test.txt", "testKernel");
+    REQUIRE(checkpoint.getRecordedResultCount() == 9);
+    REQUIRE_THROWS(checkpoint.load("checkpoint_test.txt", "otherKernel"));
+    std::remove("checkpoint_test.txt");
+}
+
+TEST_CASE("Crashing and hanging configurations are run in isolated process", "Component: TuningRunner")
+{
+    if (!ktt::WorkerProcess::isSupported())
+    {
+        return;
+    }
+
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+    fixture.kernelManager.setTuningManipulatorFlag(id, true);
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setTuningManipulator(id, std::make_unique<FaultyManipulator>());
+    REQUIRE_THROWS(tuningRunner.setProcessIsolation(true, -1.0));
+    tuningRunner.setProcessIsolation(true, 1.0);
+    tuningRunner.setFinalReranking(2, 3);
+
+    // Worker executes this test binary again and runs only this test case until it reaches tuning of the kernel
+    tuningRunner.setProcessIsolationArguments(std::vector<std::string>{"Crashing and hanging configurations are run in isolated process"});
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    REQUIRE(results.size() == 6);
+    REQUIRE(fixture.logStream.str().find("Reranking 2 best configurations") != std::string::npos);
+    size_t rerankedCount = 0;
+
+    for (const auto& result : results)
+    {
+        std::vector<ktt::ParameterPair> pairs = result.getConfiguration().getParameterPairs();
+        if (std::get<1>(pairs.at(0)) == 2 && std::get<1>(pairs.at(1)) == 1)
+        {
+            REQUIRE_FALSE(result.isValid());
+            REQUIRE(result.getStatusMessage().find("signal") != std::string::npos);
+        }
+        else if (std::get<1>(pairs.at(0)) == 3 && std::get<1>(pairs.at(1)) == 2)
+        {
+            REQUIRE_FALSE(result.isValid());
+            REQUIRE(result.getStatusMessage().find("time limit") != std::string::npos);
+        }
+        else if (std::get<1>(pairs.at(0)) == 1 && std::get<1>(pairs.at(1)) == 2)
+        {
+            REQUIRE_FALSE(result.isValid());
+            REQUIRE(result.getStatusMessage().find("malformed result") != std::string::npos);
+        }
+        else
+        {
+            REQUIRE(result.isValid());
+            REQUIRE(result.getKernelDuration() == TuningRunnerFixture::getRecordedDuration(result));
+        }
+
+        if (result.getKernelDurationSamples().size() == 3)
+        {
+            rerankedCount++;
+        }
+    }
+
+    // Two best valid configurations are measured again by the worker during reranking
+    REQUIRE(rerankedCount == 2);
+}
+
+TEST_CASE("Repeated tuning of kernel is served by worker with the same input", "Component: TuningRunner")
+{
+    if (!ktt::WorkerProcess::isSupported())
+    {
+        return;
+    }
+
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+    fixture.kernelManager.setTuningManipulatorFlag(id, true);
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    tuningRunner.setTuningManipulator(id, std::make_unique<InputCrashingManipulator>());
+    tuningRunner.setProcessIsolation(true, 0.0);
+    tuningRunner.setProcessIsolationArguments(std::vector<std::string>{"Repeated tuning of kernel is served by worker with the same input"});
+
+    // Worker skips the first tuning when it serves the second one, so results are checked only after both tunings
+    isolatedTuningInput = 1;
+    std::vector<ktt::TuningResult> firstResults = tuningRunner.tuneKernel(id);
+    isolatedTuningInput = 2;
+    std::vector<ktt::TuningResult> secondResults = tuningRunner.tuneKernel(id);
+    isolatedTuningInput = 0;
+
+    REQUIRE(firstResults.size() == 6);
+    REQUIRE(secondResults.size() == 6);
+    for (size_t input = 1; input <= 2; input++)
+    {
+        for (const auto& result : input == 1 ? firstResults : secondResults)
+        {
+            const size_t firstParameter = std::get<1>(result.getConfiguration().getParameterPairs().at(0));
+            REQUIRE(result.isValid() == (firstParameter != input));
+        }
+    }
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST_CASE("Configurations of terminated worker are given to other workers", "Component: TuningRunner")
+{
+    TuningRunnerFixture fixture;
+    ktt::KernelId id = fixture.addKernel("testKernel", std::vector<size_t>{1, 2});
+
+    ktt::TuningRunner tuningRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+        ktt::RunMode::Tuning);
+    REQUIRE_THROWS(tuningRunner.getTuningCoordinatorPort());
+    tuningRunner.setTuningCoordinator("127.0.0.1", 0, 2);
+    const uint16_t port = tuningRunner.getTuningCoordinatorPort();
+
+    // First worker crashes on any configuration, second worker connects later and measures all configurations
+    std::vector<pid_t> workers;
+    for (size_t i = 0; i < 2; i++)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            // Exception must not unwind into the test framework of forked process
+            try
+            {
+                if (i == 0)
+                {
+                    fixture.kernelManager.setTuningManipulatorFlag(id, true);
+                }
+                else
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+                }
+
+                ktt::TuningRunner workerRunner(&fixture.argumentManager, &fixture.kernelManager, &fixture.logger, &fixture.engine,
+                    ktt::RunMode::Tuning);
+                workerRunner.setTuningManipulator(id, std::make_unique<CrashingManipulator>());
+                workerRunner.runTuningWorker(id, "127.0.0.1", port);
+            }
+            catch (...)
+            {
+                _exit(1);
+            }
+            _exit(0);
+        }
+        workers.push_back(pid);
+    }
+
+    std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(id);
+    int status = 0;
+    waitpid(workers.at(0), nullptr, 0);
+    waitpid(workers.at(1), &status, 0);
+    REQUIRE(WIFEXITED(status));
+    REQUIRE(WEXITSTATUS(status) == 0);
+
+    REQUIRE(results.size() == 6);
+    std::set<std::vector<ktt::ParameterPair>> configurations;
+    for (const auto& result : results)
+    {
+        configurations.insert(result.getConfiguration().getParameterPairs());
+        REQUIRE(result.isValid());
+        REQUIRE(result.getKernelDuration() == TuningRunnerFixture::getRecordedDuration(result));
+        REQUIRE(result.getDeviceName() == "Replay device");
+    }
+    REQUIRE(configurations.size() == 6);
+}
+
+TEST_CASE("Tuning coordinator rejects malformed input", "Component: TuningRunner")
+{
+    ktt::Logger logger;
+    REQUIRE_THROWS(ktt::TuningCoordinator("not an address", 0, 2, &logger));
+
+    ktt::TuningCoordinator coordinator("127.0.0.1", 0, 2, &logger);
+    REQUIRE(coordinator.getPort() != 0);
+
+    const std::vector<ktt::ParameterPair> expected{ktt::ParameterPair("a", 1), ktt::ParameterPair("b", 22)};
+    REQUIRE(ktt::TuningCoordinator::deserializeConfiguration("a,1,b,22") == expected);
+    REQUIRE_THROWS(ktt::TuningCoordinator::deserializeConfiguration("a,1,b"));
+    REQUIRE_THROWS(ktt::TuningCoordinator::deserializeConfiguration("a,x"));
+    REQUIRE_THROWS(ktt::TuningCoordinator::deserializeConfiguration("a,1x"));
+}
+#endif
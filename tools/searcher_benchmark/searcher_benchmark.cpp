@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+#include "compute_engine/replay/replay_engine.h"
+#include "enum/search_method.h"
+#include "kernel/kernel_manager.h"
+#include "kernel_argument/argument_manager.h"
+#include "tuning_runner/tuning_runner.h"
+#include "utility/logger.h"
+#include "utility/result_loader.h"
+
+// Replays recorded tuning results of a single kernel and compares search methods by the number of configurations and the amount
+// of tuning time (kernel and compilation durations) needed to find a configuration within given distance from the recorded optimum
+struct SearchMethodSetting
+{
+    std::string name;
+    ktt::SearchMethod method;
+    std::vector<double> arguments;
+};
+
+struct ThresholdStatistics
+{
+    size_t reachedCount = 0;
+    double configurationsSum = 0.0;
+    double durationSum = 0.0;
+};
+
+int main(int argc, char** argv)
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: searcher_benchmark <results file> <kernel name> [number of runs] [explored fraction]" << std::endl;
+        return 1;
+    }
+
+    std::string resultsFile = std::string(argv[1]);
+    std::string kernelName = std::string(argv[2]);
+    size_t runsCount = 100;
+    double fraction = 0.25;
+
+    if (argc >= 4)
+    {
+        runsCount = std::stoul(std::string(argv[3]));
+        if (argc >= 5)
+        {
+            fraction = std::stod(std::string(argv[4]));
+        }
+    }
+
+    const std::vector<double> thresholds{0.0, 1.0, 5.0, 10.0, 25.0};
+    const std::vector<SearchMethodSetting> settings
+    {
+        {"Random search", ktt::SearchMethod::RandomSearch, {fraction}},
+        {"PSO", ktt::SearchMethod::PSO, {fraction, 8, 0.4, 0.4, 0.1}},
+        {"Annealing", ktt::SearchMethod::Annealing, {fraction, 4.0}},
+        {"Pattern search", ktt::SearchMethod::PatternSearch, {fraction}},
+        {"Portfolio", ktt::SearchMethod::Portfolio, {fraction}},
+        {"Cost-aware", ktt::SearchMethod::CostAware, {fraction, 1.0}}
+    };
+
+    // Configuration space of replayed kernel is restricted to configurations present in recorded results
+    std::vector<ktt::TuningResult> recordedResults = ktt::ResultLoader::loadResults(resultsFile, kernelName);
+    ktt::ReplayEngine engine(recordedResults);
+    std::vector<std::string> parameterNames = engine.getParameterNames();
+    std::vector<std::vector<size_t>> recordedConfigurations = engine.getRecordedConfigurations();
+    std::set<std::vector<size_t>> recordedSet(recordedConfigurations.begin(), recordedConfigurations.end());
+    uint64_t optimum = engine.getBestRecordedDuration();
+
+    ktt::KernelManager kernelManager;
+    ktt::ArgumentManager argumentManager(ktt::RunMode::Tuning);
+    ktt::Logger logger;
+    std::ostream nullStream(nullptr);
+    logger.setLoggingTarget(nullStream);
+
+    ktt::KernelId kernelId = kernelManager.addKernel("", kernelName, ktt::DimensionVector(1), ktt::DimensionVector(1));
+    for (size_t i = 0; i < parameterNames.size(); i++)
+    {
+        std::set<size_t> values;
+        for (const auto& configuration : recordedConfigurations)
+        {
+            values.insert(configuration.at(i));
+        }
+        kernelManager.addParameter(kernelId, parameterNames.at(i), std::vector<size_t>(values.begin(), values.end()),
+            ktt::ThreadModifierType::None, ktt::ThreadModifierAction::Multiply, ktt::Dimension::X, ktt::ParameterType::Ordinal);
+    }
+    kernelManager.addConstraint(kernelId, [&recordedSet](std::vector<size_t> values) { return recordedSet.find(values) != recordedSet.end(); },
+        parameterNames);
+
+    std::cout << "Replaying " << recordedConfigurations.size() << " recorded configurations of kernel " << kernelName << ", optimum "
+        << optimum << "ns, " << runsCount << " runs per search method" << std::endl << std::endl;
+    std::cout << std::left << std::setw(16) << "Search method" << std::setw(12) << "Within (%)" << std::setw(12) << "Reached (%)"
+        << std::setw(18) << "Configurations" << "Tuning time (ms)" << std::endl;
+
+    for (const auto& setting : settings)
+    {
+        std::vector<ThresholdStatistics> statistics(thresholds.size());
+
+        for (size_t run = 0; run < runsCount; run++)
+        {
+            // Each run starts with empty program cache
+            ktt::ReplayEngine runEngine(recordedResults);
+            ktt::TuningRunner tuningRunner(&argumentManager, &kernelManager, &logger, &runEngine, ktt::RunMode::Tuning);
+            tuningRunner.setSearchMethod(setting.method, setting.arguments);
+            tuningRunner.setSearchSeed(static_cast<unsigned int>(run));
+            std::vector<ktt::TuningResult> results = tuningRunner.tuneKernel(kernelId);
+
+            uint64_t bestDuration = UINT64_MAX;
+            uint64_t elapsedDuration = 0;
+            std::vector<bool> reached(thresholds.size(), false);
+
+            for (size_t i = 0; i < results.size(); i++)
+            {
+                elapsedDuration += results.at(i).getCompilationDuration();
+                if (!results.at(i).isValid())
+                {
+                    continue;
+                }
+
+                elapsedDuration += results.at(i).getKernelDuration();
+                bestDuration = std::min(bestDuration, results.at(i).getKernelDuration());
+
+                for (size_t j = 0; j < thresholds.size(); j++)
+                {
+                    if (!reached.at(j) && bestDuration <= optimum * (1.0 + thresholds.at(j) / 100.0))
+                    {
+                        reached.at(j) = true;
+                        statistics.at(j).reachedCount++;
+                        statistics.at(j).configurationsSum += static_cast<double>(i + 1);
+                        statistics.at(j).durationSum += static_cast<double>(elapsedDuration);
+                    }
+                }
+            }
+        }
+
+        for (size_t j = 0; j < thresholds.size(); j++)
+        {
+            const ThresholdStatistics& current = statistics.at(j);
+            std::cout << std::left << std::setw(16) << setting.name << std::setw(12) << thresholds.at(j) << std::setw(12)
+                << 100.0 * current.reachedCount / runsCount;
+
+            if (current.reachedCount > 0)
+            {
+                std::cout << std::setw(18) << current.configurationsSum / current.reachedCount
+                    << current.durationSum / current.reachedCount / 1'000'000.0 << std::endl;
+            }
+            else
+            {
+                std::cout << std::setw(18) << "-" << "-" << std::endl;
+            }
+        }
+    }
+
+    return 0;
+}